@@ -18,6 +18,7 @@
         ['component!="shared_library"', {
           'dependencies': [
             '../tools/parser-shell.gyp:parser-shell',
+            '../tools/task-queue-benchmark.gyp:task-queue-benchmark',
           ],
         }],
         ['test_isolation_mode != "noop"', {
@@ -5,6 +5,7 @@
 #ifndef V8_LIBPLATFORM_LIBPLATFORM_H_
 #define V8_LIBPLATFORM_LIBPLATFORM_H_
 
+#include "include/libplatform/v8-tracing.h"
 #include "include/v8-platform.h"
 
 namespace v8 {
@@ -31,6 +32,17 @@ v8::Platform* CreateDefaultPlatform(int thread_pool_size = 0);
  */
 bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate);
 
+/**
+ * Records the trace events of the given |platform| with |tracing_controller|.
+ *
+ * The |platform| takes ownership of |tracing_controller| and has to be created
+ * using |CreateDefaultPlatform|. Call this before the platform is passed to
+ * v8::V8::InitializePlatform.
+ */
+void SetTracingController(
+    v8::Platform* platform,
+    v8::platform::tracing::TracingController* tracing_controller);
+
 
 }  // namespace platform
 }  // namespace v8
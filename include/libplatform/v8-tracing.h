@@ -0,0 +1,228 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_V8_TRACING_H_
+#define V8_LIBPLATFORM_V8_TRACING_H_
+
+#include <stdint.h>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace v8 {
+
+namespace base {
+class Mutex;
+}  // namespace base
+
+namespace platform {
+namespace tracing {
+
+const int kTraceMaxNumArgs = 2;
+
+/**
+ * A single trace event, as recorded by the TRACE_EVENT* macros.
+ */
+class TraceObject {
+ public:
+  union ArgValue {
+    bool as_bool;
+    uint64_t as_uint;
+    int64_t as_int;
+    double as_double;
+    const void* as_pointer;
+    const char* as_string;
+  };
+
+  TraceObject() : parameter_copy_storage_(nullptr) {}
+  ~TraceObject();
+
+  void Initialize(char phase, const uint8_t* category_enabled_flag,
+                  const char* name, uint64_t id, uint64_t bind_id,
+                  int num_args, const char** arg_names,
+                  const uint8_t* arg_types, const uint64_t* arg_values,
+                  unsigned int flags);
+  void UpdateDuration();
+
+  int pid() const { return pid_; }
+  int tid() const { return tid_; }
+  char phase() const { return phase_; }
+  const uint8_t* category_enabled_flag() const {
+    return category_enabled_flag_;
+  }
+  const char* name() const { return name_; }
+  uint64_t id() const { return id_; }
+  uint64_t bind_id() const { return bind_id_; }
+  int num_args() const { return num_args_; }
+  const char** arg_names() { return arg_names_; }
+  uint8_t* arg_types() { return arg_types_; }
+  ArgValue* arg_values() { return arg_values_; }
+  unsigned int flags() const { return flags_; }
+  int64_t ts() const { return ts_; }
+  uint64_t duration() const { return duration_; }
+
+ private:
+  int pid_;
+  int tid_;
+  char phase_;
+  const char* name_;
+  const uint8_t* category_enabled_flag_;
+  uint64_t id_;
+  uint64_t bind_id_;
+  int num_args_;
+  const char* arg_names_[kTraceMaxNumArgs];
+  uint8_t arg_types_[kTraceMaxNumArgs];
+  ArgValue arg_values_[kTraceMaxNumArgs];
+  char* parameter_copy_storage_;
+  unsigned int flags_;
+  int64_t ts_;
+  uint64_t duration_;
+
+  // Disallow copy and assign
+  TraceObject(const TraceObject&) = delete;
+  void operator=(const TraceObject&) = delete;
+};
+
+/**
+ * Receives the recorded trace events when tracing is stopped.
+ */
+class TraceWriter {
+ public:
+  TraceWriter() {}
+  virtual ~TraceWriter() {}
+  virtual void AppendTraceEvent(TraceObject* trace_event) = 0;
+  // Called once all events of a trace have been appended.
+  virtual void Flush() = 0;
+
+  /**
+   * Returns a writer that emits the Chrome trace event format ("JSON Object
+   * Format"), as read by chrome://tracing, to |stream|.
+   */
+  static TraceWriter* CreateJSONTraceWriter(std::ostream& stream);
+
+ private:
+  // Disallow copy and assign
+  TraceWriter(const TraceWriter&) = delete;
+  void operator=(const TraceWriter&) = delete;
+};
+
+enum TraceRecordMode {
+  // Record until the trace buffer of a thread is full.
+  RECORD_UNTIL_FULL,
+
+  // Record until the user ends the trace. The trace buffer of every thread is
+  // a ring buffer, so the oldest events are overwritten.
+  RECORD_CONTINUOUSLY
+};
+
+/**
+ * Selects the categories and the record mode of a trace.
+ */
+class TraceConfig {
+ public:
+  typedef std::vector<std::string> StringList;
+
+  /**
+   * Returns a config that records the "v8" category until the buffers are
+   * full.
+   */
+  static TraceConfig* CreateDefaultTraceConfig();
+
+  TraceConfig() : record_mode_(RECORD_UNTIL_FULL) {}
+  TraceRecordMode GetTraceRecordMode() const { return record_mode_; }
+  void SetTraceRecordMode(TraceRecordMode mode) { record_mode_ = mode; }
+
+  /**
+   * Categories may end in a '*' wildcard. Categories starting with
+   * "disabled-by-default-" are only enabled by matching them exactly.
+   */
+  void AddIncludedCategory(const char* included_category);
+  void AddExcludedCategory(const char* excluded_category);
+
+  /**
+   * A category group is a comma separated list of categories. It is enabled
+   * if one of its categories is included and not excluded.
+   */
+  bool IsCategoryGroupEnabled(const char* category_group) const;
+
+ private:
+  TraceRecordMode record_mode_;
+  StringList included_categories_;
+  StringList excluded_categories_;
+
+  // Disallow copy and assign
+  TraceConfig(const TraceConfig&) = delete;
+  void operator=(const TraceConfig&) = delete;
+};
+
+class ThreadTraceBuffer;
+
+/**
+ * Records trace events on behalf of the default platform, see
+ * v8::platform::SetTracingController().
+ *
+ * Every thread records into a ring buffer of its own, so recording an event
+ * takes no locks. Events are handed to the trace writer when tracing stops.
+ */
+class TracingController {
+ public:
+  static const size_t kDefaultEventsPerThread = 4 * 1024;
+
+  TracingController();
+  ~TracingController();
+
+  /**
+   * Takes ownership of |trace_writer|. Every thread that records events gets
+   * a buffer for |events_per_thread| events.
+   */
+  void Initialize(TraceWriter* trace_writer,
+                  size_t events_per_thread = kDefaultEventsPerThread);
+
+  const uint8_t* GetCategoryGroupEnabled(const char* category_group);
+  static const char* GetCategoryGroupName(
+      const uint8_t* category_enabled_flag);
+  uint64_t AddTraceEvent(char phase, const uint8_t* category_enabled_flag,
+                         const char* name, uint64_t id, uint64_t bind_id,
+                         int32_t num_args, const char** arg_names,
+                         const uint8_t* arg_types, const uint64_t* arg_values,
+                         unsigned int flags);
+  void UpdateTraceEventDuration(const uint8_t* category_enabled_flag,
+                                const char* name, uint64_t handle);
+
+  /**
+   * Takes ownership of |trace_config|.
+   */
+  void StartTracing(TraceConfig* trace_config);
+
+  /**
+   * Stops recording and writes the recorded events to the trace writer.
+   */
+  void StopTracing();
+
+ private:
+  ThreadTraceBuffer* GetThreadTraceBuffer();
+  void UpdateCategoryGroupEnabledFlags();
+
+  TraceWriter* trace_writer_;
+  TraceConfig* trace_config_;
+  size_t events_per_thread_;
+  // Guards the list of buffers. Never taken while recording an event, except
+  // for the first event of a thread.
+  base::Mutex* mutex_;
+  std::vector<ThreadTraceBuffer*> buffers_;
+  int32_t buffer_key_;
+  // Accessed atomically, as an Atomic32.
+  int32_t recording_;
+
+  // Disallow copy and assign
+  TracingController(const TracingController&) = delete;
+  void operator=(const TracingController&) = delete;
+};
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_V8_TRACING_H_
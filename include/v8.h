@@ -146,6 +146,7 @@ class Arguments;
 class Heap;
 class HeapObject;
 class Isolate;
+class JsonTape;
 class Object;
 struct StreamedSource;
 template<typename T> class CustomArguments;
@@ -1671,6 +1672,63 @@ class V8_EXPORT JSON {
                        Local<Value> Parse(Local<String> json_string));
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Isolate* isolate, Local<String> json_string);
+
+  /**
+   * Parses |length| bytes of UTF-8 at |utf8_data| without creating a string
+   * for the whole text; only keys and string values are decoded. Invalid
+   * UTF-8 is handled like String::NewFromUtf8 does. To parse the contents of
+   * an ArrayBuffer, pass ArrayBuffer::Contents::Data() and ByteLength().
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Isolate* isolate,
+                                                       const char* utf8_data,
+                                                       size_t length);
+
+  /**
+   * Data shared between StartParsing, the ParsingTask it returns and
+   * FinishParsing. Must outlive the task, and must be deleted on the thread
+   * of the isolate it was used with.
+   */
+  class V8_EXPORT BackgroundSource {
+   public:
+    BackgroundSource();
+    ~BackgroundSource();
+
+    internal::JsonTape* impl() const { return impl_; }
+
+   private:
+    // Prevent copying. Not implemented.
+    BackgroundSource(const BackgroundSource&);
+    BackgroundSource& operator=(const BackgroundSource&);
+
+    internal::JsonTape* impl_;
+  };
+
+  /**
+   * A task which tokenizes and validates a JSON string, returned by
+   * StartParsing. The embedder should run it on a background thread. It does
+   * not access the heap.
+   */
+  class ParsingTask {
+   public:
+    virtual ~ParsingTask() {}
+    virtual void Run() = 0;
+  };
+
+  /**
+   * Starts parsing |json_string| off the main thread. Returns a task which
+   * the user is responsible for running and deleting. External strings are
+   * read in place, the characters of other strings are copied first.
+   */
+  static ParsingTask* StartParsing(Isolate* isolate, Local<String> json_string,
+                                   BackgroundSource* source);
+
+  /**
+   * Creates the value for a JSON string started with StartParsing, once
+   * ParsingTask::Run has returned, or throws the SyntaxError it found. Only
+   * this step allocates objects; it may be repeated to create fresh copies.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> FinishParsing(
+      Isolate* isolate, BackgroundSource* source);
 };
 
 
@@ -40,6 +40,7 @@
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
+#include "src/json-tape.h"
 #include "src/messages.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/scanner-character-streams.h"
@@ -2650,6 +2651,22 @@ MaybeLocal<Value> JSON::Parse(Isolate* v8_isolate, Local<String> json_string) {
 }
 
 
+MaybeLocal<Value> JSON::Parse(Isolate* v8_isolate, const char* utf8_data,
+                              size_t length) {
+  auto isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  PREPARE_FOR_EXECUTION_WITH_ISOLATE(isolate, "JSON::Parse", Value);
+  Utils::ApiCheck(length <= static_cast<size_t>(i::kMaxInt), "v8::JSON::Parse",
+                  "UTF-8 data is too long");
+  i::JsonTape tape;
+  tape.InitializeUtf8(utf8_data, static_cast<int>(length));
+  tape.Tokenize(isolate->stack_guard()->real_climit());
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(tape.Materialize(isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
+
 Local<Value> JSON::Parse(Local<String> json_string) {
   auto isolate = reinterpret_cast<v8::Isolate*>(
       Utils::OpenHandle(*json_string)->GetIsolate());
@@ -2657,6 +2674,38 @@ Local<Value> JSON::Parse(Local<String> json_string) {
 }
 
 
+JSON::BackgroundSource::BackgroundSource() : impl_(new i::JsonTape()) {}
+
+
+JSON::BackgroundSource::~BackgroundSource() { delete impl_; }
+
+
+JSON::ParsingTask* JSON::StartParsing(Isolate* v8_isolate,
+                                      Local<String> json_string,
+                                      BackgroundSource* source) {
+  auto isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  LOG_API(isolate, "JSON::StartParsing");
+  ENTER_V8(isolate);
+  i::HandleScope scope(isolate);
+  source->impl()->Initialize(isolate, Utils::OpenHandle(*json_string));
+  return new i::BackgroundJsonParsingTask(source->impl());
+}
+
+
+MaybeLocal<Value> JSON::FinishParsing(Isolate* v8_isolate,
+                                      BackgroundSource* source) {
+  auto isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  PREPARE_FOR_EXECUTION_WITH_ISOLATE(isolate, "JSON::FinishParsing", Value);
+  Utils::ApiCheck(source->impl()->is_tokenized(), "v8::JSON::FinishParsing",
+                  "ParsingTask::Run has not finished");
+  Local<Value> result;
+  has_pending_exception =
+      !ToLocal<Value>(source->impl()->Materialize(isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
+
 // --- D a t a ---
 
 bool Value::FullIsUndefined() const {
@@ -1242,10 +1242,6 @@ void MacroAssembler::BumpSystemStackPointer(const Operand& space) {
     DCHECK(is_uint24(imm));
 
     Register source = StackPointer();
-    if (CpuFeatures::IsSupported(ALWAYS_ALIGN_CSP)) {
-      bic(csp, source, 0xf);
-      source = csp;
-    }
     if (!is_uint12(imm)) {
       int64_t imm_top_12_bits = imm >> 12;
       sub(csp, source, imm_top_12_bits << 12);
@@ -1328,10 +1328,9 @@ void MacroAssembler::AssertStackConsistency() {
   // much code to be generated.
   if (emit_debug_code() && use_real_aborts()) {
     if (csp.Is(StackPointer())) {
-      // Always check the alignment of csp if ALWAYS_ALIGN_CSP is true.  We
-      // can't check the alignment of csp without using a scratch register (or
-      // clobbering the flags), but the processor (or simulator) will abort if
-      // it is not properly aligned during a load.
+      // We can't check the alignment of csp without using a scratch register
+      // (or clobbering the flags), but the processor (or simulator) will abort
+      // if it is not properly aligned during a load.
       ldr(xzr, MemOperand(csp, 0));
     }
     if (FLAG_enable_slow_asserts && !csp.Is(StackPointer())) {
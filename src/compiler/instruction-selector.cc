@@ -688,7 +688,8 @@ void InstructionSelector::VisitBlock(BasicBlock* block) {
   for (Node* const node : *block) {
     if (node->opcode() == IrOpcode::kStore ||
         node->opcode() == IrOpcode::kCheckedStore ||
-        node->opcode() == IrOpcode::kCall) {
+        node->opcode() == IrOpcode::kCall ||
+        IrOpcode::IsAtomicOpcode(node->opcode())) {
       ++effect_level;
     }
     SetEffectLevel(node, effect_level);
@@ -1128,6 +1129,28 @@ void InstructionSelector::VisitNode(Node* node) {
     }
     case IrOpcode::kCheckedStore:
       return VisitCheckedStore(node);
+    case IrOpcode::kAtomicLoad: {
+      MachineRepresentation rep =
+          AtomicOpRepresentationOf(node->op()).representation();
+      MarkAsRepresentation(rep, node);
+      return VisitAtomicLoad(node);
+    }
+    case IrOpcode::kAtomicStore:
+      return VisitAtomicStore(node);
+    case IrOpcode::kAtomicExchange:
+      return MarkAsWord32(node), VisitAtomicExchange(node);
+    case IrOpcode::kAtomicCompareExchange:
+      return MarkAsWord32(node), VisitAtomicCompareExchange(node);
+    case IrOpcode::kAtomicAdd:
+      return MarkAsWord32(node), VisitAtomicAdd(node);
+    case IrOpcode::kAtomicSub:
+      return MarkAsWord32(node), VisitAtomicSub(node);
+    case IrOpcode::kAtomicAnd:
+      return MarkAsWord32(node), VisitAtomicAnd(node);
+    case IrOpcode::kAtomicOr:
+      return MarkAsWord32(node), VisitAtomicOr(node);
+    case IrOpcode::kAtomicXor:
+      return MarkAsWord32(node), VisitAtomicXor(node);
     default:
       V8_Fatal(__FILE__, __LINE__, "Unexpected operator #%d:%s @ node #%d",
                node->opcode(), node->op()->mnemonic(), node->id());
@@ -1351,6 +1374,39 @@ void InstructionSelector::VisitBitcastInt64ToFloat64(Node* node) {
 
 #endif  // V8_TARGET_ARCH_32_BIT
 
+// Only the following targets set MachineOperatorBuilder::kWord32Atomics.
+#if !V8_TARGET_ARCH_X64 && !V8_TARGET_ARCH_S390
+
+void InstructionSelector::VisitAtomicLoad(Node* node) { UNIMPLEMENTED(); }
+
+
+void InstructionSelector::VisitAtomicStore(Node* node) { UNIMPLEMENTED(); }
+
+
+void InstructionSelector::VisitAtomicExchange(Node* node) { UNIMPLEMENTED(); }
+
+
+void InstructionSelector::VisitAtomicCompareExchange(Node* node) {
+  UNIMPLEMENTED();
+}
+
+
+void InstructionSelector::VisitAtomicAdd(Node* node) { UNIMPLEMENTED(); }
+
+
+void InstructionSelector::VisitAtomicSub(Node* node) { UNIMPLEMENTED(); }
+
+
+void InstructionSelector::VisitAtomicAnd(Node* node) { UNIMPLEMENTED(); }
+
+
+void InstructionSelector::VisitAtomicOr(Node* node) { UNIMPLEMENTED(); }
+
+
+void InstructionSelector::VisitAtomicXor(Node* node) { UNIMPLEMENTED(); }
+
+#endif  // !V8_TARGET_ARCH_X64 && !V8_TARGET_ARCH_S390
+
 
 void InstructionSelector::VisitFinishRegion(Node* node) {
   OperandGenerator g(this);
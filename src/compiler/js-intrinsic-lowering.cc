@@ -99,6 +99,24 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       return ReduceTailCall(node);
     case Runtime::kInlineGetSuperConstructor:
       return ReduceGetSuperConstructor(node);
+    case Runtime::kInlineAtomicsLoad:
+      return ReduceAtomicsLoad(node);
+    case Runtime::kInlineAtomicsStore:
+      return ReduceAtomicsStore(node);
+    case Runtime::kInlineAtomicsCompareExchange:
+      return ReduceAtomicsCompareExchange(node);
+    case Runtime::kInlineAtomicsExchange:
+      return ReduceAtomicsBinop(node, &MachineOperatorBuilder::AtomicExchange);
+    case Runtime::kInlineAtomicsAdd:
+      return ReduceAtomicsBinop(node, &MachineOperatorBuilder::AtomicAdd);
+    case Runtime::kInlineAtomicsSub:
+      return ReduceAtomicsBinop(node, &MachineOperatorBuilder::AtomicSub);
+    case Runtime::kInlineAtomicsAnd:
+      return ReduceAtomicsBinop(node, &MachineOperatorBuilder::AtomicAnd);
+    case Runtime::kInlineAtomicsOr:
+      return ReduceAtomicsBinop(node, &MachineOperatorBuilder::AtomicOr);
+    case Runtime::kInlineAtomicsXor:
+      return ReduceAtomicsBinop(node, &MachineOperatorBuilder::AtomicXor);
     default:
       break;
   }
@@ -529,6 +547,126 @@ Reduction JSIntrinsicLowering::ReduceGetSuperConstructor(Node* node) {
 }
 
 
+// The Atomics builtins have already checked that the array is an integer
+// typed array on a SharedArrayBuffer, that the index is within bounds and
+// that the {value_count} operands following it are numbers.
+bool JSIntrinsicLowering::MatchAtomicsAccess(Node* node, int value_count,
+                                             MachineType* type, Node** base,
+                                             Node** offset) {
+  if (!machine()->Word32AtomicsSupported()) return false;
+  HeapObjectMatcher m(NodeProperties::GetValueInput(node, 0));
+  if (!m.HasValue() || !m.Value()->IsJSTypedArray()) return false;
+  Handle<JSTypedArray> const array = Handle<JSTypedArray>::cast(m.Value());
+  if (!array->GetBuffer()->is_shared()) return false;
+  switch (array->type()) {
+    case kExternalInt8Array:
+      *type = MachineType::Int8();
+      break;
+    case kExternalUint8Array:
+      *type = MachineType::Uint8();
+      break;
+    case kExternalInt16Array:
+      *type = MachineType::Int16();
+      break;
+    case kExternalUint16Array:
+      *type = MachineType::Uint16();
+      break;
+    case kExternalInt32Array:
+      *type = MachineType::Int32();
+      break;
+    case kExternalUint32Array:
+      *type = MachineType::Uint32();
+      break;
+    default:
+      // Uint8Clamped needs clamping, which stays in the runtime.
+      return false;
+  }
+  if (array->byte_length()->Number() > kMaxInt) return false;
+  for (int i = 1; i <= value_count + 1; ++i) {
+    Type* const operand_type =
+        NodeProperties::GetType(NodeProperties::GetValueInput(node, i));
+    if (!operand_type->Is(Type::Number())) return false;
+  }
+  Handle<FixedTypedArrayBase> elements =
+      Handle<FixedTypedArrayBase>::cast(handle(array->elements()));
+  *base = jsgraph()->PointerConstant(elements->external_pointer());
+  *offset = NodeProperties::GetValueInput(node, 1);
+  int const k = ElementSizeLog2Of(type->representation());
+  if (k > 0) {
+    *offset = graph()->NewNode(machine()->Word32Shl(), *offset,
+                               jsgraph()->Int32Constant(k));
+  }
+  if (machine()->Is64()) {
+    *offset = graph()->NewNode(machine()->ChangeUint32ToUint64(), *offset);
+  }
+  return true;
+}
+
+
+Reduction JSIntrinsicLowering::ReduceAtomicsLoad(Node* node) {
+  MachineType type;
+  Node* base;
+  Node* offset;
+  if (!MatchAtomicsAccess(node, 0, &type, &base, &offset)) return NoChange();
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* load = graph()->NewNode(machine()->AtomicLoad(type), base, offset,
+                                effect, control);
+  ReplaceWithValue(node, load, load);
+  return Replace(load);
+}
+
+
+Reduction JSIntrinsicLowering::ReduceAtomicsStore(Node* node) {
+  MachineType type;
+  Node* base;
+  Node* offset;
+  if (!MatchAtomicsAccess(node, 1, &type, &base, &offset)) return NoChange();
+  Node* value = NodeProperties::GetValueInput(node, 2);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* store =
+      graph()->NewNode(machine()->AtomicStore(type.representation()), base,
+                       offset, value, effect, control);
+  // Atomics.store returns the number that was stored.
+  ReplaceWithValue(node, value, store);
+  return Changed(store);
+}
+
+
+Reduction JSIntrinsicLowering::ReduceAtomicsCompareExchange(Node* node) {
+  MachineType type;
+  Node* base;
+  Node* offset;
+  if (!MatchAtomicsAccess(node, 2, &type, &base, &offset)) return NoChange();
+  Node* old_value = NodeProperties::GetValueInput(node, 2);
+  Node* new_value = NodeProperties::GetValueInput(node, 3);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* exchange =
+      graph()->NewNode(machine()->AtomicCompareExchange(type), base, offset,
+                       old_value, new_value, effect, control);
+  ReplaceWithValue(node, exchange, exchange);
+  return Replace(exchange);
+}
+
+
+Reduction JSIntrinsicLowering::ReduceAtomicsBinop(
+    Node* node, const Operator* (MachineOperatorBuilder::*op)(MachineType)) {
+  MachineType type;
+  Node* base;
+  Node* offset;
+  if (!MatchAtomicsAccess(node, 1, &type, &base, &offset)) return NoChange();
+  Node* value = NodeProperties::GetValueInput(node, 2);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* binop = graph()->NewNode((machine()->*op)(type), base, offset, value,
+                                 effect, control);
+  ReplaceWithValue(node, binop, binop);
+  return Replace(binop);
+}
+
+
 Reduction JSIntrinsicLowering::Change(Node* node, const Operator* op, Node* a,
                                       Node* b) {
   RelaxControls(node);
@@ -68,6 +68,14 @@ class JSIntrinsicLowering final : public AdvancedReducer {
   Reduction ReduceCall(Node* node);
   Reduction ReduceTailCall(Node* node);
   Reduction ReduceGetSuperConstructor(Node* node);
+  Reduction ReduceAtomicsLoad(Node* node);
+  Reduction ReduceAtomicsStore(Node* node);
+  Reduction ReduceAtomicsCompareExchange(Node* node);
+  Reduction ReduceAtomicsBinop(
+      Node* node, const Operator* (MachineOperatorBuilder::*op)(MachineType));
+
+  bool MatchAtomicsAccess(Node* node, int value_count, MachineType* type,
+                          Node** base, Node** offset);
 
   Reduction Change(Node* node, const Operator* op);
   Reduction Change(Node* node, const Operator* op, Node* a, Node* b);
@@ -96,6 +96,23 @@ MachineRepresentation StackSlotRepresentationOf(Operator const* op) {
   return OpParameter<MachineRepresentation>(op);
 }
 
+MachineType AtomicOpRepresentationOf(Operator const* op) {
+  DCHECK(op->opcode() == IrOpcode::kAtomicLoad ||
+         op->opcode() == IrOpcode::kAtomicExchange ||
+         op->opcode() == IrOpcode::kAtomicCompareExchange ||
+         op->opcode() == IrOpcode::kAtomicAdd ||
+         op->opcode() == IrOpcode::kAtomicSub ||
+         op->opcode() == IrOpcode::kAtomicAnd ||
+         op->opcode() == IrOpcode::kAtomicOr ||
+         op->opcode() == IrOpcode::kAtomicXor);
+  return OpParameter<MachineType>(op);
+}
+
+MachineRepresentation AtomicStoreRepresentationOf(Operator const* op) {
+  DCHECK_EQ(IrOpcode::kAtomicStore, op->opcode());
+  return OpParameter<MachineRepresentation>(op);
+}
+
 #define PURE_OP_LIST(V)                                                       \
   V(Word32And, Operator::kAssociative | Operator::kCommutative, 2, 0, 1)      \
   V(Word32Or, Operator::kAssociative | Operator::kCommutative, 2, 0, 1)       \
@@ -243,6 +260,28 @@ MachineRepresentation StackSlotRepresentationOf(Operator const* op) {
   V(kWord64)                           \
   V(kTagged)
 
+#define ATOMIC_TYPE_LIST(V) \
+  V(Int8)                   \
+  V(Uint8)                  \
+  V(Int16)                  \
+  V(Uint16)                 \
+  V(Int32)                  \
+  V(Uint32)
+
+#define ATOMIC_REPRESENTATION_LIST(V) \
+  V(kWord8)                           \
+  V(kWord16)                          \
+  V(kWord32)
+
+#define ATOMIC_RMW_OP_LIST(V) \
+  V(AtomicExchange, 3)        \
+  V(AtomicCompareExchange, 4) \
+  V(AtomicAdd, 3)             \
+  V(AtomicSub, 3)             \
+  V(AtomicAnd, 3)             \
+  V(AtomicOr, 3)              \
+  V(AtomicXor, 3)
+
 struct MachineOperatorGlobalCache {
 #define PURE(Name, properties, value_input_count, control_input_count,         \
              output_count)                                                     \
@@ -346,6 +385,48 @@ struct MachineOperatorGlobalCache {
   CheckedStore##Type##Operator kCheckedStore##Type;
   MACHINE_REPRESENTATION_LIST(STORE)
 #undef STORE
+
+#define ATOMIC_LOAD(Type)                                                     \
+  struct AtomicLoad##Type##Operator final : public Operator1<MachineType> {   \
+    AtomicLoad##Type##Operator()                                              \
+        : Operator1<MachineType>(                                             \
+              IrOpcode::kAtomicLoad, Operator::kNoThrow | Operator::kNoWrite, \
+              "AtomicLoad", 2, 1, 1, 1, 1, 0, MachineType::Type()) {}         \
+  };                                                                          \
+  AtomicLoad##Type##Operator kAtomicLoad##Type;
+  ATOMIC_TYPE_LIST(ATOMIC_LOAD)
+#undef ATOMIC_LOAD
+
+#define ATOMIC_STORE(kRep)                                               \
+  struct AtomicStore##kRep##Operator final                               \
+      : public Operator1<MachineRepresentation> {                        \
+    AtomicStore##kRep##Operator()                                        \
+        : Operator1<MachineRepresentation>(                              \
+              IrOpcode::kAtomicStore, Operator::kNoThrow, "AtomicStore", \
+              3, 1, 1, 0, 1, 0, MachineRepresentation::kRep) {}          \
+  };                                                                     \
+  AtomicStore##kRep##Operator kAtomicStore##kRep;
+  ATOMIC_REPRESENTATION_LIST(ATOMIC_STORE)
+#undef ATOMIC_STORE
+
+#define ATOMIC_RMW(Name, value_input_count, Type)                         \
+  struct Name##Type##Operator final : public Operator1<MachineType> {     \
+    Name##Type##Operator()                                                \
+        : Operator1<MachineType>(IrOpcode::k##Name, Operator::kNoThrow,   \
+                                 #Name, value_input_count, 1, 1, 1, 1, 0, \
+                                 MachineType::Type()) {}                  \
+  };                                                                      \
+  Name##Type##Operator k##Name##Type;
+#define ATOMIC_RMW_TYPES(Name, value_input_count) \
+  ATOMIC_RMW(Name, value_input_count, Int8)       \
+  ATOMIC_RMW(Name, value_input_count, Uint8)      \
+  ATOMIC_RMW(Name, value_input_count, Int16)      \
+  ATOMIC_RMW(Name, value_input_count, Uint16)     \
+  ATOMIC_RMW(Name, value_input_count, Int32)      \
+  ATOMIC_RMW(Name, value_input_count, Uint32)
+  ATOMIC_RMW_OP_LIST(ATOMIC_RMW_TYPES)
+#undef ATOMIC_RMW_TYPES
+#undef ATOMIC_RMW
 };
 
 
@@ -467,6 +548,45 @@ const Operator* MachineOperatorBuilder::CheckedStore(
   return nullptr;
 }
 
+
+const Operator* MachineOperatorBuilder::AtomicLoad(MachineType rep) {
+#define ATOMIC_LOAD(Type)             \
+  if (rep == MachineType::Type()) {   \
+    return &cache_.kAtomicLoad##Type; \
+  }
+  ATOMIC_TYPE_LIST(ATOMIC_LOAD)
+#undef ATOMIC_LOAD
+  UNREACHABLE();
+  return nullptr;
+}
+
+
+const Operator* MachineOperatorBuilder::AtomicStore(MachineRepresentation rep) {
+#define ATOMIC_STORE(kRep)                  \
+  if (rep == MachineRepresentation::kRep) { \
+    return &cache_.kAtomicStore##kRep;      \
+  }
+  ATOMIC_REPRESENTATION_LIST(ATOMIC_STORE)
+#undef ATOMIC_STORE
+  UNREACHABLE();
+  return nullptr;
+}
+
+
+#define ATOMIC_RMW(Name, value_input_count)                           \
+  const Operator* MachineOperatorBuilder::Name(MachineType rep) {     \
+    if (rep == MachineType::Int8()) return &cache_.k##Name##Int8;     \
+    if (rep == MachineType::Uint8()) return &cache_.k##Name##Uint8;   \
+    if (rep == MachineType::Int16()) return &cache_.k##Name##Int16;   \
+    if (rep == MachineType::Uint16()) return &cache_.k##Name##Uint16; \
+    if (rep == MachineType::Int32()) return &cache_.k##Name##Int32;   \
+    if (rep == MachineType::Uint32()) return &cache_.k##Name##Uint32; \
+    UNREACHABLE();                                                    \
+    return nullptr;                                                   \
+  }
+ATOMIC_RMW_OP_LIST(ATOMIC_RMW)
+#undef ATOMIC_RMW
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -104,6 +104,12 @@ CheckedStoreRepresentation CheckedStoreRepresentationOf(Operator const*);
 
 MachineRepresentation StackSlotRepresentationOf(Operator const* op);
 
+// An AtomicLoad and the atomic read-modify-write operations need a
+// MachineType; an AtomicStore only needs a MachineRepresentation.
+MachineType AtomicOpRepresentationOf(Operator const* op);
+
+MachineRepresentation AtomicStoreRepresentationOf(Operator const* op);
+
 // Interface for building machine-level operators. These operators are
 // machine-level but machine-independent and thus define a language suitable
 // for generating code to run on architectures such as ia32, x64, arm, etc.
@@ -137,6 +143,7 @@ class MachineOperatorBuilder final : public ZoneObject {
     kWord64Popcnt = 1u << 19,
     kWord32ReverseBits = 1u << 20,
     kWord64ReverseBits = 1u << 21,
+    kWord32Atomics = 1u << 22,
     kAllOptionalOps = kFloat32Max | kFloat32Min | kFloat64Max | kFloat64Min |
                       kFloat32RoundDown | kFloat64RoundDown | kFloat32RoundUp |
                       kFloat64RoundUp | kFloat32RoundTruncate |
@@ -167,6 +174,7 @@ class MachineOperatorBuilder final : public ZoneObject {
   const OptionalOperator Word32ReverseBits();
   const OptionalOperator Word64ReverseBits();
   bool Word32ShiftIsSafe() const { return flags_ & kWord32ShiftIsSafe; }
+  bool Word32AtomicsSupported() const { return flags_ & kWord32Atomics; }
 
   const Operator* Word64And();
   const Operator* Word64Or();
@@ -325,6 +333,28 @@ class MachineOperatorBuilder final : public ZoneObject {
   // checked-store heap, index, length, value
   const Operator* CheckedStore(CheckedStoreRepresentation);
 
+  // Sequentially consistent operations on 8, 16 and 32 bit integers, for
+  // targets that set kWord32Atomics. All but AtomicStore produce the value
+  // the memory location held before the operation.
+  // atomic-load [base + index]
+  const Operator* AtomicLoad(MachineType rep);
+  // atomic-store [base + index], value
+  const Operator* AtomicStore(MachineRepresentation rep);
+  // atomic-exchange [base + index], value
+  const Operator* AtomicExchange(MachineType rep);
+  // atomic-compare-exchange [base + index], old_value, new_value
+  const Operator* AtomicCompareExchange(MachineType rep);
+  // atomic-add [base + index], value
+  const Operator* AtomicAdd(MachineType rep);
+  // atomic-sub [base + index], value
+  const Operator* AtomicSub(MachineType rep);
+  // atomic-and [base + index], value
+  const Operator* AtomicAnd(MachineType rep);
+  // atomic-or [base + index], value
+  const Operator* AtomicOr(MachineType rep);
+  // atomic-xor [base + index], value
+  const Operator* AtomicXor(MachineType rep);
+
   // Target machine word-size assumed by this builder.
   bool Is32() const { return word() == MachineRepresentation::kWord32; }
   bool Is64() const { return word() == MachineRepresentation::kWord64; }
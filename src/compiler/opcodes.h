@@ -330,7 +330,16 @@
   V(LoadFramePointer)           \
   V(LoadParentFramePointer)     \
   V(CheckedLoad)                \
-  V(CheckedStore)
+  V(CheckedStore)               \
+  V(AtomicLoad)                 \
+  V(AtomicStore)                \
+  V(AtomicExchange)             \
+  V(AtomicCompareExchange)      \
+  V(AtomicAdd)                  \
+  V(AtomicSub)                  \
+  V(AtomicAnd)                  \
+  V(AtomicOr)                   \
+  V(AtomicXor)
 
 #define VALUE_OP_LIST(V) \
   COMMON_OP_LIST(V)      \
@@ -401,6 +410,11 @@ class IrOpcode {
     return value == kJSCallConstruct || value == kJSCallFunction;
   }
 
+  // Returns true if opcode for an atomic memory operator.
+  static bool IsAtomicOpcode(Value value) {
+    return kAtomicLoad <= value && value <= kAtomicXor;
+  }
+
   // Returns true if opcode for comparison operator.
   static bool IsComparisonOpcode(Value value) {
     return (kJSEqual <= value && value <= kJSGreaterThanOrEqual) ||
@@ -23,6 +23,7 @@ class InstructionSequence;
 class Linkage;
 class PipelineData;
 class Schedule;
+class ZonePool;
 
 class Pipeline {
  public:
@@ -69,6 +70,8 @@ class Pipeline {
   void BeginPhaseKind(const char* phase_kind);
   void RunPrintAndVerify(const char* phase, bool untyped = false);
   Handle<Code> ScheduleAndGenerateCode(CallDescriptor* call_descriptor);
+  bool ScheduleAndSelectInstructions(Linkage* linkage);
+  Handle<Code> AssembleCode(Linkage* linkage);
   void AllocateRegisters(const RegisterConfiguration* config,
                          CallDescriptor* descriptor, bool run_verifier);
 
@@ -78,9 +81,36 @@ class Pipeline {
   CompilationInfo* const info_;
   PipelineData* data_;
 
+  friend class MachineGraphCompilationJob;
+
   DISALLOW_COPY_AND_ASSIGN(Pipeline);
 };
 
+
+// Compiles a machine graph in two steps. {Execute} schedules the graph,
+// selects instructions and allocates registers; it neither allocates on the
+// heap nor creates handles, so it may run on a background thread. {Finalize}
+// assembles the code object and has to run on the main thread.
+class MachineGraphCompilationJob {
+ public:
+  MachineGraphCompilationJob(CompilationInfo* info,
+                             CallDescriptor* call_descriptor, Graph* graph);
+  ~MachineGraphCompilationJob();
+
+  // Returns false if the compilation failed.
+  bool Execute();
+
+  Handle<Code> Finalize();
+
+ private:
+  ZonePool* zone_pool_;
+  PipelineData* data_;
+  Linkage* linkage_;
+  Pipeline pipeline_;
+
+  DISALLOW_COPY_AND_ASSIGN(MachineGraphCompilationJob);
+};
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
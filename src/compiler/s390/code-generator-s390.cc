@@ -78,6 +78,10 @@ class S390OperandConverter final : public InstructionOperandConverter {
       case kMode_MRR:
         *first_index += 2;
         return MemOperand(InputRegister(index + 0), InputRegister(index + 1));
+      case kMode_MRRI:
+        *first_index += 3;
+        return MemOperand(InputRegister(index + 1), InputRegister(index + 0),
+                          InputInt32(index + 2));
     }
     UNREACHABLE();
     return MemOperand(r0);
@@ -103,6 +107,35 @@ static inline bool HasRegisterInput(Instruction* instr, int index) {
 }
 
 
+// Arithmetic and compare instructions read their right operand from memory
+// if the instruction selector folded a load into them.
+static inline bool HasMemoryInput(Instruction* instr) {
+  return AddressingModeField::decode(instr->opcode()) != kMode_None;
+}
+
+
+// Float values can be selected with load on condition once moved to general
+// registers, which takes the 64-bit LGDR/LDGR.
+static inline bool CanSelectFloatsInGeneralRegisters() {
+#if V8_TARGET_ARCH_S390X
+  return CpuFeatures::IsSupported(LOAD_STORE_ON_COND);
+#else
+  return false;
+#endif
+}
+
+
+// Integer compares that only feed a branch are deferred to
+// AssembleArchBranch, which fuses them into a compare and branch relative
+// instruction when the target is in reach.
+static inline bool IsFusableCompare(Instruction* instr) {
+  ArchOpcode op = instr->arch_opcode();
+  return (op == kS390_Cmp32 || op == kS390_Cmp64) &&
+         FlagsModeField::decode(instr->opcode()) == kFlags_branch &&
+         !HasMemoryInput(instr);
+}
+
+
 namespace {
 
 class OutOfLineLoadNAN32 final : public OutOfLineCode {
@@ -304,6 +337,32 @@ Condition FlagsConditionToCondition(FlagsCondition condition, ArchOpcode op) {
   } while (0)
 
 
+// The memory forms only have two operands, so the instruction selector
+// defines the output as the same register as the left input.
+#define ASSEMBLE_BINOP_RM(asm_instr_reg, asm_instr_imm, asm_instr_mem) \
+  do {                                                                 \
+    if (HasMemoryInput(instr)) {                                       \
+      AddressingMode mode = kMode_None;                                \
+      size_t first_index = 1;                                          \
+      MemOperand operand = i.MemoryOperand(&mode, &first_index);       \
+      DCHECK(i.OutputRegister().is(i.InputRegister(0)));               \
+      __ asm_instr_mem(i.OutputRegister(), operand);                   \
+    } else {                                                           \
+      ASSEMBLE_BINOP(asm_instr_reg, asm_instr_imm);                    \
+    }                                                                  \
+  } while (0)
+
+
+#define ASSEMBLE_FLOAT_BINOP_RM(asm_instr_mem)                       \
+  do {                                                               \
+    AddressingMode mode = kMode_None;                                \
+    size_t first_index = 1;                                          \
+    MemOperand operand = i.MemoryOperand(&mode, &first_index);       \
+    DCHECK(i.OutputDoubleRegister().is(i.InputDoubleRegister(0)));   \
+    __ asm_instr_mem(i.OutputDoubleRegister(), operand);             \
+  } while (0)
+
+
 #define ASSEMBLE_BINOP_INT(asm_instr_reg, asm_instr_imm)    \
   do {                                                         \
     if (HasRegisterInput(instr, 1)) {                          \
@@ -361,7 +420,16 @@ Condition FlagsConditionToCondition(FlagsCondition condition, ArchOpcode op) {
 
 #define ASSEMBLE_COMPARE(cmp_instr, cmpl_instr)                        \
   do {                                                                 \
-    if (HasRegisterInput(instr, 1)) {                                  \
+    if (HasMemoryInput(instr)) {                                       \
+      AddressingMode mode = kMode_None;                                \
+      size_t first_index = 1;                                          \
+      MemOperand operand = i.MemoryOperand(&mode, &first_index);       \
+      if (i.CompareLogical()) {                                        \
+        __ cmpl_instr(i.InputRegister(0), operand);                    \
+      } else {                                                         \
+        __ cmp_instr(i.InputRegister(0), operand);                     \
+      }                                                                \
+    } else if (HasRegisterInput(instr, 1)) {                           \
       if (i.CompareLogical()) {                                        \
         __ cmpl_instr(i.InputRegister(0), i.InputRegister(1));         \
       } else {                                                         \
@@ -377,6 +445,28 @@ Condition FlagsConditionToCondition(FlagsCondition condition, ArchOpcode op) {
   } while (0)
 
 
+#define ASSEMBLE_COMPARE_AND_BRANCH(cmp_branch, cmpl_branch, cond, label)  \
+  do {                                                                   \
+    if (HasRegisterInput(instr, 1)) {                                    \
+      if (i.CompareLogical()) {                                          \
+        __ cmpl_branch(cond, i.InputRegister(0), i.InputRegister(1),     \
+                       label);                                           \
+      } else {                                                           \
+        __ cmp_branch(cond, i.InputRegister(0), i.InputRegister(1),      \
+                      label);                                            \
+      }                                                                  \
+    } else {                                                             \
+      if (i.CompareLogical()) {                                          \
+        __ cmpl_branch(cond, i.InputRegister(0), i.InputImmediate(1),    \
+                       label);                                           \
+      } else {                                                           \
+        __ cmp_branch(cond, i.InputRegister(0), i.InputImmediate(1),     \
+                      label);                                            \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+
 #define ASSEMBLE_FLOAT_COMPARE(cmp_instr)                                 \
   do {                                                                    \
     __ cmp_instr(i.InputDoubleRegister(0), i.InputDoubleRegister(1);      \
@@ -409,30 +499,38 @@ Condition FlagsConditionToCondition(FlagsCondition condition, ArchOpcode op) {
   } while (0)
 
 
-#define ASSEMBLE_FLOAT_MAX(double_scratch_reg, general_scratch_reg)           \
-  do {                                                                        \
-    Label ge, done;                                                           \
-    __ cdbr(i.InputDoubleRegister(0), i.InputDoubleRegister(1));              \
-    __ bge(&ge, Label::kNear);                                                \
-    __ Move(i.OutputDoubleRegister(), i.InputDoubleRegister(1));              \
-    __ b(&done, Label::kNear);                                                \
-    __ bind(&ge);                                                             \
-    __ Move(i.OutputDoubleRegister(), i.InputDoubleRegister(0));              \
-    __ bind(&done);                                                           \
+// Selects input 0 if "input 0 <cond> input 1" holds and input 1 otherwise,
+// which gives the (b < a) ? a : b and (a < b) ? a : b semantics of Float*Max
+// and Float*Min. With load on condition, the values are selected in general
+// registers instead of branching on the comparison.
+#define ASSEMBLE_FLOAT_SELECT(cmp_instr, cond, general_scratch_reg)         \
+  do {                                                                      \
+    DoubleRegister left = i.InputDoubleRegister(0);                         \
+    DoubleRegister right = i.InputDoubleRegister(1);                        \
+    __ cmp_instr(left, right);                                              \
+    if (CanSelectFloatsInGeneralRegisters()) {                              \
+      __ lgdr(general_scratch_reg, right);                                  \
+      __ lgdr(r0, left);                                                    \
+      __ locgr(cond, general_scratch_reg, r0);                              \
+      __ ldgr(i.OutputDoubleRegister(), general_scratch_reg);               \
+    } else {                                                                \
+      Label select_left, done;                                              \
+      __ b(cond, &select_left, Label::kNear);                               \
+      __ Move(i.OutputDoubleRegister(), right);                             \
+      __ b(&done, Label::kNear);                                            \
+      __ bind(&select_left);                                                \
+      __ Move(i.OutputDoubleRegister(), left);                              \
+      __ bind(&done);                                                       \
+    }                                                                       \
   } while (0)
 
 
-#define ASSEMBLE_FLOAT_MIN(double_scratch_reg, general_scratch_reg)           \
-  do {                                                                        \
-    Label ge, done;                                                           \
-    __ cdbr(i.InputDoubleRegister(0), i.InputDoubleRegister(1));              \
-    __ bge(&ge, Label::kNear);                                                \
-    __ Move(i.OutputDoubleRegister(), i.InputDoubleRegister(0));              \
-    __ b(&done, Label::kNear);                                                \
-    __ bind(&ge);                                                             \
-    __ Move(i.OutputDoubleRegister(), i.InputDoubleRegister(1));              \
-    __ bind(&done);                                                           \
-  } while (0)
+#define ASSEMBLE_FLOAT_MAX(cmp_instr, general_scratch_reg) \
+  ASSEMBLE_FLOAT_SELECT(cmp_instr, gt, general_scratch_reg)
+
+
+#define ASSEMBLE_FLOAT_MIN(cmp_instr, general_scratch_reg) \
+  ASSEMBLE_FLOAT_SELECT(cmp_instr, lt, general_scratch_reg)
 
 
 // Only MRI mode for these instructions available
@@ -592,6 +690,198 @@ Condition FlagsConditionToCondition(FlagsCondition condition, ArchOpcode op) {
   } while (0)
 
 
+// Atomic loads need no fence: the matching stores are serialized below and
+// the compare-and-swap and interlocked-access instructions serialize too.
+#define ASSEMBLE_ATOMIC_LOAD(asm_instr)          \
+  do {                                           \
+    Register result = i.OutputRegister();        \
+    AddressingMode mode = kMode_None;            \
+    MemOperand operand = i.MemoryOperand(&mode); \
+    __ asm_instr(result, operand);               \
+  } while (0)
+
+
+#define ASSEMBLE_ATOMIC_STORE(asm_instr)                 \
+  do {                                                   \
+    size_t index = 0;                                    \
+    AddressingMode mode = kMode_None;                    \
+    MemOperand operand = i.MemoryOperand(&mode, &index); \
+    Register value = i.InputRegister(index);             \
+    __ asm_instr(value, operand);                        \
+    __ bcr(CC_ALWAYS, r0);                               \
+  } while (0)
+
+
+// CS and the interlocked-access instructions only take a base register and a
+// displacement, so the address of the location is formed in r1 first.
+#define ASSEMBLE_ATOMIC_ADDRESS()       \
+  do {                                  \
+    AddressingMode mode = kMode_None;   \
+    __ lay(r1, i.MemoryOperand(&mode)); \
+  } while (0)
+
+
+// Whether the first byte of a word in memory is its most significant one.
+// The simulator on little-endian hosts stores words in host order.
+#if V8_TARGET_LITTLE_ENDIAN
+static const bool kAtomicWordIsBigEndian = false;
+#else
+static const bool kAtomicWordIsBigEndian = true;
+#endif
+
+// The 8 and 16 bit operations update the aligned word that contains the field
+// with CS. Leaves the word address in r1 and the distance of the field from
+// the least significant end of the word, in bits, in ip.
+#define ASSEMBLE_ATOMIC_FIELD_ADDRESS(width)                          \
+  do {                                                                \
+    ASSEMBLE_ATOMIC_ADDRESS();                                        \
+    __ LoadRR(ip, r1);                                                \
+    __ And(ip, Operand(4 - (width) / 8));                             \
+    if (kAtomicWordIsBigEndian) __ Xor(ip, Operand(4 - (width) / 8)); \
+    __ ShiftLeft(ip, ip, Operand(3));                                 \
+    __ AndP(r1, Operand(~3));                                         \
+  } while (0)
+
+
+// Replaces the field in {word} with the low bits of r0. Clobbers r0.
+#define ASSEMBLE_ATOMIC_INSERT_FIELD(new_word, word, width) \
+  do {                                                      \
+    __ And(r0, Operand((1 << (width)) - 1));                \
+    __ ShiftLeft(r0, r0, ip);                               \
+    __ Load(new_word, Operand((1 << (width)) - 1));         \
+    __ ShiftLeft(new_word, new_word, ip);                   \
+    __ Xor(new_word, Operand(-1));                          \
+    __ And(new_word, word);                                 \
+    __ Or(new_word, r0);                                    \
+  } while (0)
+
+
+#define ASSEMBLE_ATOMIC_EXTEND_RESULT(width, is_signed) \
+  do {                                                  \
+    Register result = i.OutputRegister();               \
+    if (is_signed) {                                    \
+      if ((width) == 8) {                               \
+        __ lbr(result, result);                         \
+      } else {                                          \
+        __ lhr(result, result);                         \
+      }                                                 \
+    } else {                                            \
+      __ And(result, Operand((1 << (width)) - 1));      \
+    }                                                   \
+  } while (0)
+
+
+// Read-modify-write of a word with a CS loop. {bin_instr} computes the new
+// value from the old one and the operand, e.g. Add32 or LoadRR for exchange.
+#define ASSEMBLE_ATOMIC_BINOP_WORD(bin_instr)  \
+  do {                                         \
+    Label loop;                                \
+    Register value = i.InputRegister(2);       \
+    Register old_word = i.TempRegister(0);     \
+    Register new_word = i.TempRegister(1);     \
+    ASSEMBLE_ATOMIC_ADDRESS();                 \
+    __ LoadlW(old_word, MemOperand(r1));       \
+    __ bind(&loop);                            \
+    __ LoadRR(new_word, old_word);             \
+    __ bin_instr(new_word, value);             \
+    __ cs(old_word, new_word, MemOperand(r1)); \
+    __ bne(&loop);                             \
+    __ LoadRR(i.OutputRegister(), old_word);   \
+  } while (0)
+
+
+#define ASSEMBLE_ATOMIC_BINOP_FIELD(bin_instr, width, is_signed) \
+  do {                                                           \
+    Label loop;                                                  \
+    Register value = i.InputRegister(2);                         \
+    Register old_word = i.TempRegister(0);                       \
+    Register new_word = i.TempRegister(1);                       \
+    ASSEMBLE_ATOMIC_FIELD_ADDRESS(width);                        \
+    __ LoadlW(old_word, MemOperand(r1));                         \
+    __ bind(&loop);                                              \
+    __ ShiftRight(r0, old_word, ip);                             \
+    __ bin_instr(r0, value);                                     \
+    ASSEMBLE_ATOMIC_INSERT_FIELD(new_word, old_word, width);     \
+    __ cs(old_word, new_word, MemOperand(r1));                   \
+    __ bne(&loop);                                               \
+    __ ShiftRight(i.OutputRegister(), old_word, ip);             \
+    ASSEMBLE_ATOMIC_EXTEND_RESULT(width, is_signed);             \
+  } while (0)
+
+
+#define ASSEMBLE_ATOMIC_EXCHANGE_WORD()                  \
+  do {                                                   \
+    Label loop;                                          \
+    Register old_word = i.TempRegister(0);               \
+    ASSEMBLE_ATOMIC_ADDRESS();                           \
+    __ LoadlW(old_word, MemOperand(r1));                 \
+    __ bind(&loop);                                      \
+    __ cs(old_word, i.InputRegister(2), MemOperand(r1)); \
+    __ bne(&loop);                                       \
+    __ LoadRR(i.OutputRegister(), old_word);             \
+  } while (0)
+
+
+// Word-sized add, and, or and xor are single instructions with the
+// interlocked-access facility.
+#define ASSEMBLE_ATOMIC_BINOP_WORD_INTERLOCKED(interlocked_instr, bin_instr) \
+  do {                                                                       \
+    if (CpuFeatures::IsSupported(INTERLOCKED_ACCESS)) {                      \
+      ASSEMBLE_ATOMIC_ADDRESS();                                             \
+      __ interlocked_instr(i.OutputRegister(), i.InputRegister(2),           \
+                           MemOperand(r1));                                  \
+    } else {                                                                 \
+      ASSEMBLE_ATOMIC_BINOP_WORD(bin_instr);                                 \
+    }                                                                        \
+  } while (0)
+
+
+#define ASSEMBLE_ATOMIC_SUB_WORD()                      \
+  do {                                                  \
+    if (CpuFeatures::IsSupported(INTERLOCKED_ACCESS)) { \
+      ASSEMBLE_ATOMIC_ADDRESS();                        \
+      __ lcr(r0, i.InputRegister(2));                   \
+      __ laa(i.OutputRegister(), r0, MemOperand(r1));   \
+    } else {                                            \
+      ASSEMBLE_ATOMIC_BINOP_WORD(Sub32);                \
+    }                                                   \
+  } while (0)
+
+
+#define ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_WORD()                    \
+  do {                                                             \
+    ASSEMBLE_ATOMIC_ADDRESS();                                     \
+    __ LoadRR(i.OutputRegister(), i.InputRegister(2));             \
+    __ cs(i.OutputRegister(), i.InputRegister(3), MemOperand(r1)); \
+  } while (0)
+
+
+// Gives up as soon as the field no longer holds the expected value; a CS
+// failure caused by a change elsewhere in the word is retried.
+#define ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_FIELD(width, is_signed) \
+  do {                                                           \
+    Label loop, done;                                            \
+    Register expected = i.InputRegister(2);                      \
+    Register new_value = i.InputRegister(3);                     \
+    Register old_word = i.TempRegister(0);                       \
+    Register new_word = i.TempRegister(1);                       \
+    ASSEMBLE_ATOMIC_FIELD_ADDRESS(width);                        \
+    __ LoadlW(old_word, MemOperand(r1));                         \
+    __ bind(&loop);                                              \
+    __ ShiftRight(r0, old_word, ip);                             \
+    __ Xor(r0, expected);                                        \
+    __ And(r0, Operand((1 << (width)) - 1));                     \
+    __ bne(&done);                                               \
+    __ LoadRR(r0, new_value);                                    \
+    ASSEMBLE_ATOMIC_INSERT_FIELD(new_word, old_word, width);     \
+    __ cs(old_word, new_word, MemOperand(r1));                   \
+    __ bne(&loop);                                               \
+    __ bind(&done);                                              \
+    __ ShiftRight(i.OutputRegister(), old_word, ip);             \
+    ASSEMBLE_ATOMIC_EXTEND_RESULT(width, is_signed);             \
+  } while (0)
+
+
 void CodeGenerator::AssembleDeconstructActivationRecord(int stack_param_delta) {
   int sp_slot_delta = TailCallFrameStackSlotDelta(stack_param_delta);
   if (sp_slot_delta > 0) {
@@ -783,22 +1073,31 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
               Operand(offset.offset()));
       break;
     }
+    case kS390_And32:
+      ASSEMBLE_BINOP_RM(AndP, AndP, And);
+      break;
     case kS390_And:
-      ASSEMBLE_BINOP(AndP, AndP);
+      ASSEMBLE_BINOP_RM(AndP, AndP, AndP);
       break;
     case kS390_AndComplement:
       __ NotP(i.InputRegister(1));
       __ AndP(i.OutputRegister(), i.InputRegister(0), i.InputRegister(1));
       break;
+    case kS390_Or32:
+      ASSEMBLE_BINOP_RM(OrP, OrP, Or);
+      break;
     case kS390_Or:
-      ASSEMBLE_BINOP(OrP, OrP);
+      ASSEMBLE_BINOP_RM(OrP, OrP, OrP);
       break;
     case kS390_OrComplement:
       __ NotP(i.InputRegister(1));
       __ OrP(i.OutputRegister(), i.InputRegister(0), i.InputRegister(1));
       break;
+    case kS390_Xor32:
+      ASSEMBLE_BINOP_RM(XorP, XorP, Xor);
+      break;
     case kS390_Xor:
-      ASSEMBLE_BINOP(XorP, XorP);
+      ASSEMBLE_BINOP_RM(XorP, XorP, XorP);
       break;
     case kS390_ShiftLeft32:
       if (HasRegisterInput(instr, 1)) {
@@ -925,13 +1224,16 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       }
       break;
 #endif
+    case kS390_Add32:
+      ASSEMBLE_BINOP_RM(AddP, AddP, Add32);
+      break;
     case kS390_Add:
 #if V8_TARGET_ARCH_S390X
       if (FlagsModeField::decode(instr->opcode()) != kFlags_none) {
         ASSEMBLE_ADD_WITH_OVERFLOW();
       } else {
 #endif
-        ASSEMBLE_BINOP(AddP, AddP);
+        ASSEMBLE_BINOP_RM(AddP, AddP, AddP);
 #if V8_TARGET_ARCH_S390X
       }
 #endif
@@ -950,8 +1252,10 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
     }
       break;
     case kS390_AddDouble:
+    if (HasMemoryInput(instr)) {
+      ASSEMBLE_FLOAT_BINOP_RM(adb);
     // Ensure we don't clobber right/InputReg(1)
-    if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
+    } else if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
         ASSEMBLE_FLOAT_UNOP(adbr);
     } else {
         if (!i.OutputDoubleRegister().is(i.InputDoubleRegister(0)))
@@ -959,13 +1263,16 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       __ adbr(i.OutputDoubleRegister(), i.InputDoubleRegister(1));
     }
       break;
+    case kS390_Sub32:
+      ASSEMBLE_BINOP_RM(SubP, SubP, Sub32);
+      break;
     case kS390_Sub:
 #if V8_TARGET_ARCH_S390X
       if (FlagsModeField::decode(instr->opcode()) != kFlags_none) {
         ASSEMBLE_SUB_WITH_OVERFLOW();
       } else {
 #endif
-        ASSEMBLE_BINOP(SubP, SubP);
+        ASSEMBLE_BINOP_RM(SubP, SubP, SubP);
 #if V8_TARGET_ARCH_S390X
       }
 #endif
@@ -988,7 +1295,9 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       break;
     case kS390_SubDouble:
     // OutputDoubleReg() = i.InputDoubleRegister(0) - i.InputDoubleRegister(1)
-    if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
+    if (HasMemoryInput(instr)) {
+        ASSEMBLE_FLOAT_BINOP_RM(sdb);
+      } else if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
         __ ldr(kScratchDoubleReg, i.InputDoubleRegister(1));
         __ ldr(i.OutputDoubleRegister(), i.InputDoubleRegister(0));
         __ sdbr(i.OutputDoubleRegister(), kScratchDoubleReg);
@@ -1026,8 +1335,10 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       }
       break;
     case kS390_MulDouble:
+      if (HasMemoryInput(instr)) {
+        ASSEMBLE_FLOAT_BINOP_RM(mdb);
       // Ensure we don't clobber right
-      if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
+      } else if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
         ASSEMBLE_FLOAT_UNOP(mdbr);
       } else {
         if (!i.OutputDoubleRegister().is(i.InputDoubleRegister(0)))
@@ -1073,7 +1384,9 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       break;
     case kS390_DivDouble:
       // InputDoubleRegister(1)=InputDoubleRegister(0)/InputDoubleRegister(1)
-      if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
+      if (HasMemoryInput(instr)) {
+        ASSEMBLE_FLOAT_BINOP_RM(ddb);
+      } else if (i.OutputDoubleRegister().is(i.InputDoubleRegister(1))) {
       __ ldr(kScratchDoubleReg, i.InputDoubleRegister(1));
       __ ldr(i.OutputDoubleRegister(), i.InputDoubleRegister(0));
       __ ddbr(i.OutputDoubleRegister(), kScratchDoubleReg);
@@ -1100,6 +1413,12 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
     case kS390_AbsFloat:
       __ lpebr(i.OutputDoubleRegister(), i.InputDoubleRegister(0));
       break;
+    case kS390_MaxFloat:
+      ASSEMBLE_FLOAT_MAX(cebr, kScratchReg);
+      break;
+    case kS390_MinFloat:
+      ASSEMBLE_FLOAT_MIN(cebr, kScratchReg);
+      break;
     case kS390_SqrtFloat:
       ASSEMBLE_FLOAT_UNOP(sqebr);
       break;
@@ -1125,10 +1444,10 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       __ LoadComplementRR(i.OutputRegister(), i.InputRegister(0));
       break;
     case kS390_MaxDouble:
-      ASSEMBLE_FLOAT_MAX(kScratchDoubleReg, kScratchReg);
+      ASSEMBLE_FLOAT_MAX(cdbr, kScratchReg);
       break;
     case kS390_MinDouble:
-      ASSEMBLE_FLOAT_MIN(kScratchDoubleReg, kScratchReg);
+      ASSEMBLE_FLOAT_MIN(cdbr, kScratchReg);
       break;
     case kS390_AbsDouble:
       __ lpdbr(i.OutputDoubleRegister(), i.InputDoubleRegister(0));
@@ -1183,10 +1502,13 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       break;
 #endif
     case kS390_Cmp32:
+      // Emitted along with the branch, see AssembleArchBranch.
+      if (IsFusableCompare(instr)) break;
       ASSEMBLE_COMPARE(Cmp32, CmpLogical32);
       break;
 #if V8_TARGET_ARCH_S390X
     case kS390_Cmp64:
+      if (IsFusableCompare(instr)) break;
       ASSEMBLE_COMPARE(CmpP, CmpLogicalP);
       break;
 #endif
@@ -1194,7 +1516,13 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       __ cebr(i.InputDoubleRegister(0), i.InputDoubleRegister(1));
       break;
     case kS390_CmpDouble:
-      __ cdbr(i.InputDoubleRegister(0), i.InputDoubleRegister(1));
+      if (HasMemoryInput(instr)) {
+        AddressingMode mode = kMode_None;
+        size_t first_index = 1;
+        __ cdb(i.InputDoubleRegister(0), i.MemoryOperand(&mode, &first_index));
+      } else {
+        __ cdbr(i.InputDoubleRegister(0), i.InputDoubleRegister(1));
+      }
       break;
     case kS390_Tst32:
       if (HasRegisterInput(instr, 1)) {
@@ -1571,6 +1899,84 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
     case kCheckedStoreFloat64:
       ASSEMBLE_CHECKED_STORE_DOUBLE();
       break;
+    case kS390_AtomicLoadInt8:
+      ASSEMBLE_ATOMIC_LOAD(LoadlB);
+      __ lbr(i.OutputRegister(), i.OutputRegister());
+      break;
+    case kS390_AtomicLoadUint8:
+      ASSEMBLE_ATOMIC_LOAD(LoadlB);
+      break;
+    case kS390_AtomicLoadInt16:
+      ASSEMBLE_ATOMIC_LOAD(LoadHalfWordP);
+      break;
+    case kS390_AtomicLoadUint16:
+      ASSEMBLE_ATOMIC_LOAD(LoadLogicalHalfWordP);
+      break;
+    case kS390_AtomicLoadWord32:
+      ASSEMBLE_ATOMIC_LOAD(LoadlW);
+      break;
+    case kS390_AtomicStoreWord8:
+      ASSEMBLE_ATOMIC_STORE(StoreByte);
+      break;
+    case kS390_AtomicStoreWord16:
+      ASSEMBLE_ATOMIC_STORE(StoreHalfWord);
+      break;
+    case kS390_AtomicStoreWord32:
+      ASSEMBLE_ATOMIC_STORE(StoreW);
+      break;
+#define ATOMIC_FIELD_CASES(Name, bin_instr)            \
+  case kS390_Atomic##Name##Int8:                       \
+    ASSEMBLE_ATOMIC_BINOP_FIELD(bin_instr, 8, true);   \
+    break;                                             \
+  case kS390_Atomic##Name##Uint8:                      \
+    ASSEMBLE_ATOMIC_BINOP_FIELD(bin_instr, 8, false);  \
+    break;                                             \
+  case kS390_Atomic##Name##Int16:                      \
+    ASSEMBLE_ATOMIC_BINOP_FIELD(bin_instr, 16, true);  \
+    break;                                             \
+  case kS390_Atomic##Name##Uint16:                     \
+    ASSEMBLE_ATOMIC_BINOP_FIELD(bin_instr, 16, false); \
+    break;
+      ATOMIC_FIELD_CASES(Exchange, LoadRR)
+      ATOMIC_FIELD_CASES(Add, Add32)
+      ATOMIC_FIELD_CASES(Sub, Sub32)
+      ATOMIC_FIELD_CASES(And, And)
+      ATOMIC_FIELD_CASES(Or, Or)
+      ATOMIC_FIELD_CASES(Xor, Xor)
+#undef ATOMIC_FIELD_CASES
+    case kS390_AtomicExchangeWord32:
+      ASSEMBLE_ATOMIC_EXCHANGE_WORD();
+      break;
+    case kS390_AtomicAddWord32:
+      ASSEMBLE_ATOMIC_BINOP_WORD_INTERLOCKED(laa, Add32);
+      break;
+    case kS390_AtomicSubWord32:
+      ASSEMBLE_ATOMIC_SUB_WORD();
+      break;
+    case kS390_AtomicAndWord32:
+      ASSEMBLE_ATOMIC_BINOP_WORD_INTERLOCKED(lan, And);
+      break;
+    case kS390_AtomicOrWord32:
+      ASSEMBLE_ATOMIC_BINOP_WORD_INTERLOCKED(lao, Or);
+      break;
+    case kS390_AtomicXorWord32:
+      ASSEMBLE_ATOMIC_BINOP_WORD_INTERLOCKED(lax, Xor);
+      break;
+    case kS390_AtomicCompareExchangeInt8:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_FIELD(8, true);
+      break;
+    case kS390_AtomicCompareExchangeUint8:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_FIELD(8, false);
+      break;
+    case kS390_AtomicCompareExchangeInt16:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_FIELD(16, true);
+      break;
+    case kS390_AtomicCompareExchangeUint16:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_FIELD(16, false);
+      break;
+    case kS390_AtomicCompareExchangeWord32:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE_WORD();
+      break;
     default:
       UNREACHABLE();
       break;
@@ -1587,16 +1993,28 @@ void CodeGenerator::AssembleArchBranch(Instruction* instr, BranchInfo* branch) {
   FlagsCondition condition = branch->condition;
 
   Condition cond = FlagsConditionToCondition(condition, op);
-  if (op == kS390_CmpDouble) {
-    // check for unordered if necessary
-    // Branching to flabel/tlabel according to what's expected by tests
-    if (cond == le || cond == eq || cond == lt) {
-      __ bunordered(flabel);
-    } else if (cond == gt || cond == ne || cond == ge) {
-      __ bunordered(tlabel);
+  if (IsFusableCompare(instr)) {
+    // Backward branches such as loop back edges have a bound target and
+    // become a single compare and branch relative instruction.
+    if (op == kS390_Cmp32) {
+      ASSEMBLE_COMPARE_AND_BRANCH(CmpAndBranch32, CmpLogicalAndBranch32, cond,
+                                  tlabel);
+    } else {
+      ASSEMBLE_COMPARE_AND_BRANCH(CmpAndBranchP, CmpLogicalAndBranchP, cond,
+                                  tlabel);
     }
+  } else {
+    if (op == kS390_CmpDouble) {
+      // check for unordered if necessary
+      // Branching to flabel/tlabel according to what's expected by tests
+      if (cond == le || cond == eq || cond == lt) {
+        __ bunordered(flabel);
+      } else if (cond == gt || cond == ne || cond == ge) {
+        __ bunordered(tlabel);
+      }
+    }
+    __ b(cond, tlabel);
   }
-  __ b(cond, tlabel);
   if (!branch->fallthru) __ b(flabel);  // no fallthru to flabel.
 }
 
@@ -1612,7 +2030,7 @@ void CodeGenerator::AssembleArchBoolean(Instruction* instr,
   S390OperandConverter i(this, instr);
   Label done;
   ArchOpcode op = instr->arch_opcode();
-  bool check_unordered = (op == kS390_CmpDouble || kS390_CmpFloat);
+  bool check_unordered = (op == kS390_CmpDouble || op == kS390_CmpFloat);
 
   // Overflow checked for add/sub only.
   DCHECK((condition != kOverflow && condition != kNotOverflow) ||
@@ -1623,6 +2041,13 @@ void CodeGenerator::AssembleArchBoolean(Instruction* instr,
   DCHECK_NE(0u, instr->OutputCount());
   Register reg = i.OutputRegister(instr->OutputCount() - 1);
   Condition cond = FlagsConditionToCondition(condition, op);
+  if (!check_unordered && CpuFeatures::IsSupported(LOAD_STORE_ON_COND)) {
+    // Neither LHI/LGHI nor LOCR/LOCGR change the condition code.
+    __ LoadImmP(reg, Operand::Zero());
+    __ LoadImmP(kScratchReg, Operand(1));
+    __ LoadOnConditionP(cond, reg, kScratchReg);
+    return;
+  }
   switch (cond) {
     case ne:
     case ge:
@@ -1674,8 +2099,8 @@ void CodeGenerator::AssembleArchLookupSwitch(Instruction* instr) {
   S390OperandConverter i(this, instr);
   Register input = i.InputRegister(0);
   for (size_t index = 2; index < instr->InputCount(); index += 2) {
-    __ CmpP(input, Operand(i.InputInt32(index + 0)));
-    __ beq(GetLabel(i.InputRpo(index + 1)));
+    __ CmpAndBranchP(eq, input, Operand(i.InputInt32(index + 0)),
+                     GetLabel(i.InputRpo(index + 1)));
   }
   AssembleArchJump(i.InputRpo(1));
 }
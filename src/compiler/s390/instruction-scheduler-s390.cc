@@ -11,13 +11,53 @@ namespace compiler {
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 
+namespace {
+
+// Latency of a load that hits the L1 cache.
+const int kLoadLatency = 4;
+
+
+// Returns true if the right operand of |instr| is read from memory, i.e. the
+// instruction selector folded a load into it.
+bool HasMemoryOperand(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kS390_And32:
+    case kS390_And:
+    case kS390_Or32:
+    case kS390_Or:
+    case kS390_Xor32:
+    case kS390_Xor:
+    case kS390_Add32:
+    case kS390_Add:
+    case kS390_AddDouble:
+    case kS390_Sub32:
+    case kS390_Sub:
+    case kS390_SubDouble:
+    case kS390_MulDouble:
+    case kS390_DivDouble:
+    case kS390_Cmp32:
+    case kS390_Cmp64:
+    case kS390_CmpDouble:
+      return instr->addressing_mode() != kMode_None;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+
 int InstructionScheduler::GetTargetInstructionFlags(
     const Instruction* instr) const {
+  if (HasMemoryOperand(instr)) return kIsLoadOperation;
   switch (instr->arch_opcode()) {
+    case kS390_And32:
     case kS390_And:
     case kS390_AndComplement:
+    case kS390_Or32:
     case kS390_Or:
     case kS390_OrComplement:
+    case kS390_Xor32:
     case kS390_Xor:
     case kS390_ShiftLeft32:
     case kS390_ShiftLeft64:
@@ -32,10 +72,12 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kS390_RotLeftAndClear64:
     case kS390_RotLeftAndClearLeft64:
     case kS390_RotLeftAndClearRight64:
+    case kS390_Add32:
     case kS390_Add:
     case kS390_AddWithOverflow32:
     case kS390_AddFloat:
     case kS390_AddDouble:
+    case kS390_Sub32:
     case kS390_Sub:
     case kS390_SubWithOverflow32:
     case kS390_SubFloat:
@@ -64,6 +106,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kS390_CeilFloat:
     case kS390_TruncateFloat:
     case kS390_AbsFloat:
+    case kS390_MaxFloat:
+    case kS390_MinFloat:
     case kS390_SqrtDouble:
     case kS390_FloorDouble:
     case kS390_CeilDouble:
@@ -137,6 +181,52 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kS390_StoreToStackSlot:
       return kHasSideEffect;
 
+    // Atomic operations order all other memory accesses around them.
+    case kS390_AtomicLoadInt8:
+    case kS390_AtomicLoadUint8:
+    case kS390_AtomicLoadInt16:
+    case kS390_AtomicLoadUint16:
+    case kS390_AtomicLoadWord32:
+    case kS390_AtomicStoreWord8:
+    case kS390_AtomicStoreWord16:
+    case kS390_AtomicStoreWord32:
+    case kS390_AtomicExchangeInt8:
+    case kS390_AtomicExchangeUint8:
+    case kS390_AtomicExchangeInt16:
+    case kS390_AtomicExchangeUint16:
+    case kS390_AtomicExchangeWord32:
+    case kS390_AtomicCompareExchangeInt8:
+    case kS390_AtomicCompareExchangeUint8:
+    case kS390_AtomicCompareExchangeInt16:
+    case kS390_AtomicCompareExchangeUint16:
+    case kS390_AtomicCompareExchangeWord32:
+    case kS390_AtomicAddInt8:
+    case kS390_AtomicAddUint8:
+    case kS390_AtomicAddInt16:
+    case kS390_AtomicAddUint16:
+    case kS390_AtomicAddWord32:
+    case kS390_AtomicSubInt8:
+    case kS390_AtomicSubUint8:
+    case kS390_AtomicSubInt16:
+    case kS390_AtomicSubUint16:
+    case kS390_AtomicSubWord32:
+    case kS390_AtomicAndInt8:
+    case kS390_AtomicAndUint8:
+    case kS390_AtomicAndInt16:
+    case kS390_AtomicAndUint16:
+    case kS390_AtomicAndWord32:
+    case kS390_AtomicOrInt8:
+    case kS390_AtomicOrUint8:
+    case kS390_AtomicOrInt16:
+    case kS390_AtomicOrUint16:
+    case kS390_AtomicOrWord32:
+    case kS390_AtomicXorInt8:
+    case kS390_AtomicXorUint8:
+    case kS390_AtomicXorInt16:
+    case kS390_AtomicXorUint16:
+    case kS390_AtomicXorWord32:
+      return kHasSideEffect;
+
 #define CASE(Name) case k##Name:
     COMMON_ARCH_OPCODE_LIST(CASE)
 #undef CASE
@@ -149,9 +239,182 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 
+namespace {
+
+// Basic latency modeling for s390 instructions, in cycles until the result
+// can be used by a dependent instruction. The values are approximations for
+// the z13 pipeline; simple fixed-point instructions default to 1.
+int GetRegisterFormLatency(ArchOpcode opcode) {
+  switch (opcode) {
+    case kCheckedLoadInt8:
+    case kCheckedLoadUint8:
+    case kCheckedLoadInt16:
+    case kCheckedLoadUint16:
+    case kCheckedLoadWord32:
+    case kCheckedLoadWord64:
+    case kCheckedLoadFloat32:
+    case kCheckedLoadFloat64:
+    case kS390_LoadWordS8:
+    case kS390_LoadWordU8:
+    case kS390_LoadWordS16:
+    case kS390_LoadWordU16:
+    case kS390_LoadWordS32:
+    case kS390_LoadWord64:
+    case kS390_LoadFloat32:
+    case kS390_LoadDouble:
+    case kS390_AtomicLoadInt8:
+    case kS390_AtomicLoadUint8:
+    case kS390_AtomicLoadInt16:
+    case kS390_AtomicLoadUint16:
+    case kS390_AtomicLoadWord32:
+      return kLoadLatency;
+
+    // Serialized accesses, most of them a compare-and-swap loop.
+    case kS390_AtomicExchangeInt8:
+    case kS390_AtomicExchangeUint8:
+    case kS390_AtomicExchangeInt16:
+    case kS390_AtomicExchangeUint16:
+    case kS390_AtomicExchangeWord32:
+    case kS390_AtomicCompareExchangeInt8:
+    case kS390_AtomicCompareExchangeUint8:
+    case kS390_AtomicCompareExchangeInt16:
+    case kS390_AtomicCompareExchangeUint16:
+    case kS390_AtomicCompareExchangeWord32:
+    case kS390_AtomicAddInt8:
+    case kS390_AtomicAddUint8:
+    case kS390_AtomicAddInt16:
+    case kS390_AtomicAddUint16:
+    case kS390_AtomicAddWord32:
+    case kS390_AtomicSubInt8:
+    case kS390_AtomicSubUint8:
+    case kS390_AtomicSubInt16:
+    case kS390_AtomicSubUint16:
+    case kS390_AtomicSubWord32:
+    case kS390_AtomicAndInt8:
+    case kS390_AtomicAndUint8:
+    case kS390_AtomicAndInt16:
+    case kS390_AtomicAndUint16:
+    case kS390_AtomicAndWord32:
+    case kS390_AtomicOrInt8:
+    case kS390_AtomicOrUint8:
+    case kS390_AtomicOrInt16:
+    case kS390_AtomicOrUint16:
+    case kS390_AtomicOrWord32:
+    case kS390_AtomicXorInt8:
+    case kS390_AtomicXorUint8:
+    case kS390_AtomicXorInt16:
+    case kS390_AtomicXorUint16:
+    case kS390_AtomicXorWord32:
+      return 2 * kLoadLatency;
+
+    case kS390_Mul32:
+    case kS390_MulHigh32:
+    case kS390_MulHighU32:
+      return 6;
+
+    case kS390_Mul64:
+      return 8;
+
+    case kS390_Div32:
+    case kS390_DivU32:
+    case kS390_Mod32:
+    case kS390_ModU32:
+      return 20;
+
+    case kS390_Div64:
+    case kS390_DivU64:
+    case kS390_Mod64:
+    case kS390_ModU64:
+      return 30;
+
+    case kS390_AddFloat:
+    case kS390_AddDouble:
+    case kS390_SubFloat:
+    case kS390_SubDouble:
+    case kS390_MulFloat:
+    case kS390_MulDouble:
+    case kS390_FloorFloat:
+    case kS390_CeilFloat:
+    case kS390_TruncateFloat:
+    case kS390_FloorDouble:
+    case kS390_CeilDouble:
+    case kS390_TruncateDouble:
+    case kS390_RoundDouble:
+      return 7;
+
+    case kS390_DivFloat:
+      return 17;
+
+    case kS390_DivDouble:
+      return 30;
+
+    case kS390_SqrtFloat:
+      return 20;
+
+    case kS390_SqrtDouble:
+      return 36;
+
+    case kS390_CmpFloat:
+    case kS390_CmpDouble:
+    case kS390_MaxFloat:
+    case kS390_MinFloat:
+    case kS390_MaxDouble:
+    case kS390_MinDouble:
+      return 3;
+
+    case kS390_Int64ToFloat32:
+    case kS390_Int64ToDouble:
+    case kS390_Uint64ToFloat32:
+    case kS390_Uint64ToDouble:
+    case kS390_Int32ToFloat32:
+    case kS390_Int32ToDouble:
+    case kS390_Uint32ToFloat32:
+    case kS390_Uint32ToDouble:
+    case kS390_Float32ToInt64:
+    case kS390_Float32ToUint64:
+    case kS390_Float32ToInt32:
+    case kS390_Float32ToUint32:
+    case kS390_DoubleToInt32:
+    case kS390_DoubleToUint32:
+    case kS390_DoubleToInt64:
+    case kS390_DoubleToUint64:
+    case kS390_Float32ToDouble:
+    case kS390_DoubleToFloat32:
+      return 8;
+
+    // Transfers between general and floating point registers.
+    case kS390_DoubleExtractLowWord32:
+    case kS390_DoubleExtractHighWord32:
+    case kS390_DoubleInsertLowWord32:
+    case kS390_DoubleInsertHighWord32:
+    case kS390_DoubleConstruct:
+    case kS390_BitcastInt32ToFloat32:
+    case kS390_BitcastFloat32ToInt32:
+    case kS390_BitcastInt64ToDouble:
+    case kS390_BitcastDoubleToInt64:
+      return 3;
+
+    case kS390_Cntlz32:
+    case kS390_Cntlz64:
+      return 3;
+
+    case kS390_Popcnt32:
+    case kS390_Popcnt64:
+      return 4;
+
+    default:
+      return 1;
+  }
+}
+
+}  // namespace
+
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // TODO(all): Add instruction cost modeling.
-  return 1;
+  // Instructions with a folded load also wait for the memory access.
+  int latency = GetRegisterFormLatency(instr->arch_opcode());
+  if (HasMemoryOperand(instr)) latency += kLoadLatency;
+  return latency;
 }
 
 }  // namespace compiler
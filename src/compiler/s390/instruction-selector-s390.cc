@@ -17,6 +17,8 @@ enum ImmediateMode {
   kInt16Imm_Unsigned,
   kInt16Imm_Negate,
   kInt16Imm_4ByteAligned,
+  kUint12Imm,
+  kInt20Imm,
   kShift32Imm,
   kShift64Imm,
   kNoImmediate
@@ -57,6 +59,10 @@ class S390OperandGenerator final : public OperandGenerator {
         return is_int16(-value);
       case kInt16Imm_4ByteAligned:
         return is_int16(value) && !(value & 3);
+      case kUint12Imm:
+        return is_uint12(value);
+      case kInt20Imm:
+        return is_int20(value);
       case kShift32Imm:
         return 0 <= value && value < 32;
       case kShift64Imm:
@@ -66,6 +72,55 @@ class S390OperandGenerator final : public OperandGenerator {
     }
     return false;
   }
+
+  // Returns true if |input| is a load of |rep| that |user| covers, so that
+  // the load can be folded into |user| as a memory operand.
+  bool CanBeMemoryOperand(Node* user, Node* input, MachineRepresentation rep) {
+    if (input->opcode() != IrOpcode::kLoad ||
+        !selector()->CanCover(user, input)) {
+      return false;
+    }
+    MachineRepresentation load_rep =
+        LoadRepresentationOf(input->op()).representation();
+    if (load_rep == MachineRepresentation::kTagged) {
+      load_rep = MachineType::PointerRepresentation();
+    }
+    return load_rep == rep;
+  }
+
+  // Appends the inputs addressing the memory read by |load| and returns the
+  // addressing mode. The displacement must fit |displacement_mode|.
+  AddressingMode GenerateMemoryOperandInputs(Node* load,
+                                             ImmediateMode displacement_mode,
+                                             InstructionOperand inputs[],
+                                             size_t* input_count) {
+    Node* base = load->InputAt(0);
+    Node* index = load->InputAt(1);
+    if (CanBeImmediate(index, displacement_mode)) {
+      inputs[(*input_count)++] = UseRegister(base);
+      inputs[(*input_count)++] = UseImmediate(index);
+      return kMode_MRI;
+    }
+    if (CanBeImmediate(base, displacement_mode)) {
+      inputs[(*input_count)++] = UseRegister(index);
+      inputs[(*input_count)++] = UseImmediate(base);
+      return kMode_MRI;
+    }
+    if (index->opcode() == (kPointerSize == 8 ? IrOpcode::kInt64Add
+                                              : IrOpcode::kInt32Add) &&
+        selector()->CanCover(load, index)) {
+      IntPtrBinopMatcher m(index);
+      if (CanBeImmediate(m.right().node(), displacement_mode)) {
+        inputs[(*input_count)++] = UseRegister(base);
+        inputs[(*input_count)++] = UseRegister(m.left().node());
+        inputs[(*input_count)++] = UseImmediate(m.right().node());
+        return kMode_MRRI;
+      }
+    }
+    inputs[(*input_count)++] = UseRegister(base);
+    inputs[(*input_count)++] = UseRegister(index);
+    return kMode_MRR;
+  }
 };
 
 
@@ -114,6 +169,66 @@ void VisitTryTruncateDouble(InstructionSelector* selector, ArchOpcode opcode,
 #endif
 
 
+// Returns the representation of the loads that can be folded into |opcode|
+// as its right operand, or kNone if |opcode| has no memory form.
+MachineRepresentation GetMemoryOperandRepresentation(ArchOpcode opcode) {
+  switch (opcode) {
+    case kS390_And32:
+    case kS390_Or32:
+    case kS390_Xor32:
+    case kS390_Add32:
+    case kS390_Sub32:
+    case kS390_Cmp32:
+      return MachineRepresentation::kWord32;
+    case kS390_And:
+    case kS390_Or:
+    case kS390_Xor:
+    case kS390_Add:
+    case kS390_Sub:
+    case kS390_Cmp64:
+      return MachineType::PointerRepresentation();
+    case kS390_AddDouble:
+    case kS390_SubDouble:
+    case kS390_MulDouble:
+    case kS390_DivDouble:
+    case kS390_CmpDouble:
+      return MachineRepresentation::kFloat64;
+    default:
+      return MachineRepresentation::kNone;
+  }
+}
+
+
+// Emits |opcode| with a load folded in as the right operand, if |node| covers
+// a suitable load. The RX/RXY forms overwrite their left operand, so the
+// output is defined as the same register as the left input.
+bool TryVisitBinopWithMemoryOperand(InstructionSelector* selector, Node* node,
+                                    ArchOpcode opcode,
+                                    ImmediateMode displacement_mode) {
+  S390OperandGenerator g(selector);
+  MachineRepresentation rep = GetMemoryOperandRepresentation(opcode);
+  if (rep == MachineRepresentation::kNone) return false;
+  Node* left = node->InputAt(0);
+  Node* right = node->InputAt(1);
+  if (!g.CanBeMemoryOperand(node, right, rep)) {
+    if (!node->op()->HasProperty(Operator::kCommutative) ||
+        !g.CanBeMemoryOperand(node, left, rep)) {
+      return false;
+    }
+    std::swap(left, right);
+  }
+  InstructionOperand inputs[4];
+  size_t input_count = 0;
+  inputs[input_count++] = g.UseRegister(left);
+  AddressingMode mode = g.GenerateMemoryOperandInputs(
+      right, displacement_mode, inputs, &input_count);
+  InstructionOperand output = g.DefineSameAsFirst(node);
+  selector->Emit(opcode | AddressingModeField::encode(mode), 1, &output,
+                 input_count, inputs);
+  return true;
+}
+
+
 // Shared routine for multiple binary operations.
 template <typename Matcher>
 void VisitBinop(InstructionSelector* selector, Node* node,
@@ -126,6 +241,13 @@ void VisitBinop(InstructionSelector* selector, Node* node,
   InstructionOperand outputs[2];
   size_t output_count = 0;
 
+  if (cont->IsNone() && !g.CanBeImmediate(m.right().node(), operand_mode) &&
+      TryVisitBinopWithMemoryOperand(selector, node,
+                                     ArchOpcodeField::decode(opcode),
+                                     kInt20Imm)) {
+    return;
+  }
+
   inputs[input_count++] = g.UseRegister(m.left().node());
   inputs[input_count++] = g.UseOperand(m.right().node(), operand_mode);
 
@@ -157,6 +279,16 @@ void VisitBinop(InstructionSelector* selector, Node* node, ArchOpcode opcode,
   VisitBinop<Matcher>(selector, node, opcode, operand_mode, &cont);
 }
 
+
+// Shared routine for float64 binary operations. The RXE forms only take an
+// unsigned 12-bit displacement.
+void VisitFloat64Binop(InstructionSelector* selector, Node* node,
+                       ArchOpcode opcode) {
+  if (!TryVisitBinopWithMemoryOperand(selector, node, opcode, kUint12Imm)) {
+    VisitRRR(selector, opcode, node);
+  }
+}
+
 }  // namespace
 
 
@@ -413,6 +545,133 @@ void InstructionSelector::VisitCheckedStore(Node* node) {
 }
 
 
+namespace {
+
+#define S390_ATOMIC_OPCODES(Name)                            \
+  kS390_Atomic##Name##Int8, kS390_Atomic##Name##Uint8,       \
+      kS390_Atomic##Name##Int16, kS390_Atomic##Name##Uint16, \
+      kS390_Atomic##Name##Word32
+
+ArchOpcode AtomicOpcodeFor(MachineType type, ArchOpcode int8_op,
+                           ArchOpcode uint8_op, ArchOpcode int16_op,
+                           ArchOpcode uint16_op, ArchOpcode word32_op) {
+  if (type == MachineType::Int8()) return int8_op;
+  if (type == MachineType::Uint8()) return uint8_op;
+  if (type == MachineType::Int16()) return int16_op;
+  if (type == MachineType::Uint16()) return uint16_op;
+  DCHECK(type == MachineType::Int32() || type == MachineType::Uint32());
+  return word32_op;
+}
+
+
+// Shared routine for the read-modify-write atomic operations. The code
+// generator keeps the address in r1 and works in two temporaries, so all
+// inputs have to stay intact until the result is written.
+void VisitAtomicReadModifyWrite(InstructionSelector* selector, Node* node,
+                                ArchOpcode opcode) {
+  S390OperandGenerator g(selector);
+  InstructionOperand inputs[4];
+  size_t input_count = 0;
+  for (int k = 0; k < node->op()->ValueInputCount(); ++k) {
+    inputs[input_count++] = g.UseUniqueRegister(node->InputAt(k));
+  }
+  InstructionOperand outputs[] = {g.DefineAsRegister(node)};
+  InstructionOperand temps[] = {g.TempRegister(), g.TempRegister()};
+  selector->Emit(opcode | AddressingModeField::encode(kMode_MRR),
+                 arraysize(outputs), outputs, input_count, inputs,
+                 arraysize(temps), temps);
+}
+
+}  // namespace
+
+
+void InstructionSelector::VisitAtomicLoad(Node* node) {
+  S390OperandGenerator g(this);
+  Node* base = node->InputAt(0);
+  Node* index = node->InputAt(1);
+  ArchOpcode opcode = AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                      S390_ATOMIC_OPCODES(Load));
+  Emit(opcode | AddressingModeField::encode(kMode_MRR),
+       g.DefineAsRegister(node), g.UseRegister(base), g.UseRegister(index));
+}
+
+
+void InstructionSelector::VisitAtomicStore(Node* node) {
+  S390OperandGenerator g(this);
+  Node* base = node->InputAt(0);
+  Node* index = node->InputAt(1);
+  Node* value = node->InputAt(2);
+  ArchOpcode opcode = kArchNop;
+  switch (AtomicStoreRepresentationOf(node->op())) {
+    case MachineRepresentation::kWord8:
+      opcode = kS390_AtomicStoreWord8;
+      break;
+    case MachineRepresentation::kWord16:
+      opcode = kS390_AtomicStoreWord16;
+      break;
+    case MachineRepresentation::kWord32:
+      opcode = kS390_AtomicStoreWord32;
+      break;
+    default:
+      UNREACHABLE();
+      return;
+  }
+  Emit(opcode | AddressingModeField::encode(kMode_MRR), g.NoOutput(),
+       g.UseRegister(base), g.UseRegister(index), g.UseRegister(value));
+}
+
+
+void InstructionSelector::VisitAtomicExchange(Node* node) {
+  VisitAtomicReadModifyWrite(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  S390_ATOMIC_OPCODES(Exchange)));
+}
+
+
+void InstructionSelector::VisitAtomicCompareExchange(Node* node) {
+  VisitAtomicReadModifyWrite(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  S390_ATOMIC_OPCODES(CompareExchange)));
+}
+
+
+void InstructionSelector::VisitAtomicAdd(Node* node) {
+  VisitAtomicReadModifyWrite(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  S390_ATOMIC_OPCODES(Add)));
+}
+
+
+void InstructionSelector::VisitAtomicSub(Node* node) {
+  VisitAtomicReadModifyWrite(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  S390_ATOMIC_OPCODES(Sub)));
+}
+
+
+void InstructionSelector::VisitAtomicAnd(Node* node) {
+  VisitAtomicReadModifyWrite(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  S390_ATOMIC_OPCODES(And)));
+}
+
+
+void InstructionSelector::VisitAtomicOr(Node* node) {
+  VisitAtomicReadModifyWrite(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  S390_ATOMIC_OPCODES(Or)));
+}
+
+
+void InstructionSelector::VisitAtomicXor(Node* node) {
+  VisitAtomicReadModifyWrite(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  S390_ATOMIC_OPCODES(Xor)));
+}
+
+#undef S390_ATOMIC_OPCODES
+
+
 template <typename Matcher>
 static void VisitLogical(InstructionSelector* selector, Node* node, Matcher* m,
                          ArchOpcode opcode, bool left_can_cover,
@@ -422,9 +681,11 @@ static void VisitLogical(InstructionSelector* selector, Node* node, Matcher* m,
   // Map instruction to equivalent operation with inverted right input.
   ArchOpcode inv_opcode = opcode;
   switch (opcode) {
+    case kS390_And32:
     case kS390_And:
       inv_opcode = kS390_AndComplement;
       break;
+    case kS390_Or32:
     case kS390_Or:
       inv_opcode = kS390_OrComplement;
       break;
@@ -520,7 +781,7 @@ void InstructionSelector::VisitWord32And(Node* node) {
     }
   }
   VisitLogical<Int32BinopMatcher>(
-      this, node, &m, kS390_And, CanCover(node, m.left().node()),
+      this, node, &m, kS390_And32, CanCover(node, m.left().node()),
       CanCover(node, m.right().node()), kInt16Imm_Unsigned);
 }
 
@@ -586,7 +847,7 @@ void InstructionSelector::VisitWord64And(Node* node) {
 void InstructionSelector::VisitWord32Or(Node* node) {
   Int32BinopMatcher m(node);
   VisitLogical<Int32BinopMatcher>(
-      this, node, &m, kS390_Or, CanCover(node, m.left().node()),
+      this, node, &m, kS390_Or32, CanCover(node, m.left().node()),
       CanCover(node, m.right().node()), kInt16Imm_Unsigned);
 }
 
@@ -607,7 +868,7 @@ void InstructionSelector::VisitWord32Xor(Node* node) {
   if (m.right().Is(-1)) {
     Emit(kS390_Not, g.DefineAsRegister(node), g.UseRegister(m.left().node()));
   } else {
-    VisitBinop<Int32BinopMatcher>(this, node, kS390_Xor, kInt16Imm_Unsigned);
+    VisitBinop<Int32BinopMatcher>(this, node, kS390_Xor32, kInt16Imm_Unsigned);
   }
 }
 
@@ -854,7 +1115,7 @@ void InstructionSelector::VisitWord64ReverseBits(Node* node) { UNREACHABLE(); }
 
 
 void InstructionSelector::VisitInt32Add(Node* node) {
-  VisitBinop<Int32BinopMatcher>(this, node, kS390_Add, kInt16Imm);
+  VisitBinop<Int32BinopMatcher>(this, node, kS390_Add32, kInt16Imm);
 }
 
 
@@ -871,7 +1132,7 @@ void InstructionSelector::VisitInt32Sub(Node* node) {
   if (m.left().Is(0)) {
     Emit(kS390_Neg, g.DefineAsRegister(node), g.UseRegister(m.right().node()));
   } else {
-    VisitBinop<Int32BinopMatcher>(this, node, kS390_Sub, kInt16Imm_Negate);
+    VisitBinop<Int32BinopMatcher>(this, node, kS390_Sub32, kInt16Imm_Negate);
   }
 }
 
@@ -1117,7 +1378,7 @@ void InstructionSelector::VisitFloat32Add(Node* node) {
 
 void InstructionSelector::VisitFloat64Add(Node* node) {
   // TODO(mbrandy): detect multiply-add
-  VisitRRR(this, kS390_AddDouble, node);
+  VisitFloat64Binop(this, node, kS390_AddDouble);
 }
 
 
@@ -1155,7 +1416,7 @@ void InstructionSelector::VisitFloat64Sub(Node* node) {
          g.UseRegister(m.right().node()));
     return;
   }
-  VisitRRR(this, kS390_SubDouble, node);
+  VisitFloat64Binop(this, node, kS390_SubDouble);
 }
 
 
@@ -1166,7 +1427,7 @@ void InstructionSelector::VisitFloat32Mul(Node* node) {
 
 void InstructionSelector::VisitFloat64Mul(Node* node) {
   // TODO(mbrandy): detect negate
-  VisitRRR(this, kS390_MulDouble, node);
+  VisitFloat64Binop(this, node, kS390_MulDouble);
 }
 
 
@@ -1176,7 +1437,7 @@ void InstructionSelector::VisitFloat32Div(Node* node) {
 
 
 void InstructionSelector::VisitFloat64Div(Node* node) {
-  VisitRRR(this, kS390_DivDouble, node);
+  VisitFloat64Binop(this, node, kS390_DivDouble);
 }
 
 
@@ -1188,16 +1449,24 @@ void InstructionSelector::VisitFloat64Mod(Node* node) {
 }
 
 
-void InstructionSelector::VisitFloat32Max(Node* node) { UNREACHABLE(); }
+void InstructionSelector::VisitFloat32Max(Node* node) {
+  VisitRRR(this, kS390_MaxFloat, node);
+}
 
 
-void InstructionSelector::VisitFloat64Max(Node* node) { UNREACHABLE(); }
+void InstructionSelector::VisitFloat64Max(Node* node) {
+  VisitRRR(this, kS390_MaxDouble, node);
+}
 
 
-void InstructionSelector::VisitFloat32Min(Node* node) { UNREACHABLE(); }
+void InstructionSelector::VisitFloat32Min(Node* node) {
+  VisitRRR(this, kS390_MinFloat, node);
+}
 
 
-void InstructionSelector::VisitFloat64Min(Node* node) { UNREACHABLE(); }
+void InstructionSelector::VisitFloat64Min(Node* node) {
+  VisitRRR(this, kS390_MinDouble, node);
+}
 
 
 void InstructionSelector::VisitFloat32Abs(Node* node) {
@@ -1346,6 +1615,42 @@ void VisitCompare(InstructionSelector* selector, InstructionCode opcode,
 }
 
 
+// Emits the compare |opcode| with a load folded in as the right operand, if
+// |node| covers a suitable load.
+bool TryVisitCompareWithMemoryOperand(InstructionSelector* selector,
+                                      Node* node, InstructionCode opcode,
+                                      FlagsContinuation* cont,
+                                      bool commutative,
+                                      ImmediateMode displacement_mode) {
+  S390OperandGenerator g(selector);
+  MachineRepresentation rep =
+      GetMemoryOperandRepresentation(ArchOpcodeField::decode(opcode));
+  Node* left = node->InputAt(0);
+  Node* right = node->InputAt(1);
+  if (!g.CanBeMemoryOperand(node, right, rep)) {
+    if (!g.CanBeMemoryOperand(node, left, rep)) return false;
+    if (!commutative) cont->Commute();
+    std::swap(left, right);
+  }
+  InstructionOperand inputs[6];
+  size_t input_count = 0;
+  inputs[input_count++] = g.UseRegister(left);
+  AddressingMode mode = g.GenerateMemoryOperandInputs(
+      right, displacement_mode, inputs, &input_count);
+  opcode = cont->Encode(opcode) | AddressingModeField::encode(mode);
+  if (cont->IsBranch()) {
+    inputs[input_count++] = g.Label(cont->true_block());
+    inputs[input_count++] = g.Label(cont->false_block());
+    selector->Emit(opcode, 0, nullptr, input_count, inputs);
+  } else {
+    DCHECK(cont->IsSet());
+    InstructionOperand output = g.DefineAsRegister(cont->result());
+    selector->Emit(opcode, 1, &output, input_count, inputs);
+  }
+  return true;
+}
+
+
 // Shared routine for multiple word compare operations.
 void VisitWordCompare(InstructionSelector* selector, Node* node,
                       InstructionCode opcode, FlagsContinuation* cont,
@@ -1362,7 +1667,8 @@ void VisitWordCompare(InstructionSelector* selector, Node* node,
     if (!commutative) cont->Commute();
     VisitCompare(selector, opcode, g.UseRegister(right), g.UseImmediate(left),
                  cont);
-  } else {
+  } else if (!TryVisitCompareWithMemoryOperand(selector, node, opcode, cont,
+                                               commutative, kInt20Imm)) {
     VisitCompare(selector, opcode, g.UseRegister(left), g.UseRegister(right),
                  cont);
   }
@@ -1402,8 +1708,11 @@ void VisitFloat64Compare(InstructionSelector* selector, Node* node,
   S390OperandGenerator g(selector);
   Node* left = node->InputAt(0);
   Node* right = node->InputAt(1);
-  VisitCompare(selector, kS390_CmpDouble, g.UseRegister(left),
-               g.UseRegister(right), cont);
+  if (!TryVisitCompareWithMemoryOperand(selector, node, kS390_CmpDouble, cont,
+                                        false, kUint12Imm)) {
+    VisitCompare(selector, kS390_CmpDouble, g.UseRegister(left),
+                 g.UseRegister(right), cont);
+  }
 }
 
 
@@ -1803,7 +2112,11 @@ void InstructionSelector::VisitFloat64InsertHighWord32(Node* node) {
 // static
 MachineOperatorBuilder::Flags
 InstructionSelector::SupportedMachineOperatorFlags() {
-  return MachineOperatorBuilder::kFloat32RoundDown |
+  return MachineOperatorBuilder::kFloat32Max |
+         MachineOperatorBuilder::kFloat32Min |
+         MachineOperatorBuilder::kFloat64Max |
+         MachineOperatorBuilder::kFloat64Min |
+         MachineOperatorBuilder::kFloat32RoundDown |
          MachineOperatorBuilder::kFloat64RoundDown |
          MachineOperatorBuilder::kFloat32RoundUp |
          MachineOperatorBuilder::kFloat64RoundUp |
@@ -1811,7 +2124,8 @@ InstructionSelector::SupportedMachineOperatorFlags() {
          MachineOperatorBuilder::kFloat64RoundTruncate |
          MachineOperatorBuilder::kFloat64RoundTiesAway |
          MachineOperatorBuilder::kWord32Popcnt |
-         MachineOperatorBuilder::kWord64Popcnt;
+         MachineOperatorBuilder::kWord64Popcnt |
+         MachineOperatorBuilder::kWord32Atomics;
   // We omit kWord32ShiftIsSafe as s[rl]w use 0x3f as a mask rather than 0x1f.
 }
 
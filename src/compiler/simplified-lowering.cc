@@ -1279,6 +1279,40 @@ class RepresentationSelector {
         SetOutput(node, NodeOutputInfo::None());
         break;
       }
+      case IrOpcode::kAtomicLoad: {
+        MachineType rep = AtomicOpRepresentationOf(node->op());
+        ProcessInput(node, 0, UseInfo::PointerInt());  // base
+        ProcessInput(node, 1, UseInfo::PointerInt());  // index
+        ProcessRemainingInputs(node, 2);
+        SetOutputFromMachineType(node, rep);
+        break;
+      }
+      case IrOpcode::kAtomicStore: {
+        ProcessInput(node, 0, UseInfo::PointerInt());        // base
+        ProcessInput(node, 1, UseInfo::PointerInt());        // index
+        ProcessInput(node, 2, UseInfo::TruncatingWord32());  // value
+        ProcessRemainingInputs(node, 3);
+        SetOutput(node, NodeOutputInfo::None());
+        break;
+      }
+      case IrOpcode::kAtomicExchange:
+      case IrOpcode::kAtomicCompareExchange:
+      case IrOpcode::kAtomicAdd:
+      case IrOpcode::kAtomicSub:
+      case IrOpcode::kAtomicAnd:
+      case IrOpcode::kAtomicOr:
+      case IrOpcode::kAtomicXor: {
+        MachineType rep = AtomicOpRepresentationOf(node->op());
+        int value_input_count = node->op()->ValueInputCount();
+        ProcessInput(node, 0, UseInfo::PointerInt());  // base
+        ProcessInput(node, 1, UseInfo::PointerInt());  // index
+        for (int i = 2; i < value_input_count; i++) {
+          ProcessInput(node, i, UseInfo::TruncatingWord32());  // value(s)
+        }
+        ProcessRemainingInputs(node, value_input_count);
+        SetOutputFromMachineType(node, rep);
+        break;
+      }
       case IrOpcode::kWord32Shr:
         // We output unsigned int32 for shift right because JavaScript.
         return VisitBinop(node, UseInfo::TruncatingWord32(),
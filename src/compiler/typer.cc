@@ -2428,6 +2428,38 @@ Type* Typer::Visitor::TypeCheckedStore(Node* node) {
 }
 
 
+Type* Typer::Visitor::TypeAtomicLoad(Node* node) { return Type::Any(); }
+
+
+Type* Typer::Visitor::TypeAtomicStore(Node* node) {
+  UNREACHABLE();
+  return nullptr;
+}
+
+
+Type* Typer::Visitor::TypeAtomicExchange(Node* node) { return Type::Any(); }
+
+
+Type* Typer::Visitor::TypeAtomicCompareExchange(Node* node) {
+  return Type::Any();
+}
+
+
+Type* Typer::Visitor::TypeAtomicAdd(Node* node) { return Type::Any(); }
+
+
+Type* Typer::Visitor::TypeAtomicSub(Node* node) { return Type::Any(); }
+
+
+Type* Typer::Visitor::TypeAtomicAnd(Node* node) { return Type::Any(); }
+
+
+Type* Typer::Visitor::TypeAtomicOr(Node* node) { return Type::Any(); }
+
+
+Type* Typer::Visitor::TypeAtomicXor(Node* node) { return Type::Any(); }
+
+
 // Heap constants.
 
 
@@ -70,26 +70,6 @@ void MergeControlToEnd(JSGraph* jsgraph, Node* node) {
     g->SetEnd(g->NewNode(jsgraph->common()->End(1), node));
   }
 }
-
-
-enum TrapReason {
-  kTrapUnreachable,
-  kTrapMemOutOfBounds,
-  kTrapDivByZero,
-  kTrapDivUnrepresentable,
-  kTrapRemByZero,
-  kTrapFloatUnrepresentable,
-  kTrapFuncInvalid,
-  kTrapFuncSigMismatch,
-  kTrapCount
-};
-
-
-static const char* kTrapMessages[] = {
-    "unreachable",       "memory access out of bounds",
-    "divide by zero",    "divide result unrepresentable",
-    "remainder by zero", "integer result unrepresentable",
-    "invalid function",  "function signature mismatch"};
 }  // namespace
 
 
@@ -103,17 +83,17 @@ class WasmTrapHelper : public ZoneObject {
       : builder_(builder),
         jsgraph_(builder->jsgraph()),
         graph_(builder->jsgraph() ? builder->jsgraph()->graph() : nullptr) {
-    for (int i = 0; i < kTrapCount; i++) traps_[i] = nullptr;
+    for (int i = 0; i < wasm::kTrapCount; i++) traps_[i] = nullptr;
   }
 
   // Make the current control path trap to unreachable.
-  void Unreachable() { ConnectTrap(kTrapUnreachable); }
+  void Unreachable() { ConnectTrap(wasm::kTrapUnreachable); }
 
   // Always trap with the given reason.
-  void TrapAlways(TrapReason reason) { ConnectTrap(reason); }
+  void TrapAlways(wasm::TrapReason reason) { ConnectTrap(reason); }
 
   // Add a check that traps if {node} is equal to {val}.
-  Node* TrapIfEq32(TrapReason reason, Node* node, int32_t val) {
+  Node* TrapIfEq32(wasm::TrapReason reason, Node* node, int32_t val) {
     Int32Matcher m(node);
     if (m.HasValue() && !m.Is(val)) return graph()->start();
     if (val == 0) {
@@ -127,12 +107,12 @@ class WasmTrapHelper : public ZoneObject {
   }
 
   // Add a check that traps if {node} is zero.
-  Node* ZeroCheck32(TrapReason reason, Node* node) {
+  Node* ZeroCheck32(wasm::TrapReason reason, Node* node) {
     return TrapIfEq32(reason, node, 0);
   }
 
   // Add a check that traps if {node} is equal to {val}.
-  Node* TrapIfEq64(TrapReason reason, Node* node, int64_t val) {
+  Node* TrapIfEq64(wasm::TrapReason reason, Node* node, int64_t val) {
     Int64Matcher m(node);
     if (m.HasValue() && !m.Is(val)) return graph()->start();
     AddTrapIfTrue(reason,
@@ -142,22 +122,22 @@ class WasmTrapHelper : public ZoneObject {
   }
 
   // Add a check that traps if {node} is zero.
-  Node* ZeroCheck64(TrapReason reason, Node* node) {
+  Node* ZeroCheck64(wasm::TrapReason reason, Node* node) {
     return TrapIfEq64(reason, node, 0);
   }
 
   // Add a trap if {cond} is true.
-  void AddTrapIfTrue(TrapReason reason, Node* cond) {
+  void AddTrapIfTrue(wasm::TrapReason reason, Node* cond) {
     AddTrapIf(reason, cond, true);
   }
 
   // Add a trap if {cond} is false.
-  void AddTrapIfFalse(TrapReason reason, Node* cond) {
+  void AddTrapIfFalse(wasm::TrapReason reason, Node* cond) {
     AddTrapIf(reason, cond, false);
   }
 
   // Add a trap if {cond} is true or false according to {iftrue}.
-  void AddTrapIf(TrapReason reason, Node* cond, bool iftrue) {
+  void AddTrapIf(wasm::TrapReason reason, Node* cond, bool iftrue) {
     Node** effect_ptr = builder_->effect_;
     Node** control_ptr = builder_->control_;
     Node* before = *effect_ptr;
@@ -198,14 +178,14 @@ class WasmTrapHelper : public ZoneObject {
   WasmGraphBuilder* builder_;
   JSGraph* jsgraph_;
   Graph* graph_;
-  Node* traps_[kTrapCount];
-  Node* effects_[kTrapCount];
+  Node* traps_[wasm::kTrapCount];
+  Node* effects_[wasm::kTrapCount];
 
   JSGraph* jsgraph() { return jsgraph_; }
   Graph* graph() { return jsgraph_->graph(); }
   CommonOperatorBuilder* common() { return jsgraph()->common(); }
 
-  void ConnectTrap(TrapReason reason) {
+  void ConnectTrap(wasm::TrapReason reason) {
     if (traps_[reason] == nullptr) {
       // Create trap code for the first time this trap is used.
       return BuildTrapCode(reason);
@@ -215,8 +195,7 @@ class WasmTrapHelper : public ZoneObject {
     builder_->AppendToPhi(traps_[reason], effects_[reason], builder_->Effect());
   }
 
-  void BuildTrapCode(TrapReason reason) {
-    Node* exception = builder_->String(kTrapMessages[reason]);
+  void BuildTrapCode(wasm::TrapReason reason) {
     Node* end;
     Node** control_ptr = builder_->control_;
     Node** effect_ptr = builder_->effect_;
@@ -228,14 +207,16 @@ class WasmTrapHelper : public ZoneObject {
 
     if (module && !module->instance->context.is_null()) {
       // Use the module context to call the runtime to throw an exception.
-      Runtime::FunctionId f = Runtime::kThrow;
+      // The message is looked up by the runtime, so that no string has to be
+      // allocated while the graph is built.
+      Runtime::FunctionId f = Runtime::kThrowWasmError;
       const Runtime::Function* fun = Runtime::FunctionForId(f);
       CallDescriptor* desc = Linkage::GetRuntimeCallDescriptor(
           jsgraph()->zone(), f, fun->nargs, Operator::kNoProperties,
           CallDescriptor::kNoFlags);
       Node* inputs[] = {
           jsgraph()->CEntryStubConstant(fun->result_size),  // C entry
-          exception,                                        // exception
+          jsgraph()->SmiConstant(reason),                   // reason
           jsgraph()->ExternalConstant(
               ExternalReference(f, jsgraph()->isolate())),  // ref
           jsgraph()->Int32Constant(fun->nargs),             // arity
@@ -395,7 +376,7 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
       op = m->Int32Mul();
       break;
     case wasm::kExprI32DivS: {
-      trap_->ZeroCheck32(kTrapDivByZero, right);
+      trap_->ZeroCheck32(wasm::kTrapDivByZero, right);
       Node* before = *control_;
       Node* denom_is_m1;
       Node* denom_is_not_m1;
@@ -403,7 +384,7 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
                               jsgraph()->Int32Constant(-1)),
              &denom_is_m1, &denom_is_not_m1);
       *control_ = denom_is_m1;
-      trap_->TrapIfEq32(kTrapDivUnrepresentable, left, kMinInt);
+      trap_->TrapIfEq32(wasm::kTrapDivUnrepresentable, left, kMinInt);
       if (*control_ != denom_is_m1) {
         *control_ = graph()->NewNode(jsgraph()->common()->Merge(2),
                                      denom_is_not_m1, *control_);
@@ -415,9 +396,9 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
     case wasm::kExprI32DivU:
       op = m->Uint32Div();
       return graph()->NewNode(op, left, right,
-                              trap_->ZeroCheck32(kTrapDivByZero, right));
+                              trap_->ZeroCheck32(wasm::kTrapDivByZero, right));
     case wasm::kExprI32RemS: {
-      trap_->ZeroCheck32(kTrapRemByZero, right);
+      trap_->ZeroCheck32(wasm::kTrapRemByZero, right);
       Diamond d(graph(), jsgraph()->common(),
                 graph()->NewNode(jsgraph()->machine()->Word32Equal(), right,
                                  jsgraph()->Int32Constant(-1)));
@@ -430,7 +411,7 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
     case wasm::kExprI32RemU:
       op = m->Uint32Mod();
       return graph()->NewNode(op, left, right,
-                              trap_->ZeroCheck32(kTrapRemByZero, right));
+                              trap_->ZeroCheck32(wasm::kTrapRemByZero, right));
     case wasm::kExprI32And:
       op = m->Word32And();
       break;
@@ -498,7 +479,7 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
       op = m->Int64Mul();
       break;
     case wasm::kExprI64DivS: {
-      trap_->ZeroCheck64(kTrapDivByZero, right);
+      trap_->ZeroCheck64(wasm::kTrapDivByZero, right);
       Node* before = *control_;
       Node* denom_is_m1;
       Node* denom_is_not_m1;
@@ -506,7 +487,7 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
                               jsgraph()->Int64Constant(-1)),
              &denom_is_m1, &denom_is_not_m1);
       *control_ = denom_is_m1;
-      trap_->TrapIfEq64(kTrapDivUnrepresentable, left,
+      trap_->TrapIfEq64(wasm::kTrapDivUnrepresentable, left,
                         std::numeric_limits<int64_t>::min());
       if (*control_ != denom_is_m1) {
         *control_ = graph()->NewNode(jsgraph()->common()->Merge(2),
@@ -519,9 +500,9 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
     case wasm::kExprI64DivU:
       op = m->Uint64Div();
       return graph()->NewNode(op, left, right,
-                              trap_->ZeroCheck64(kTrapDivByZero, right));
+                              trap_->ZeroCheck64(wasm::kTrapDivByZero, right));
     case wasm::kExprI64RemS: {
-      trap_->ZeroCheck64(kTrapRemByZero, right);
+      trap_->ZeroCheck64(wasm::kTrapRemByZero, right);
       Diamond d(jsgraph()->graph(), jsgraph()->common(),
                 graph()->NewNode(jsgraph()->machine()->Word64Equal(), right,
                                  jsgraph()->Int64Constant(-1)));
@@ -534,7 +515,7 @@ Node* WasmGraphBuilder::Binop(wasm::WasmOpcode opcode, Node* left,
     case wasm::kExprI64RemU:
       op = m->Uint64Mod();
       return graph()->NewNode(op, left, right,
-                              trap_->ZeroCheck64(kTrapRemByZero, right));
+                              trap_->ZeroCheck64(wasm::kTrapRemByZero, right));
     case wasm::kExprI64Ior:
       op = m->Word64Or();
       break;
@@ -816,7 +797,7 @@ Node* WasmGraphBuilder::Unop(wasm::WasmOpcode opcode, Node* input) {
           graph()->NewNode(jsgraph()->common()->Projection(0), trunc);
       Node* overflow =
           graph()->NewNode(jsgraph()->common()->Projection(1), trunc);
-      trap_->ZeroCheck64(kTrapFloatUnrepresentable, overflow);
+      trap_->ZeroCheck64(wasm::kTrapFloatUnrepresentable, overflow);
       return result;
     }
     case wasm::kExprI64SConvertF64: {
@@ -825,7 +806,7 @@ Node* WasmGraphBuilder::Unop(wasm::WasmOpcode opcode, Node* input) {
           graph()->NewNode(jsgraph()->common()->Projection(0), trunc);
       Node* overflow =
           graph()->NewNode(jsgraph()->common()->Projection(1), trunc);
-      trap_->ZeroCheck64(kTrapFloatUnrepresentable, overflow);
+      trap_->ZeroCheck64(wasm::kTrapFloatUnrepresentable, overflow);
       return result;
     }
     case wasm::kExprI64UConvertF32: {
@@ -834,7 +815,7 @@ Node* WasmGraphBuilder::Unop(wasm::WasmOpcode opcode, Node* input) {
           graph()->NewNode(jsgraph()->common()->Projection(0), trunc);
       Node* overflow =
           graph()->NewNode(jsgraph()->common()->Projection(1), trunc);
-      trap_->ZeroCheck64(kTrapFloatUnrepresentable, overflow);
+      trap_->ZeroCheck64(wasm::kTrapFloatUnrepresentable, overflow);
       return result;
     }
     case wasm::kExprI64UConvertF64: {
@@ -843,7 +824,7 @@ Node* WasmGraphBuilder::Unop(wasm::WasmOpcode opcode, Node* input) {
           graph()->NewNode(jsgraph()->common()->Projection(0), trunc);
       Node* overflow =
           graph()->NewNode(jsgraph()->common()->Projection(1), trunc);
-      trap_->ZeroCheck64(kTrapFloatUnrepresentable, overflow);
+      trap_->ZeroCheck64(wasm::kTrapFloatUnrepresentable, overflow);
       return result;
     }
     case wasm::kExprF64ReinterpretI64:
@@ -1123,7 +1104,7 @@ Node* WasmGraphBuilder::BuildI32SConvertF32(Node* input) {
   // truncated input value, then there has been an overflow and we trap.
   Node* check = Unop(wasm::kExprF32SConvertI32, result);
   Node* overflow = Binop(wasm::kExprF32Ne, trunc, check);
-  trap_->AddTrapIfTrue(kTrapFloatUnrepresentable, overflow);
+  trap_->AddTrapIfTrue(wasm::kTrapFloatUnrepresentable, overflow);
 
   return result;
 }
@@ -1143,7 +1124,7 @@ Node* WasmGraphBuilder::BuildI32SConvertF64(Node* input) {
   // truncated input value, then there has been an overflow and we trap.
   Node* check = Unop(wasm::kExprF64SConvertI32, result);
   Node* overflow = Binop(wasm::kExprF64Ne, trunc, check);
-  trap_->AddTrapIfTrue(kTrapFloatUnrepresentable, overflow);
+  trap_->AddTrapIfTrue(wasm::kTrapFloatUnrepresentable, overflow);
 
   return result;
 }
@@ -1159,7 +1140,7 @@ Node* WasmGraphBuilder::BuildI32UConvertF32(Node* input) {
   // truncated input value, then there has been an overflow and we trap.
   Node* check = Unop(wasm::kExprF32UConvertI32, result);
   Node* overflow = Binop(wasm::kExprF32Ne, trunc, check);
-  trap_->AddTrapIfTrue(kTrapFloatUnrepresentable, overflow);
+  trap_->AddTrapIfTrue(wasm::kTrapFloatUnrepresentable, overflow);
 
   return result;
 }
@@ -1179,7 +1160,7 @@ Node* WasmGraphBuilder::BuildI32UConvertF64(Node* input) {
   // truncated input value, then there has been an overflow and we trap.
   Node* check = Unop(wasm::kExprF64UConvertI32, result);
   Node* overflow = Binop(wasm::kExprF64Ne, trunc, check);
-  trap_->AddTrapIfTrue(kTrapFloatUnrepresentable, overflow);
+  trap_->AddTrapIfTrue(wasm::kTrapFloatUnrepresentable, overflow);
 
   return result;
 }
@@ -1529,10 +1510,10 @@ Node* WasmGraphBuilder::CallIndirect(uint32_t index, Node** args) {
     // Bounds check against the table size.
     Node* size = Int32Constant(static_cast<int>(table_size));
     Node* in_bounds = graph()->NewNode(machine->Uint32LessThan(), key, size);
-    trap_->AddTrapIfFalse(kTrapFuncInvalid, in_bounds);
+    trap_->AddTrapIfFalse(wasm::kTrapFuncInvalid, in_bounds);
   } else {
     // No function table. Generate a trap and return a constant.
-    trap_->AddTrapIfFalse(kTrapFuncInvalid, Int32Constant(0));
+    trap_->AddTrapIfFalse(wasm::kTrapFuncInvalid, Int32Constant(0));
     return trap_->GetTrapValue(module_->GetSignature(index));
   }
   Node* table = FunctionTable();
@@ -1552,7 +1533,7 @@ Node* WasmGraphBuilder::CallIndirect(uint32_t index, Node** args) {
         *effect_, *control_);
     Node* sig_match = graph()->NewNode(machine->WordEqual(), load_sig,
                                        jsgraph()->SmiConstant(index));
-    trap_->AddTrapIfFalse(kTrapFuncSigMismatch, sig_match);
+    trap_->AddTrapIfFalse(wasm::kTrapFuncSigMismatch, sig_match);
   }
 
   // Load code object from the table.
@@ -1842,7 +1823,7 @@ void WasmGraphBuilder::BoundsCheckMem(MachineType memtype, Node* index,
         jsgraph()->Int32Constant(static_cast<uint32_t>(limit)));
   }
 
-  trap_->AddTrapIfFalse(kTrapMemOutOfBounds, cond);
+  trap_->AddTrapIfFalse(wasm::kTrapMemOutOfBounds, cond);
 }
 
 
@@ -2123,60 +2104,38 @@ Handle<Code> CompileWasmToJSWrapper(Isolate* isolate, wasm::ModuleEnv* module,
 }
 
 
-// Helper function to compile a single function.
-Handle<Code> CompileWasmFunction(wasm::ErrorThrower& thrower, Isolate* isolate,
-                                 wasm::ModuleEnv* module_env,
-                                 const wasm::WasmFunction& function) {
+WasmCompilationUnit::WasmCompilationUnit(wasm::ErrorThrower* thrower,
+                                         Isolate* isolate,
+                                         wasm::ModuleEnv* module_env,
+                                         const wasm::WasmFunction* function)
+    : thrower_(thrower),
+      module_env_(module_env),
+      function_(function),
+      jsgraph_(nullptr),
+      info_(nullptr),
+      job_(nullptr),
+      ok_(false) {
   if (FLAG_trace_wasm_compiler || FLAG_trace_wasm_decode_time) {
     OFStream os(stdout);
     os << "Compiling WASM function "
-       << wasm::WasmFunctionName(&function, module_env) << std::endl;
+       << wasm::WasmFunctionName(function, module_env) << std::endl;
     os << std::endl;
   }
-  // Initialize the function environment for decoding.
-  wasm::FunctionEnv env;
-  env.module = module_env;
-  env.sig = function.sig;
-  env.local_i32_count = function.local_i32_count;
-  env.local_i64_count = function.local_i64_count;
-  env.local_f32_count = function.local_f32_count;
-  env.local_f64_count = function.local_f64_count;
-  env.SumLocals();
-
-  // Create a TF graph during decoding.
-  Zone zone;
-  Graph graph(&zone);
-  CommonOperatorBuilder common(&zone);
-  MachineOperatorBuilder machine(
-      &zone, MachineType::PointerRepresentation(),
+  Graph* graph = new (&zone_) Graph(&zone_);
+  CommonOperatorBuilder* common = new (&zone_) CommonOperatorBuilder(&zone_);
+  MachineOperatorBuilder* machine = new (&zone_) MachineOperatorBuilder(
+      &zone_, MachineType::PointerRepresentation(),
       InstructionSelector::SupportedMachineOperatorFlags());
-  JSGraph jsgraph(isolate, &graph, &common, nullptr, nullptr, &machine);
-  WasmGraphBuilder builder(&zone, &jsgraph, function.sig);
-  wasm::TreeResult result = wasm::BuildTFGraph(
-      &builder, &env,                                                 // --
-      module_env->module->module_start,                               // --
-      module_env->module->module_start + function.code_start_offset,  // --
-      module_env->module->module_start + function.code_end_offset);   // --
-
-  if (result.failed()) {
-    if (FLAG_trace_wasm_compiler) {
-      OFStream os(stdout);
-      os << "Compilation failed: " << result << std::endl;
-    }
-    // Add the function as another context for the exception
-    ScopedVector<char> buffer(128);
-    SNPrintF(buffer, "Compiling WASM function #%d:%s failed:",
-             function.func_index,
-             module_env->module->GetName(function.name_offset));
-    thrower.Failed(buffer.start(), result);
-    return Handle<Code>::null();
-  }
+  jsgraph_ = new (&zone_)
+      JSGraph(isolate, graph, common, nullptr, nullptr, machine);
+  // Looking up the C entry stub creates handles, so do it upfront for the
+  // runtime calls in trap code.
+  jsgraph_->CEntryStubConstant(1);
 
-  // Run the compiler pipeline to generate machine code.
   CallDescriptor* descriptor =
-      module_env->GetWasmCallDescriptor(&zone, function.sig);
+      module_env->GetWasmCallDescriptor(&zone_, function->sig);
   if (kPointerSize == 4) {
-    descriptor = module_env->GetI32WasmCallDescriptor(&zone, descriptor);
+    descriptor = module_env->GetI32WasmCallDescriptor(&zone_, descriptor);
   }
   Code::Flags flags = Code::ComputeFlags(Code::WASM_FUNCTION);
   // add flags here if a meaningful name is helpful for debugging.
@@ -2187,30 +2146,94 @@ Handle<Code> CompileWasmFunction(wasm::ErrorThrower& thrower, Isolate* isolate,
       FLAG_print_opt_code || FLAG_trace_turbo || FLAG_trace_turbo_graph;
 #endif
   const char* func_name = "wasm";
-  Vector<char> buffer;
   if (debugging) {
-    buffer = Vector<char>::New(128);
-    SNPrintF(buffer, "WASM_function_#%d:%s", function.func_index,
-             module_env->module->GetName(function.name_offset));
-    func_name = buffer.start();
+    ScopedVector<char> buffer(128);
+    SNPrintF(buffer, "WASM_function_#%d:%s", function->func_index,
+             module_env->module->GetName(function->name_offset));
+    debug_name_ = buffer.start();
+    func_name = debug_name_.c_str();
   }
-  CompilationInfo info(func_name, isolate, &zone, flags);
+  info_ = new CompilationInfo(func_name, isolate, &zone_, flags);
+  job_ = new MachineGraphCompilationJob(info_, descriptor, graph);
+}
 
-  Handle<Code> code =
-      Pipeline::GenerateCodeForTesting(&info, descriptor, &graph);
-  if (debugging) {
-    buffer.Dispose();
+
+WasmCompilationUnit::~WasmCompilationUnit() {
+  delete job_;
+  delete info_;
+}
+
+
+void WasmCompilationUnit::ExecuteCompilation() {
+  // Nothing in here may touch the heap, this can run on a background thread.
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+
+  // Initialize the function environment for decoding.
+  wasm::FunctionEnv env;
+  env.module = module_env_;
+  env.sig = function_->sig;
+  env.local_i32_count = function_->local_i32_count;
+  env.local_i64_count = function_->local_i64_count;
+  env.local_f32_count = function_->local_f32_count;
+  env.local_f64_count = function_->local_f64_count;
+  env.SumLocals();
+
+  // Create a TF graph during decoding.
+  const byte* module_start = module_env_->module->module_start;
+  WasmGraphBuilder builder(&zone_, jsgraph_, function_->sig);
+  wasm::TreeResult result = wasm::BuildTFGraph(
+      &builder, &env,                               // --
+      module_start,                                 // --
+      module_start + function_->code_start_offset,  // --
+      module_start + function_->code_end_offset);   // --
+
+  if (result.failed()) {
+    if (FLAG_trace_wasm_compiler) {
+      OFStream os(stdout);
+      os << "Compilation failed: " << result << std::endl;
+    }
+    // Add the function as another context for the exception
+    std::ostringstream error;
+    error << "Compiling WASM function #" << function_->func_index << ":"
+          << module_env_->module->GetName(function_->name_offset)
+          << " failed:" << result;
+    error_message_ = error.str();
+    return;
+  }
+
+  // Run the compiler pipeline up to code generation.
+  ok_ = job_->Execute();
+}
+
+
+Handle<Code> WasmCompilationUnit::FinishCompilation() {
+  if (!error_message_.empty()) {
+    thrower_->Error("%s", error_message_.c_str());
+    return Handle<Code>::null();
   }
+  if (!ok_) return Handle<Code>::null();
+
+  Handle<Code> code = job_->Finalize();
   if (!code.is_null()) {
     RecordFunctionCompilation(
-        Logger::FUNCTION_TAG, &info, "WASM_function", function.func_index,
-        module_env->module->GetName(function.name_offset));
+        Logger::FUNCTION_TAG, info_, "WASM_function", function_->func_index,
+        module_env_->module->GetName(function_->name_offset));
   }
-
   return code;
 }
 
 
+// Helper function to compile a single function.
+Handle<Code> CompileWasmFunction(wasm::ErrorThrower& thrower, Isolate* isolate,
+                                 wasm::ModuleEnv* module_env,
+                                 const wasm::WasmFunction& function) {
+  WasmCompilationUnit unit(&thrower, isolate, module_env, &function);
+  unit.ExecuteCompilation();
+  return unit.FinishCompilation();
+}
+
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -7,17 +7,22 @@
 
 // Clients of this interface shouldn't depend on lots of compiler internals.
 // Do not include anything from src/compiler here!
+#include <string>
+
 #include "src/wasm/wasm-opcodes.h"
 #include "src/zone.h"
 
 namespace v8 {
 namespace internal {
 
+class CompilationInfo;
+
 namespace compiler {
 // Forward declarations for some compiler data structures.
 class Node;
 class JSGraph;
 class Graph;
+class MachineGraphCompilationJob;
 }
 
 namespace wasm {
@@ -32,6 +37,41 @@ typedef compiler::JSGraph TFGraph;
 }
 
 namespace compiler {
+// Compiles a single function in three steps, so that the expensive part can
+// run on a background thread:
+//  * the constructor sets up the compilation on the main thread,
+//  * {ExecuteCompilation} builds, optimizes and schedules the TurboFan graph
+//    and allocates registers. It does not touch the heap and may run on any
+//    thread, as long as the main thread does not allocate in the meantime.
+//  * {FinishCompilation} generates the code object on the main thread and
+//    reports errors to the thrower.
+class WasmCompilationUnit final {
+ public:
+  WasmCompilationUnit(wasm::ErrorThrower* thrower, Isolate* isolate,
+                      wasm::ModuleEnv* module_env,
+                      const wasm::WasmFunction* function);
+  ~WasmCompilationUnit();
+
+  void ExecuteCompilation();
+  Handle<Code> FinishCompilation();
+
+  const wasm::WasmFunction* function() const { return function_; }
+
+ private:
+  wasm::ErrorThrower* thrower_;
+  wasm::ModuleEnv* module_env_;
+  const wasm::WasmFunction* function_;
+  Zone zone_;
+  JSGraph* jsgraph_;
+  CompilationInfo* info_;
+  MachineGraphCompilationJob* job_;
+  std::string debug_name_;
+  std::string error_message_;
+  bool ok_;
+
+  DISALLOW_COPY_AND_ASSIGN(WasmCompilationUnit);
+};
+
 // Compiles a single function, producing a code object.
 Handle<Code> CompileWasmFunction(wasm::ErrorThrower& thrower, Isolate* isolate,
                                  wasm::ModuleEnv* module_env,
@@ -599,6 +599,69 @@ class OutOfLineRecordWrite final : public OutOfLineCode {
     }                                                            \
   } while (false)
 
+// Atomic operations take the value operand(s) first, followed by the memory
+// operand. x64 is TSO, so plain loads already have sequentially consistent
+// semantics given that every atomic store is an (implicitly locked) xchg.
+#define ASSEMBLE_ATOMIC_LOAD(load_instr)                  \
+  do {                                                    \
+    __ load_instr(i.OutputRegister(), i.MemoryOperand()); \
+  } while (false)
+
+#define ASSEMBLE_ATOMIC_STORE(xchg_instr)                 \
+  do {                                                    \
+    __ movl(i.TempRegister(0), i.InputRegister(0));       \
+    __ xchg_instr(i.TempRegister(0), i.MemoryOperand(1)); \
+  } while (false)
+
+#define ASSEMBLE_ATOMIC_EXCHANGE(xchg_instr)               \
+  do {                                                     \
+    __ xchg_instr(i.OutputRegister(), i.MemoryOperand(1)); \
+  } while (false)
+
+#define ASSEMBLE_ATOMIC_COMPARE_EXCHANGE(cmpxchg_instr)       \
+  do {                                                        \
+    DCHECK(i.OutputRegister().is(rax));                       \
+    __ lock();                                                \
+    __ cmpxchg_instr(i.MemoryOperand(2), i.InputRegister(1)); \
+  } while (false)
+
+#define ASSEMBLE_ATOMIC_ADD(xadd_instr)                    \
+  do {                                                     \
+    __ lock();                                             \
+    __ xadd_instr(i.MemoryOperand(1), i.OutputRegister()); \
+  } while (false)
+
+#define ASSEMBLE_ATOMIC_SUB(xadd_instr)                    \
+  do {                                                     \
+    __ negl(i.OutputRegister());                           \
+    __ lock();                                             \
+    __ xadd_instr(i.MemoryOperand(1), i.OutputRegister()); \
+  } while (false)
+
+// There is no instruction that returns the previous value for and, or and
+// xor, so these retry a lock cmpxchg until no other thread interfered.
+#define ASSEMBLE_ATOMIC_LOGIC_OP(load_instr, bin_instr, cmpxchg_instr) \
+  do {                                                                 \
+    Label binop;                                                       \
+    DCHECK(i.OutputRegister().is(rax));                                \
+    __ load_instr(rax, i.MemoryOperand(1));                            \
+    __ bind(&binop);                                                   \
+    __ movl(i.TempRegister(0), rax);                                   \
+    __ bin_instr(i.TempRegister(0), i.InputRegister(0));               \
+    __ lock();                                                         \
+    __ cmpxchg_instr(i.MemoryOperand(1), i.TempRegister(0));           \
+    __ j(not_equal, &binop);                                           \
+  } while (false)
+
+// Sign or zero extends the previous value of an 8 or 16 bit location.
+#define ASSEMBLE_ATOMIC_RESULT_INT8() \
+  __ movsxbl(i.OutputRegister(), i.OutputRegister())
+#define ASSEMBLE_ATOMIC_RESULT_UINT8() \
+  __ movzxbl(i.OutputRegister(), i.OutputRegister())
+#define ASSEMBLE_ATOMIC_RESULT_INT16() \
+  __ movsxwl(i.OutputRegister(), i.OutputRegister())
+#define ASSEMBLE_ATOMIC_RESULT_UINT16() \
+  __ movzxwl(i.OutputRegister(), i.OutputRegister())
 
 void CodeGenerator::AssembleDeconstructActivationRecord(int stack_param_delta) {
   int sp_slot_delta = TailCallFrameStackSlotDelta(stack_param_delta);
@@ -1693,6 +1756,163 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
     case kCheckedStoreFloat64:
       ASSEMBLE_CHECKED_STORE_FLOAT(Movsd);
       break;
+    case kX64AtomicLoadInt8:
+      ASSEMBLE_ATOMIC_LOAD(movsxbl);
+      break;
+    case kX64AtomicLoadUint8:
+      ASSEMBLE_ATOMIC_LOAD(movzxbl);
+      break;
+    case kX64AtomicLoadInt16:
+      ASSEMBLE_ATOMIC_LOAD(movsxwl);
+      break;
+    case kX64AtomicLoadUint16:
+      ASSEMBLE_ATOMIC_LOAD(movzxwl);
+      break;
+    case kX64AtomicLoadWord32:
+      ASSEMBLE_ATOMIC_LOAD(movl);
+      break;
+    case kX64AtomicStoreWord8:
+      ASSEMBLE_ATOMIC_STORE(xchgb);
+      break;
+    case kX64AtomicStoreWord16:
+      ASSEMBLE_ATOMIC_STORE(xchgw);
+      break;
+    case kX64AtomicStoreWord32:
+      ASSEMBLE_ATOMIC_STORE(xchgl);
+      break;
+    case kX64AtomicExchangeInt8:
+      ASSEMBLE_ATOMIC_EXCHANGE(xchgb);
+      ASSEMBLE_ATOMIC_RESULT_INT8();
+      break;
+    case kX64AtomicExchangeUint8:
+      ASSEMBLE_ATOMIC_EXCHANGE(xchgb);
+      ASSEMBLE_ATOMIC_RESULT_UINT8();
+      break;
+    case kX64AtomicExchangeInt16:
+      ASSEMBLE_ATOMIC_EXCHANGE(xchgw);
+      ASSEMBLE_ATOMIC_RESULT_INT16();
+      break;
+    case kX64AtomicExchangeUint16:
+      ASSEMBLE_ATOMIC_EXCHANGE(xchgw);
+      ASSEMBLE_ATOMIC_RESULT_UINT16();
+      break;
+    case kX64AtomicExchangeWord32:
+      ASSEMBLE_ATOMIC_EXCHANGE(xchgl);
+      break;
+    case kX64AtomicCompareExchangeInt8:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE(cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_INT8();
+      break;
+    case kX64AtomicCompareExchangeUint8:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE(cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_UINT8();
+      break;
+    case kX64AtomicCompareExchangeInt16:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE(cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_INT16();
+      break;
+    case kX64AtomicCompareExchangeUint16:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE(cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_UINT16();
+      break;
+    case kX64AtomicCompareExchangeWord32:
+      ASSEMBLE_ATOMIC_COMPARE_EXCHANGE(cmpxchgl);
+      break;
+    case kX64AtomicAddInt8:
+      ASSEMBLE_ATOMIC_ADD(xaddb);
+      ASSEMBLE_ATOMIC_RESULT_INT8();
+      break;
+    case kX64AtomicAddUint8:
+      ASSEMBLE_ATOMIC_ADD(xaddb);
+      ASSEMBLE_ATOMIC_RESULT_UINT8();
+      break;
+    case kX64AtomicAddInt16:
+      ASSEMBLE_ATOMIC_ADD(xaddw);
+      ASSEMBLE_ATOMIC_RESULT_INT16();
+      break;
+    case kX64AtomicAddUint16:
+      ASSEMBLE_ATOMIC_ADD(xaddw);
+      ASSEMBLE_ATOMIC_RESULT_UINT16();
+      break;
+    case kX64AtomicAddWord32:
+      ASSEMBLE_ATOMIC_ADD(xaddl);
+      break;
+    case kX64AtomicSubInt8:
+      ASSEMBLE_ATOMIC_SUB(xaddb);
+      ASSEMBLE_ATOMIC_RESULT_INT8();
+      break;
+    case kX64AtomicSubUint8:
+      ASSEMBLE_ATOMIC_SUB(xaddb);
+      ASSEMBLE_ATOMIC_RESULT_UINT8();
+      break;
+    case kX64AtomicSubInt16:
+      ASSEMBLE_ATOMIC_SUB(xaddw);
+      ASSEMBLE_ATOMIC_RESULT_INT16();
+      break;
+    case kX64AtomicSubUint16:
+      ASSEMBLE_ATOMIC_SUB(xaddw);
+      ASSEMBLE_ATOMIC_RESULT_UINT16();
+      break;
+    case kX64AtomicSubWord32:
+      ASSEMBLE_ATOMIC_SUB(xaddl);
+      break;
+    case kX64AtomicAndInt8:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movsxbl, andl, cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_INT8();
+      break;
+    case kX64AtomicAndUint8:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movzxbl, andl, cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_UINT8();
+      break;
+    case kX64AtomicAndInt16:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movsxwl, andl, cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_INT16();
+      break;
+    case kX64AtomicAndUint16:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movzxwl, andl, cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_UINT16();
+      break;
+    case kX64AtomicAndWord32:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movl, andl, cmpxchgl);
+      break;
+    case kX64AtomicOrInt8:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movsxbl, orl, cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_INT8();
+      break;
+    case kX64AtomicOrUint8:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movzxbl, orl, cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_UINT8();
+      break;
+    case kX64AtomicOrInt16:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movsxwl, orl, cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_INT16();
+      break;
+    case kX64AtomicOrUint16:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movzxwl, orl, cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_UINT16();
+      break;
+    case kX64AtomicOrWord32:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movl, orl, cmpxchgl);
+      break;
+    case kX64AtomicXorInt8:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movsxbl, xorl, cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_INT8();
+      break;
+    case kX64AtomicXorUint8:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movzxbl, xorl, cmpxchgb);
+      ASSEMBLE_ATOMIC_RESULT_UINT8();
+      break;
+    case kX64AtomicXorInt16:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movsxwl, xorl, cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_INT16();
+      break;
+    case kX64AtomicXorUint16:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movzxwl, xorl, cmpxchgw);
+      ASSEMBLE_ATOMIC_RESULT_UINT16();
+      break;
+    case kX64AtomicXorWord32:
+      ASSEMBLE_ATOMIC_LOGIC_OP(movl, xorl, cmpxchgl);
+      break;
     case kX64StackCheck:
       __ CompareRoot(rsp, Heap::kStackLimitRootIndex);
       break;
@@ -11,133 +11,176 @@ namespace compiler {
 
 // X64-specific opcodes that specify which assembly sequence to emit.
 // Most opcodes specify a single instruction.
-#define TARGET_ARCH_OPCODE_LIST(V) \
-  V(X64Add)                        \
-  V(X64Add32)                      \
-  V(X64And)                        \
-  V(X64And32)                      \
-  V(X64Cmp)                        \
-  V(X64Cmp32)                      \
-  V(X64Test)                       \
-  V(X64Test32)                     \
-  V(X64Or)                         \
-  V(X64Or32)                       \
-  V(X64Xor)                        \
-  V(X64Xor32)                      \
-  V(X64Sub)                        \
-  V(X64Sub32)                      \
-  V(X64Imul)                       \
-  V(X64Imul32)                     \
-  V(X64ImulHigh32)                 \
-  V(X64UmulHigh32)                 \
-  V(X64Idiv)                       \
-  V(X64Idiv32)                     \
-  V(X64Udiv)                       \
-  V(X64Udiv32)                     \
-  V(X64Not)                        \
-  V(X64Not32)                      \
-  V(X64Neg)                        \
-  V(X64Neg32)                      \
-  V(X64Shl)                        \
-  V(X64Shl32)                      \
-  V(X64Shr)                        \
-  V(X64Shr32)                      \
-  V(X64Sar)                        \
-  V(X64Sar32)                      \
-  V(X64Ror)                        \
-  V(X64Ror32)                      \
-  V(X64Lzcnt)                      \
-  V(X64Lzcnt32)                    \
-  V(X64Tzcnt)                      \
-  V(X64Tzcnt32)                    \
-  V(X64Popcnt)                     \
-  V(X64Popcnt32)                   \
-  V(SSEFloat32Cmp)                 \
-  V(SSEFloat32Add)                 \
-  V(SSEFloat32Sub)                 \
-  V(SSEFloat32Mul)                 \
-  V(SSEFloat32Div)                 \
-  V(SSEFloat32Abs)                 \
-  V(SSEFloat32Neg)                 \
-  V(SSEFloat32Sqrt)                \
-  V(SSEFloat32Max)                 \
-  V(SSEFloat32Min)                 \
-  V(SSEFloat32ToFloat64)           \
-  V(SSEFloat32ToInt32)             \
-  V(SSEFloat32ToUint32)            \
-  V(SSEFloat32Round)               \
-  V(SSEFloat64Cmp)                 \
-  V(SSEFloat64Add)                 \
-  V(SSEFloat64Sub)                 \
-  V(SSEFloat64Mul)                 \
-  V(SSEFloat64Div)                 \
-  V(SSEFloat64Mod)                 \
-  V(SSEFloat64Abs)                 \
-  V(SSEFloat64Neg)                 \
-  V(SSEFloat64Sqrt)                \
-  V(SSEFloat64Round)               \
-  V(SSEFloat64Max)                 \
-  V(SSEFloat64Min)                 \
-  V(SSEFloat64ToFloat32)           \
-  V(SSEFloat64ToInt32)             \
-  V(SSEFloat64ToUint32)            \
-  V(SSEFloat32ToInt64)             \
-  V(SSEFloat64ToInt64)             \
-  V(SSEFloat32ToUint64)            \
-  V(SSEFloat64ToUint64)            \
-  V(SSEInt32ToFloat64)             \
-  V(SSEInt32ToFloat32)             \
-  V(SSEInt64ToFloat32)             \
-  V(SSEInt64ToFloat64)             \
-  V(SSEUint64ToFloat32)            \
-  V(SSEUint64ToFloat64)            \
-  V(SSEUint32ToFloat64)            \
-  V(SSEUint32ToFloat32)            \
-  V(SSEFloat64ExtractLowWord32)    \
-  V(SSEFloat64ExtractHighWord32)   \
-  V(SSEFloat64InsertLowWord32)     \
-  V(SSEFloat64InsertHighWord32)    \
-  V(SSEFloat64LoadLowWord32)       \
-  V(AVXFloat32Cmp)                 \
-  V(AVXFloat32Add)                 \
-  V(AVXFloat32Sub)                 \
-  V(AVXFloat32Mul)                 \
-  V(AVXFloat32Div)                 \
-  V(AVXFloat32Max)                 \
-  V(AVXFloat32Min)                 \
-  V(AVXFloat64Cmp)                 \
-  V(AVXFloat64Add)                 \
-  V(AVXFloat64Sub)                 \
-  V(AVXFloat64Mul)                 \
-  V(AVXFloat64Div)                 \
-  V(AVXFloat64Max)                 \
-  V(AVXFloat64Min)                 \
-  V(AVXFloat64Abs)                 \
-  V(AVXFloat64Neg)                 \
-  V(AVXFloat32Abs)                 \
-  V(AVXFloat32Neg)                 \
-  V(X64Movsxbl)                    \
-  V(X64Movzxbl)                    \
-  V(X64Movb)                       \
-  V(X64Movsxwl)                    \
-  V(X64Movzxwl)                    \
-  V(X64Movw)                       \
-  V(X64Movl)                       \
-  V(X64Movsxlq)                    \
-  V(X64Movq)                       \
-  V(X64Movsd)                      \
-  V(X64Movss)                      \
-  V(X64BitcastFI)                  \
-  V(X64BitcastDL)                  \
-  V(X64BitcastIF)                  \
-  V(X64BitcastLD)                  \
-  V(X64Lea32)                      \
-  V(X64Lea)                        \
-  V(X64Dec32)                      \
-  V(X64Inc32)                      \
-  V(X64Push)                       \
-  V(X64Poke)                       \
-  V(X64StackCheck)
+#define TARGET_ARCH_OPCODE_LIST(V)  \
+  V(X64Add)                         \
+  V(X64Add32)                       \
+  V(X64And)                         \
+  V(X64And32)                       \
+  V(X64Cmp)                         \
+  V(X64Cmp32)                       \
+  V(X64Test)                        \
+  V(X64Test32)                      \
+  V(X64Or)                          \
+  V(X64Or32)                        \
+  V(X64Xor)                         \
+  V(X64Xor32)                       \
+  V(X64Sub)                         \
+  V(X64Sub32)                       \
+  V(X64Imul)                        \
+  V(X64Imul32)                      \
+  V(X64ImulHigh32)                  \
+  V(X64UmulHigh32)                  \
+  V(X64Idiv)                        \
+  V(X64Idiv32)                      \
+  V(X64Udiv)                        \
+  V(X64Udiv32)                      \
+  V(X64Not)                         \
+  V(X64Not32)                       \
+  V(X64Neg)                         \
+  V(X64Neg32)                       \
+  V(X64Shl)                         \
+  V(X64Shl32)                       \
+  V(X64Shr)                         \
+  V(X64Shr32)                       \
+  V(X64Sar)                         \
+  V(X64Sar32)                       \
+  V(X64Ror)                         \
+  V(X64Ror32)                       \
+  V(X64Lzcnt)                       \
+  V(X64Lzcnt32)                     \
+  V(X64Tzcnt)                       \
+  V(X64Tzcnt32)                     \
+  V(X64Popcnt)                      \
+  V(X64Popcnt32)                    \
+  V(SSEFloat32Cmp)                  \
+  V(SSEFloat32Add)                  \
+  V(SSEFloat32Sub)                  \
+  V(SSEFloat32Mul)                  \
+  V(SSEFloat32Div)                  \
+  V(SSEFloat32Abs)                  \
+  V(SSEFloat32Neg)                  \
+  V(SSEFloat32Sqrt)                 \
+  V(SSEFloat32Max)                  \
+  V(SSEFloat32Min)                  \
+  V(SSEFloat32ToFloat64)            \
+  V(SSEFloat32ToInt32)              \
+  V(SSEFloat32ToUint32)             \
+  V(SSEFloat32Round)                \
+  V(SSEFloat64Cmp)                  \
+  V(SSEFloat64Add)                  \
+  V(SSEFloat64Sub)                  \
+  V(SSEFloat64Mul)                  \
+  V(SSEFloat64Div)                  \
+  V(SSEFloat64Mod)                  \
+  V(SSEFloat64Abs)                  \
+  V(SSEFloat64Neg)                  \
+  V(SSEFloat64Sqrt)                 \
+  V(SSEFloat64Round)                \
+  V(SSEFloat64Max)                  \
+  V(SSEFloat64Min)                  \
+  V(SSEFloat64ToFloat32)            \
+  V(SSEFloat64ToInt32)              \
+  V(SSEFloat64ToUint32)             \
+  V(SSEFloat32ToInt64)              \
+  V(SSEFloat64ToInt64)              \
+  V(SSEFloat32ToUint64)             \
+  V(SSEFloat64ToUint64)             \
+  V(SSEInt32ToFloat64)              \
+  V(SSEInt32ToFloat32)              \
+  V(SSEInt64ToFloat32)              \
+  V(SSEInt64ToFloat64)              \
+  V(SSEUint64ToFloat32)             \
+  V(SSEUint64ToFloat64)             \
+  V(SSEUint32ToFloat64)             \
+  V(SSEUint32ToFloat32)             \
+  V(SSEFloat64ExtractLowWord32)     \
+  V(SSEFloat64ExtractHighWord32)    \
+  V(SSEFloat64InsertLowWord32)      \
+  V(SSEFloat64InsertHighWord32)     \
+  V(SSEFloat64LoadLowWord32)        \
+  V(AVXFloat32Cmp)                  \
+  V(AVXFloat32Add)                  \
+  V(AVXFloat32Sub)                  \
+  V(AVXFloat32Mul)                  \
+  V(AVXFloat32Div)                  \
+  V(AVXFloat32Max)                  \
+  V(AVXFloat32Min)                  \
+  V(AVXFloat64Cmp)                  \
+  V(AVXFloat64Add)                  \
+  V(AVXFloat64Sub)                  \
+  V(AVXFloat64Mul)                  \
+  V(AVXFloat64Div)                  \
+  V(AVXFloat64Max)                  \
+  V(AVXFloat64Min)                  \
+  V(AVXFloat64Abs)                  \
+  V(AVXFloat64Neg)                  \
+  V(AVXFloat32Abs)                  \
+  V(AVXFloat32Neg)                  \
+  V(X64Movsxbl)                     \
+  V(X64Movzxbl)                     \
+  V(X64Movb)                        \
+  V(X64Movsxwl)                     \
+  V(X64Movzxwl)                     \
+  V(X64Movw)                        \
+  V(X64Movl)                        \
+  V(X64Movsxlq)                     \
+  V(X64Movq)                        \
+  V(X64Movsd)                       \
+  V(X64Movss)                       \
+  V(X64BitcastFI)                   \
+  V(X64BitcastDL)                   \
+  V(X64BitcastIF)                   \
+  V(X64BitcastLD)                   \
+  V(X64Lea32)                       \
+  V(X64Lea)                         \
+  V(X64Dec32)                       \
+  V(X64Inc32)                       \
+  V(X64Push)                        \
+  V(X64Poke)                        \
+  V(X64StackCheck)                  \
+  V(X64AtomicLoadInt8)              \
+  V(X64AtomicLoadUint8)             \
+  V(X64AtomicLoadInt16)             \
+  V(X64AtomicLoadUint16)            \
+  V(X64AtomicLoadWord32)            \
+  V(X64AtomicStoreWord8)            \
+  V(X64AtomicStoreWord16)           \
+  V(X64AtomicStoreWord32)           \
+  V(X64AtomicExchangeInt8)          \
+  V(X64AtomicExchangeUint8)         \
+  V(X64AtomicExchangeInt16)         \
+  V(X64AtomicExchangeUint16)        \
+  V(X64AtomicExchangeWord32)        \
+  V(X64AtomicCompareExchangeInt8)   \
+  V(X64AtomicCompareExchangeUint8)  \
+  V(X64AtomicCompareExchangeInt16)  \
+  V(X64AtomicCompareExchangeUint16) \
+  V(X64AtomicCompareExchangeWord32) \
+  V(X64AtomicAddInt8)               \
+  V(X64AtomicAddUint8)              \
+  V(X64AtomicAddInt16)              \
+  V(X64AtomicAddUint16)             \
+  V(X64AtomicAddWord32)             \
+  V(X64AtomicSubInt8)               \
+  V(X64AtomicSubUint8)              \
+  V(X64AtomicSubInt16)              \
+  V(X64AtomicSubUint16)             \
+  V(X64AtomicSubWord32)             \
+  V(X64AtomicAndInt8)               \
+  V(X64AtomicAndUint8)              \
+  V(X64AtomicAndInt16)              \
+  V(X64AtomicAndUint16)             \
+  V(X64AtomicAndWord32)             \
+  V(X64AtomicOrInt8)                \
+  V(X64AtomicOrUint8)               \
+  V(X64AtomicOrInt16)               \
+  V(X64AtomicOrUint16)              \
+  V(X64AtomicOrWord32)              \
+  V(X64AtomicXorInt8)               \
+  V(X64AtomicXorUint8)              \
+  V(X64AtomicXorInt16)              \
+  V(X64AtomicXorUint16)             \
+  V(X64AtomicXorWord32)
 
 
 // Addressing modes represent the "shape" of inputs to an instruction.
@@ -164,6 +164,52 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Poke:
       return kHasSideEffect;
 
+    case kX64AtomicLoadInt8:
+    case kX64AtomicLoadUint8:
+    case kX64AtomicLoadInt16:
+    case kX64AtomicLoadUint16:
+    case kX64AtomicLoadWord32:
+    case kX64AtomicStoreWord8:
+    case kX64AtomicStoreWord16:
+    case kX64AtomicStoreWord32:
+    case kX64AtomicExchangeInt8:
+    case kX64AtomicExchangeUint8:
+    case kX64AtomicExchangeInt16:
+    case kX64AtomicExchangeUint16:
+    case kX64AtomicExchangeWord32:
+    case kX64AtomicCompareExchangeInt8:
+    case kX64AtomicCompareExchangeUint8:
+    case kX64AtomicCompareExchangeInt16:
+    case kX64AtomicCompareExchangeUint16:
+    case kX64AtomicCompareExchangeWord32:
+    case kX64AtomicAddInt8:
+    case kX64AtomicAddUint8:
+    case kX64AtomicAddInt16:
+    case kX64AtomicAddUint16:
+    case kX64AtomicAddWord32:
+    case kX64AtomicSubInt8:
+    case kX64AtomicSubUint8:
+    case kX64AtomicSubInt16:
+    case kX64AtomicSubUint16:
+    case kX64AtomicSubWord32:
+    case kX64AtomicAndInt8:
+    case kX64AtomicAndUint8:
+    case kX64AtomicAndInt16:
+    case kX64AtomicAndUint16:
+    case kX64AtomicAndWord32:
+    case kX64AtomicOrInt8:
+    case kX64AtomicOrUint8:
+    case kX64AtomicOrInt16:
+    case kX64AtomicOrUint16:
+    case kX64AtomicOrWord32:
+    case kX64AtomicXorInt8:
+    case kX64AtomicXorUint8:
+    case kX64AtomicXorInt16:
+    case kX64AtomicXorUint16:
+    case kX64AtomicXorWord32:
+      // Atomic operations order all other memory accesses around them.
+      return kHasSideEffect;
+
 #define CASE(Name) case k##Name:
     COMMON_ARCH_OPCODE_LIST(CASE)
 #undef CASE
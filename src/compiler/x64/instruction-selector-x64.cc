@@ -348,6 +348,162 @@ void InstructionSelector::VisitCheckedStore(Node* node) {
 }
 
 
+namespace {
+
+#define X64_ATOMIC_OPCODES(Name)                         \
+  kX64Atomic##Name##Int8, kX64Atomic##Name##Uint8,       \
+      kX64Atomic##Name##Int16, kX64Atomic##Name##Uint16, \
+      kX64Atomic##Name##Word32
+
+ArchOpcode AtomicOpcodeFor(MachineType type, ArchOpcode int8_op,
+                           ArchOpcode uint8_op, ArchOpcode int16_op,
+                           ArchOpcode uint16_op, ArchOpcode word32_op) {
+  if (type == MachineType::Int8()) return int8_op;
+  if (type == MachineType::Uint8()) return uint8_op;
+  if (type == MachineType::Int16()) return int16_op;
+  if (type == MachineType::Uint16()) return uint16_op;
+  DCHECK(type == MachineType::Int32() || type == MachineType::Uint32());
+  return word32_op;
+}
+
+
+// Shared routine for atomic operations that leave the previous value of the
+// memory location in the register that held the operand (xchg and xadd).
+void VisitAtomicExchangeOrAdd(InstructionSelector* selector, Node* node,
+                              ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  Node* base = node->InputAt(0);
+  Node* index = node->InputAt(1);
+  Node* value = node->InputAt(2);
+  selector->Emit(opcode | AddressingModeField::encode(kMode_MR1),
+                 g.DefineSameAsFirst(node), g.UseRegister(value),
+                 g.UseUniqueRegister(base), g.UseUniqueRegister(index));
+}
+
+
+// Shared routine for atomic operations that are implemented as a
+// lock cmpxchg loop, which leaves the previous value in rax.
+void VisitAtomicLogicOp(InstructionSelector* selector, Node* node,
+                        ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  Node* base = node->InputAt(0);
+  Node* index = node->InputAt(1);
+  Node* value = node->InputAt(2);
+  InstructionOperand outputs[] = {g.DefineAsFixed(node, rax)};
+  InstructionOperand inputs[] = {g.UseUniqueRegister(value),
+                                 g.UseUniqueRegister(base),
+                                 g.UseUniqueRegister(index)};
+  InstructionOperand temps[] = {g.TempRegister()};
+  selector->Emit(opcode | AddressingModeField::encode(kMode_MR1),
+                 arraysize(outputs), outputs, arraysize(inputs), inputs,
+                 arraysize(temps), temps);
+}
+
+}  // namespace
+
+
+void InstructionSelector::VisitAtomicLoad(Node* node) {
+  X64OperandGenerator g(this);
+  Node* base = node->InputAt(0);
+  Node* index = node->InputAt(1);
+  ArchOpcode opcode = AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                      X64_ATOMIC_OPCODES(Load));
+  Emit(opcode | AddressingModeField::encode(kMode_MR1),
+       g.DefineAsRegister(node), g.UseRegister(base), g.UseRegister(index));
+}
+
+
+void InstructionSelector::VisitAtomicStore(Node* node) {
+  X64OperandGenerator g(this);
+  Node* base = node->InputAt(0);
+  Node* index = node->InputAt(1);
+  Node* value = node->InputAt(2);
+  ArchOpcode opcode = kArchNop;
+  switch (AtomicStoreRepresentationOf(node->op())) {
+    case MachineRepresentation::kWord8:
+      opcode = kX64AtomicStoreWord8;
+      break;
+    case MachineRepresentation::kWord16:
+      opcode = kX64AtomicStoreWord16;
+      break;
+    case MachineRepresentation::kWord32:
+      opcode = kX64AtomicStoreWord32;
+      break;
+    default:
+      UNREACHABLE();
+      return;
+  }
+  // The store is an xchg, which clobbers the register holding the value.
+  InstructionOperand inputs[] = {g.UseUniqueRegister(value),
+                                 g.UseUniqueRegister(base),
+                                 g.UseUniqueRegister(index)};
+  InstructionOperand temps[] = {g.TempRegister()};
+  Emit(opcode | AddressingModeField::encode(kMode_MR1), 0, nullptr,
+       arraysize(inputs), inputs, arraysize(temps), temps);
+}
+
+
+void InstructionSelector::VisitAtomicExchange(Node* node) {
+  VisitAtomicExchangeOrAdd(
+      this, node, AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                  X64_ATOMIC_OPCODES(Exchange)));
+}
+
+
+void InstructionSelector::VisitAtomicCompareExchange(Node* node) {
+  X64OperandGenerator g(this);
+  Node* base = node->InputAt(0);
+  Node* index = node->InputAt(1);
+  Node* old_value = node->InputAt(2);
+  Node* new_value = node->InputAt(3);
+  ArchOpcode opcode = AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                      X64_ATOMIC_OPCODES(CompareExchange));
+  InstructionOperand outputs[] = {g.DefineAsFixed(node, rax)};
+  InstructionOperand inputs[] = {
+      g.UseFixed(old_value, rax), g.UseUniqueRegister(new_value),
+      g.UseUniqueRegister(base), g.UseUniqueRegister(index)};
+  Emit(opcode | AddressingModeField::encode(kMode_MR1), arraysize(outputs),
+       outputs, arraysize(inputs), inputs);
+}
+
+
+void InstructionSelector::VisitAtomicAdd(Node* node) {
+  VisitAtomicExchangeOrAdd(this, node,
+                           AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                           X64_ATOMIC_OPCODES(Add)));
+}
+
+
+void InstructionSelector::VisitAtomicSub(Node* node) {
+  VisitAtomicExchangeOrAdd(this, node,
+                           AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                           X64_ATOMIC_OPCODES(Sub)));
+}
+
+
+void InstructionSelector::VisitAtomicAnd(Node* node) {
+  VisitAtomicLogicOp(this, node,
+                     AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                     X64_ATOMIC_OPCODES(And)));
+}
+
+
+void InstructionSelector::VisitAtomicOr(Node* node) {
+  VisitAtomicLogicOp(this, node,
+                     AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                     X64_ATOMIC_OPCODES(Or)));
+}
+
+
+void InstructionSelector::VisitAtomicXor(Node* node) {
+  VisitAtomicLogicOp(this, node,
+                     AtomicOpcodeFor(AtomicOpRepresentationOf(node->op()),
+                                     X64_ATOMIC_OPCODES(Xor)));
+}
+
+#undef X64_ATOMIC_OPCODES
+
+
 // Shared routine for multiple binary operations.
 static void VisitBinop(InstructionSelector* selector, Node* node,
                        InstructionCode opcode, FlagsContinuation* cont) {
@@ -1879,7 +2035,8 @@ InstructionSelector::SupportedMachineOperatorFlags() {
       MachineOperatorBuilder::kFloat64Max |
       MachineOperatorBuilder::kFloat64Min |
       MachineOperatorBuilder::kWord32ShiftIsSafe |
-      MachineOperatorBuilder::kWord32Ctz | MachineOperatorBuilder::kWord64Ctz;
+      MachineOperatorBuilder::kWord32Ctz | MachineOperatorBuilder::kWord64Ctz |
+      MachineOperatorBuilder::kWord32Atomics;
   if (CpuFeatures::IsSupported(POPCNT)) {
     flags |= MachineOperatorBuilder::kWord32Popcnt |
              MachineOperatorBuilder::kWord64Popcnt;
@@ -602,7 +602,11 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(pc_to_code, V8.PcToCode)                                         \
   SC(pc_to_code_cached, V8.PcToCodeCached)                            \
   /* The store-buffer implementation of the write barrier. */         \
-  SC(store_buffer_overflows, V8.StoreBufferOverflows)
+  SC(store_buffer_overflows, V8.StoreBufferOverflows)                 \
+  /* Zone segments served by the segment pool and by malloc. */       \
+  SC(zone_segments_pooled, V8.ZoneSegmentsPooled)                     \
+  SC(zone_segments_fresh, V8.ZoneSegmentsFresh)                       \
+  SC(zone_segment_pool_size, V8.ZoneSegmentPoolSize)
 
 
 #define STATS_COUNTER_LIST_2(SC)                                               \
@@ -2142,6 +2142,53 @@ void LCodeGen::EmitBranch(InstrType instr, Condition cond, CRegister cr) {
 }
 
 
+template <class InstrType>
+void LCodeGen::EmitCompareAndBranch(InstrType instr, Condition cond,
+                                    Register left, const Operand& right,
+                                    bool is_unsigned, bool is_pointer_size) {
+  int left_block = instr->TrueDestination(chunk_);
+  int right_block = instr->FalseDestination(chunk_);
+
+  int next_block = GetNextEmittedBlock();
+
+  if (right_block == left_block || cond == al) {
+    EmitGoto(left_block);
+    return;
+  }
+  int target_block = left_block;
+  if (left_block == next_block) {
+    target_block = right_block;
+    cond = NegateCondition(cond);
+  }
+  Label* target = chunk_->GetAssemblyLabel(target_block);
+  if (right.is_reg()) {
+    if (is_pointer_size) {
+      if (is_unsigned) {
+        __ CmpLogicalAndBranchP(cond, left, right.rm(), target);
+      } else {
+        __ CmpAndBranchP(cond, left, right.rm(), target);
+      }
+    } else {
+      if (is_unsigned) {
+        __ CmpLogicalAndBranch32(cond, left, right.rm(), target);
+      } else {
+        __ CmpAndBranch32(cond, left, right.rm(), target);
+      }
+    }
+  } else {
+    DCHECK(!is_pointer_size);
+    if (is_unsigned) {
+      __ CmpLogicalAndBranch32(cond, left, right, target);
+    } else {
+      __ CmpAndBranch32(cond, left, right, target);
+    }
+  }
+  if (left_block != next_block && right_block != next_block) {
+    __ b(chunk_->GetAssemblyLabel(right_block));
+  }
+}
+
+
 template <class InstrType>
 void LCodeGen::EmitTrueBranch(InstrType instr, Condition cond, CRegister cr) {
   int true_block = instr->TrueDestination(chunk_);
@@ -2380,50 +2427,37 @@ void LCodeGen::DoCompareNumericAndBranch(LCompareNumericAndBranch* instr) {
       // jump to false block label.
       __ bunordered(instr->FalseLabel(chunk_));
     } else {
+      bool is_smi = instr->hydrogen_value()->representation().IsSmi();
       if (right->IsConstantOperand()) {
+        if (!is_smi) {
+          EmitCompareAndBranch(instr, cond, ToRegister(left), ToOperand(right),
+                               is_unsigned, false);
+          return;
+        }
         int32_t value = ToInteger32(LConstantOperand::cast(right));
-        if (instr->hydrogen_value()->representation().IsSmi()) {
-          if (is_unsigned) {
-            __ CmpLogicalSmiLiteral(ToRegister(left), Smi::FromInt(value), r0);
-          } else {
-            __ CmpSmiLiteral(ToRegister(left), Smi::FromInt(value), r0);
-          }
+        if (is_unsigned) {
+          __ CmpLogicalSmiLiteral(ToRegister(left), Smi::FromInt(value), r0);
         } else {
-          if (is_unsigned) {
-            __ CmpLogical32(ToRegister(left), ToOperand(right));
-          } else {
-            __ Cmp32(ToRegister(left), ToOperand(right));
-          }
+          __ CmpSmiLiteral(ToRegister(left), Smi::FromInt(value), r0);
         }
       } else if (left->IsConstantOperand()) {
-        int32_t value = ToInteger32(LConstantOperand::cast(left));
-        if (instr->hydrogen_value()->representation().IsSmi()) {
-          if (is_unsigned) {
-            __ CmpLogicalSmiLiteral(ToRegister(right), Smi::FromInt(value), r0);
-          } else {
-            __ CmpSmiLiteral(ToRegister(right), Smi::FromInt(value), r0);
-          }
-        } else {
-          if (is_unsigned) {
-            __ CmpLogical32(ToRegister(right), ToOperand(left));
-          } else {
-          __ Cmp32(ToRegister(right), ToOperand(left));
-          }
-        }
-        // We commuted the operands, so commute the condition.
+        // We commute the operands, so commute the condition.
         cond = CommuteCondition(cond);
-      } else if (instr->hydrogen_value()->representation().IsSmi()) {
-        if (is_unsigned) {
-          __ CmpLogicalP(ToRegister(left), ToRegister(right));
-        } else {
-        __ CmpP(ToRegister(left), ToRegister(right));
+        if (!is_smi) {
+          EmitCompareAndBranch(instr, cond, ToRegister(right), ToOperand(left),
+                               is_unsigned, false);
+          return;
         }
-      } else {
+        int32_t value = ToInteger32(LConstantOperand::cast(left));
         if (is_unsigned) {
-          __ CmpLogical32(ToRegister(left), ToRegister(right));
+          __ CmpLogicalSmiLiteral(ToRegister(right), Smi::FromInt(value), r0);
         } else {
-        __ Cmp32(ToRegister(left), ToRegister(right));
+          __ CmpSmiLiteral(ToRegister(right), Smi::FromInt(value), r0);
         }
+      } else {
+        EmitCompareAndBranch(instr, cond, ToRegister(left),
+                             Operand(ToRegister(right)), is_unsigned, is_smi);
+        return;
       }
     }
     EmitBranch(instr, cond);
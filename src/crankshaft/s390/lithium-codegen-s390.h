@@ -246,6 +246,12 @@ class LCodeGen : public LCodeGenBase {
   // EmitBranch expects to be the last instruction of a block.
   template <class InstrType>
   void EmitBranch(InstrType instr, Condition condition, CRegister cr = cr7);
+  // Emits the integer compare of |left| and |right| together with the branch,
+  // so that branches to bound labels can use compare and branch relative.
+  template <class InstrType>
+  void EmitCompareAndBranch(InstrType instr, Condition condition,
+                            Register left, const Operand& right,
+                            bool is_unsigned, bool is_pointer_size);
   template <class InstrType>
   void EmitTrueBranch(InstrType instr, Condition condition, CRegister cr = cr7);
   template <class InstrType>
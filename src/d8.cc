@@ -8,6 +8,7 @@
 #define V8_SHARED
 #endif
 
+#include <ctype.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -22,6 +23,8 @@
 #include <vector>
 #endif  // !V8_SHARED
 
+#include <fstream>
+
 #ifdef V8_SHARED
 #include "include/v8-testing.h"
 #endif  // V8_SHARED
@@ -163,6 +166,8 @@ class PredictablePlatform : public Platform {
 
 
 v8::Platform* g_platform = NULL;
+// Owned by g_platform. Set while tracing is enabled.
+v8::platform::tracing::TracingController* g_tracing_controller = NULL;
 
 
 static Local<Value> Throw(Isolate* isolate, const char* message) {
@@ -256,6 +261,12 @@ base::LazyMutex Shell::workers_mutex_;
 bool Shell::allow_new_workers_ = true;
 i::List<Worker*> Shell::workers_;
 i::List<SharedArrayBuffer::Contents> Shell::externalized_shared_contents_;
+base::LazyMutex Shell::code_cache_mutex_;
+int Shell::code_cache_hits_ = 0;
+int Shell::code_cache_misses_ = 0;
+int Shell::code_cache_rejects_ = 0;
+base::TimeDelta Shell::code_cache_deserialize_time_;
+base::TimeDelta Shell::code_cache_compile_time_;
 #endif  // !V8_SHARED
 
 Global<Context> Shell::evaluation_context_;
@@ -330,10 +341,20 @@ ScriptCompiler::CachedData* CompileForCachedData(
 }
 
 
-// Compile a string within the current v8 context.
+// Compile a string within the current v8 context. Only scripts read from
+// files use --code-cache-dir, and only if --cache does not ask for another
+// kind of cached data.
 MaybeLocal<Script> Shell::CompileString(
     Isolate* isolate, Local<String> source, Local<Value> name,
-    ScriptCompiler::CompileOptions compile_options, SourceType source_type) {
+    ScriptCompiler::CompileOptions compile_options, SourceType source_type,
+    bool from_file) {
+#ifndef V8_SHARED
+  if (options.code_cache_dir != NULL && from_file && source_type == SCRIPT &&
+      compile_options == ScriptCompiler::kNoCompileOptions &&
+      name->IsString()) {
+    return CompileWithCodeCacheDir(isolate, source, name.As<String>());
+  }
+#endif  // !V8_SHARED
   Local<Context> context(isolate->GetCurrentContext());
   ScriptOrigin origin(name);
   if (compile_options == ScriptCompiler::kNoCompileOptions) {
@@ -369,7 +390,8 @@ MaybeLocal<Script> Shell::CompileString(
 // Executes a string within the current v8 context.
 bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
                           Local<Value> name, bool print_result,
-                          bool report_exceptions, SourceType source_type) {
+                          bool report_exceptions, SourceType source_type,
+                          bool from_file) {
   HandleScope handle_scope(isolate);
   TryCatch try_catch(isolate);
   try_catch.SetVerbose(true);
@@ -382,7 +404,7 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
     Context::Scope context_scope(realm);
     Local<Script> script;
     if (!Shell::CompileString(isolate, source, name, options.compile_options,
-                              source_type).ToLocal(&script)) {
+                              source_type, from_file).ToLocal(&script)) {
       // Print errors that happened during compilation.
       if (report_exceptions) ReportException(isolate, &try_catch);
       return false;
@@ -498,6 +520,107 @@ void Shell::PerformanceNow(const v8::FunctionCallbackInfo<v8::Value>& args) {
     args.GetReturnValue().Set(delta.InMillisecondsF());
   }
 }
+
+
+// A JSON string being parsed by BackgroundJSON.start(). The task tokenizing
+// it runs on a platform background thread and signals when it is done.
+class BackgroundJSONJob {
+ public:
+  BackgroundJSONJob() : done_(0), tokenized_(false) {}
+
+  JSON::BackgroundSource* source() { return &source_; }
+  Global<External>* handle() { return &handle_; }
+
+  void Signal() { done_.Signal(); }
+  void Wait() {
+    if (!tokenized_) {
+      done_.Wait();
+      tokenized_ = true;
+    }
+  }
+
+ private:
+  JSON::BackgroundSource source_;
+  Global<External> handle_;
+  base::Semaphore done_;
+  bool tokenized_;
+};
+
+
+class BackgroundJSONTask : public Task {
+ public:
+  BackgroundJSONTask(JSON::ParsingTask* task, BackgroundJSONJob* job)
+      : task_(task), job_(job) {}
+  virtual ~BackgroundJSONTask() { delete task_; }
+
+  void Run() override {
+    task_->Run();
+    job_->Signal();
+  }
+
+ private:
+  JSON::ParsingTask* task_;
+  BackgroundJSONJob* job_;
+};
+
+
+static void BackgroundJSONJobDelete(
+    const v8::WeakCallbackInfo<BackgroundJSONJob>& data) {
+  BackgroundJSONJob* job = data.GetParameter();
+  // The task may still be using the source.
+  job->Wait();
+  delete job;
+}
+
+
+static void BackgroundJSONJobWeakCallback(
+    const v8::WeakCallbackInfo<BackgroundJSONJob>& data) {
+  data.GetParameter()->handle()->Reset();
+  data.SetSecondPassCallback(BackgroundJSONJobDelete);
+}
+
+
+// BackgroundJSON.start(string) starts tokenizing a JSON string on a
+// background thread and returns a job for BackgroundJSON.finish().
+void Shell::BackgroundJSONStart(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  HandleScope handle_scope(isolate);
+  if (args.Length() < 1 || !args[0]->IsString()) {
+    Throw(isolate, "BackgroundJSON.start() requires a string");
+    return;
+  }
+  BackgroundJSONJob* job = new BackgroundJSONJob();
+  JSON::ParsingTask* task =
+      JSON::StartParsing(isolate, Local<String>::Cast(args[0]), job->source());
+  g_platform->CallOnBackgroundThread(new BackgroundJSONTask(task, job),
+                                     v8::Platform::kShortRunningTask);
+  Local<External> result = External::New(isolate, job);
+  job->handle()->Reset(isolate, result);
+  job->handle()->SetWeak(job, BackgroundJSONJobWeakCallback,
+                         v8::WeakCallbackType::kParameter);
+  args.GetReturnValue().Set(result);
+}
+
+
+// BackgroundJSON.finish(job) waits for the tokenizer and creates the value,
+// or throws the SyntaxError it found. Calling it again on the same job only
+// repeats the main thread part of the work.
+void Shell::BackgroundJSONFinish(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  if (args.Length() < 1 || !args[0]->IsExternal()) {
+    Throw(isolate, "BackgroundJSON.finish() requires a job");
+    return;
+  }
+  BackgroundJSONJob* job = static_cast<BackgroundJSONJob*>(
+      Local<External>::Cast(args[0])->Value());
+  job->Wait();
+  Local<Value> result;
+  if (JSON::FinishParsing(isolate, job->source()).ToLocal(&result)) {
+    args.GetReturnValue().Set(result);
+  }
+}
 #endif  // !V8_SHARED
 
 
@@ -745,7 +868,7 @@ void Shell::Load(const v8::FunctionCallbackInfo<v8::Value>& args) {
             args.GetIsolate(), source,
             String::NewFromUtf8(args.GetIsolate(), *file,
                                 NewStringType::kNormal).ToLocalChecked(),
-            false, true)) {
+            false, true, SCRIPT, true)) {
       Throw(args.GetIsolate(), "Error executing file");
       return;
     }
@@ -1205,6 +1328,21 @@ Local<ObjectTemplate> Shell::CreateGlobalTemplate(Isolate* isolate) {
           .ToLocalChecked(),
       performance_template);
 
+  Local<ObjectTemplate> background_json_template =
+      ObjectTemplate::New(isolate);
+  background_json_template->Set(
+      String::NewFromUtf8(isolate, "start", NewStringType::kNormal)
+          .ToLocalChecked(),
+      FunctionTemplate::New(isolate, BackgroundJSONStart));
+  background_json_template->Set(
+      String::NewFromUtf8(isolate, "finish", NewStringType::kNormal)
+          .ToLocalChecked(),
+      FunctionTemplate::New(isolate, BackgroundJSONFinish));
+  global_template->Set(
+      String::NewFromUtf8(isolate, "BackgroundJSON", NewStringType::kNormal)
+          .ToLocalChecked(),
+      background_json_template);
+
   Local<FunctionTemplate> worker_fun_template =
       FunctionTemplate::New(isolate, WorkerNew);
   Local<Signature> worker_signature =
@@ -1319,7 +1457,12 @@ inline bool operator<(const CounterAndKey& lhs, const CounterAndKey& rhs) {
 
 
 void Shell::OnExit(v8::Isolate* isolate) {
+  if (g_tracing_controller != NULL) {
+    g_tracing_controller->StopTracing();
+    g_tracing_controller = NULL;
+  }
 #ifndef V8_SHARED
+  if (options.code_cache_dir != NULL) PrintCodeCacheStats();
   reinterpret_cast<i::Isolate*>(isolate)->DumpAndResetCompilationStats();
   if (i::FLAG_dump_counters) {
     int number_of_counters = 0;
@@ -1405,6 +1548,108 @@ static char* ReadChars(Isolate* isolate, const char* name, int* size_out) {
 }
 
 
+#ifndef V8_SHARED
+// Returns the file in --code-cache-dir that holds the code cache of a script.
+// The source hash in the file name keeps edited scripts from picking up stale
+// caches; the deserializer checks the version and the flags.
+static std::string CodeCacheFileName(Local<String> source,
+                                     Local<String> name) {
+  std::string file_name(Shell::options.code_cache_dir);
+  file_name += '/';
+  String::Utf8Value name_utf8(name);
+  for (const char* p = *name_utf8; p != NULL && *p != '\0'; p++) {
+    file_name += isalnum(static_cast<unsigned char>(*p)) ? *p : '_';
+  }
+  // FNV-1a over the UTF-16 code units of the source.
+  uint32_t hash = 2166136261u;
+  const int kChunkSize = 1024;
+  uint16_t chunk[kChunkSize];
+  for (int start = 0; start < source->Length(); start += kChunkSize) {
+    int length =
+        source->Write(chunk, start, kChunkSize, String::NO_NULL_TERMINATION);
+    for (int i = 0; i < length; i++) {
+      hash = (hash ^ chunk[i]) * 16777619u;
+    }
+  }
+  char suffix[32];
+  base::OS::SNPrintF(suffix, sizeof(suffix), "-%08x.cache", hash);
+  return file_name + suffix;
+}
+
+
+// Consumes the code cache of the script if there is a valid one, and writes a
+// new one otherwise.
+MaybeLocal<Script> Shell::CompileWithCodeCacheDir(Isolate* isolate,
+                                                  Local<String> source,
+                                                  Local<String> name) {
+  Local<Context> context(isolate->GetCurrentContext());
+  ScriptOrigin origin(name);
+  std::string file_name = CodeCacheFileName(source, name);
+  MaybeLocal<Script> result;
+  base::ElapsedTimer timer;
+
+  int size = 0;
+  char* chars = ReadChars(isolate, file_name.c_str(), &size);
+  if (chars != NULL) {
+    uint8_t* buffer = new uint8_t[size];
+    memcpy(buffer, chars, size);
+    delete[] chars;
+    ScriptCompiler::CachedData* data = new ScriptCompiler::CachedData(
+        buffer, size, ScriptCompiler::CachedData::BufferOwned);
+    ScriptCompiler::Source cached_source(source, origin, data);
+    timer.Start();
+    result = ScriptCompiler::Compile(context, &cached_source,
+                                     ScriptCompiler::kConsumeCodeCache);
+    base::TimeDelta elapsed = timer.Elapsed();
+    base::LockGuard<base::Mutex> lock_guard(code_cache_mutex_.Pointer());
+    if (!data->rejected) {
+      code_cache_hits_++;
+      code_cache_deserialize_time_ += elapsed;
+      return result;
+    }
+    // The script was compiled from source instead.
+    code_cache_rejects_++;
+    code_cache_compile_time_ += elapsed;
+  } else {
+    ScriptCompiler::Source script_source(source, origin);
+    timer.Start();
+    result = ScriptCompiler::Compile(context, &script_source);
+    base::TimeDelta elapsed = timer.Elapsed();
+    base::LockGuard<base::Mutex> lock_guard(code_cache_mutex_.Pointer());
+    code_cache_misses_++;
+    code_cache_compile_time_ += elapsed;
+  }
+  if (result.IsEmpty()) return result;
+
+  // The script is in the compilation cache of this isolate now, which would
+  // keep it from producing cached data. Produce it in a fresh isolate.
+  ScriptCompiler::CachedData* data =
+      CompileForCachedData(source, name, ScriptCompiler::kProduceCodeCache);
+  if (data != NULL) {
+    FILE* file = base::OS::FOpen(file_name.c_str(), "wb");
+    if (file == NULL ||
+        fwrite(data->data, 1, data->length, file) !=
+            static_cast<size_t>(data->length)) {
+      printf("Could not write code cache %s\n", file_name.c_str());
+    }
+    if (file != NULL) fclose(file);
+    delete data;
+  }
+  return result;
+}
+
+
+void Shell::PrintCodeCacheStats() {
+  base::LockGuard<base::Mutex> lock_guard(code_cache_mutex_.Pointer());
+  printf("Code cache: %d hits, %d misses, %d rejected\n", code_cache_hits_,
+         code_cache_misses_, code_cache_rejects_);
+  printf("Code cache: %.3f ms deserializing, %.3f ms compiling\n",
+         code_cache_deserialize_time_.InMillisecondsF(),
+         code_cache_compile_time_.InMillisecondsF());
+}
+#endif  // !V8_SHARED
+
+
 struct DataAndPersistent {
   uint8_t* data;
   int byte_length;
@@ -1543,7 +1788,7 @@ void SourceGroup::Execute(Isolate* isolate) {
     }
     Shell::options.script_executed = true;
     if (!Shell::ExecuteString(isolate, source, file_name, false, true,
-                              source_type)) {
+                              source_type, true)) {
       exception_was_thrown = true;
       break;
     }
@@ -1962,6 +2207,20 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = NULL;
+    } else if (strncmp(argv[i], "--code-cache-dir=", 17) == 0) {
+#ifdef V8_SHARED
+      printf("D8 with shared library does not support a code cache dir\n");
+      return false;
+#else
+      options.code_cache_dir = argv[i] + 17;
+      argv[i] = NULL;
+#endif  // V8_SHARED
+    } else if (strcmp(argv[i], "--enable-tracing") == 0) {
+      options.trace_enabled = true;
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--trace-config=", 15) == 0) {
+      options.trace_config = argv[i] + 15;
+      argv[i] = NULL;
     } else if (strncmp(argv[i], "--icu-data-file=", 16) == 0) {
       options.icu_data_file = argv[i] + 16;
       argv[i] = NULL;
@@ -2416,6 +2675,78 @@ static void DumpHeapConstants(i::Isolate* isolate) {
 #endif  // !V8_SHARED
 
 
+static int AddTraceCategories(
+    Isolate* isolate, Local<Context> context, Local<Object> config,
+    const char* key, platform::tracing::TraceConfig* trace_config,
+    void (platform::tracing::TraceConfig::*add)(const char*)) {
+  Local<Value> value;
+  if (!config->Get(context, String::NewFromUtf8(isolate, key,
+                                                NewStringType::kNormal)
+                                .ToLocalChecked())
+           .ToLocal(&value) ||
+      !value->IsArray()) {
+    return 0;
+  }
+  Local<Array> categories = value.As<Array>();
+  int count = 0;
+  for (uint32_t i = 0; i < categories->Length(); i++) {
+    Local<Value> category;
+    if (!categories->Get(context, i).ToLocal(&category) ||
+        !category->IsString()) {
+      continue;
+    }
+    String::Utf8Value name(category);
+    if (name.length() == 0) continue;
+    (trace_config->*add)(*name);
+    count++;
+  }
+  return count;
+}
+
+
+// Reads a trace config file of the form
+//   {"record_mode": "record-until-full" | "record-continuously",
+//    "included_categories": ["v8", ...],
+//    "excluded_categories": [...]}
+static platform::tracing::TraceConfig* CreateTraceConfigFromJSON(
+    Isolate* isolate, const char* json_file) {
+  HandleScope handle_scope(isolate);
+  Local<Context> context = Context::New(isolate);
+  Context::Scope context_scope(context);
+  TryCatch try_catch(isolate);
+  Local<String> source = Shell::ReadFile(isolate, json_file);
+  Local<Value> result;
+  if (source.IsEmpty() || !JSON::Parse(isolate, source).ToLocal(&result) ||
+      !result->IsObject()) {
+    printf("Invalid trace config file %s, tracing the default categories\n",
+           json_file);
+    return platform::tracing::TraceConfig::CreateDefaultTraceConfig();
+  }
+  Local<Object> config = result.As<Object>();
+  platform::tracing::TraceConfig* trace_config =
+      new platform::tracing::TraceConfig();
+  Local<Value> record_mode;
+  if (config->Get(context, String::NewFromUtf8(isolate, "record_mode",
+                                               NewStringType::kNormal)
+                               .ToLocalChecked())
+          .ToLocal(&record_mode) &&
+      record_mode->IsString()) {
+    String::Utf8Value mode(record_mode);
+    if (strcmp(*mode, "record-continuously") == 0) {
+      trace_config->SetTraceRecordMode(platform::tracing::RECORD_CONTINUOUSLY);
+    }
+  }
+  int included = AddTraceCategories(
+      isolate, context, config, "included_categories", trace_config,
+      &platform::tracing::TraceConfig::AddIncludedCategory);
+  if (included == 0) trace_config->AddIncludedCategory("v8");
+  AddTraceCategories(isolate, context, config, "excluded_categories",
+                     trace_config,
+                     &platform::tracing::TraceConfig::AddExcludedCategory);
+  return trace_config;
+}
+
+
 int Shell::Main(int argc, char* argv[]) {
 #if (defined(_WIN32) || defined(_WIN64))
   UINT new_flags =
@@ -2442,6 +2773,21 @@ int Shell::Main(int argc, char* argv[]) {
   g_platform = v8::platform::CreateDefaultPlatform();
 #endif  // !V8_SHARED
 
+  std::ofstream trace_file;
+  if (options.trace_enabled) {
+#ifndef V8_SHARED
+    if (i::FLAG_verify_predictable) {
+      printf("Tracing is not supported with --verify-predictable\n");
+      return 1;
+    }
+#endif  // !V8_SHARED
+    trace_file.open("v8_trace.json");
+    g_tracing_controller = new platform::tracing::TracingController();
+    g_tracing_controller->Initialize(
+        platform::tracing::TraceWriter::CreateJSONTraceWriter(trace_file));
+    platform::SetTracingController(g_platform, g_tracing_controller);
+  }
+
   v8::V8::InitializePlatform(g_platform);
   v8::V8::Initialize();
   if (options.natives_blob || options.snapshot_blob) {
@@ -2484,6 +2830,13 @@ int Shell::Main(int argc, char* argv[]) {
     Initialize(isolate);
     PerIsolateData data(isolate);
 
+    if (options.trace_enabled) {
+      g_tracing_controller->StartTracing(
+          options.trace_config != NULL
+              ? CreateTraceConfigFromJSON(isolate, options.trace_config)
+              : platform::tracing::TraceConfig::CreateDefaultTraceConfig());
+    }
+
 #ifndef V8_SHARED
     if (options.dump_heap_constants) {
       DumpHeapConstants(reinterpret_cast<i::Isolate*>(isolate));
@@ -290,7 +290,10 @@ class ShellOptions {
         isolate_sources(NULL),
         icu_data_file(NULL),
         natives_blob(NULL),
-        snapshot_blob(NULL) {}
+        snapshot_blob(NULL),
+        trace_enabled(false),
+        trace_config(NULL),
+        code_cache_dir(NULL) {}
 
   ~ShellOptions() {
     delete[] isolate_sources;
@@ -318,6 +321,9 @@ class ShellOptions {
   const char* icu_data_file;
   const char* natives_blob;
   const char* snapshot_blob;
+  bool trace_enabled;
+  const char* trace_config;
+  const char* code_cache_dir;
 };
 
 #ifdef V8_SHARED
@@ -332,11 +338,12 @@ class Shell : public i::AllStatic {
   static MaybeLocal<Script> CompileString(
       Isolate* isolate, Local<String> source, Local<Value> name,
       v8::ScriptCompiler::CompileOptions compile_options,
-      SourceType source_type);
+      SourceType source_type, bool from_file = false);
   static bool ExecuteString(Isolate* isolate, Local<String> source,
                             Local<Value> name, bool print_result,
                             bool report_exceptions,
-                            SourceType source_type = SCRIPT);
+                            SourceType source_type = SCRIPT,
+                            bool from_file = false);
   static const char* ToCString(const v8::String::Utf8Value& value);
   static void ReportException(Isolate* isolate, TryCatch* try_catch);
   static Local<String> ReadFile(Isolate* isolate, const char* name);
@@ -369,6 +376,10 @@ class Shell : public i::AllStatic {
   static void MapCounters(v8::Isolate* isolate, const char* name);
 
   static void PerformanceNow(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void BackgroundJSONStart(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void BackgroundJSONFinish(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
 #endif  // !V8_SHARED
 
   static void RealmCurrent(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -461,8 +472,20 @@ class Shell : public i::AllStatic {
   static i::List<Worker*> workers_;
   static i::List<SharedArrayBuffer::Contents> externalized_shared_contents_;
 
+  // Statistics of --code-cache-dir, printed on exit.
+  static base::LazyMutex code_cache_mutex_;
+  static int code_cache_hits_;
+  static int code_cache_misses_;
+  static int code_cache_rejects_;
+  static base::TimeDelta code_cache_deserialize_time_;
+  static base::TimeDelta code_cache_compile_time_;
+
   static Counter* GetCounter(const char* name, bool is_histogram);
   static void InstallUtilityScript(Isolate* isolate);
+  static MaybeLocal<Script> CompileWithCodeCacheDir(Isolate* isolate,
+                                                    Local<String> source,
+                                                    Local<String> name);
+  static void PrintCodeCacheStats();
 #endif  // !V8_SHARED
   static void Initialize(Isolate* isolate);
   static void RunShell(Isolate* isolate);
@@ -723,7 +723,6 @@ enum CpuFeature {
   MIPSr2,
   MIPSr6,
   // ARM64
-  ALWAYS_ALIGN_CSP,
   COHERENT_CACHE,
   // PPC
   FPR_GPR_MOV,
@@ -733,7 +732,14 @@ enum CpuFeature {
   DISTINCT_OPS,
   GENERAL_INSTR_EXT,
   FLOATING_POINT_EXT,
-  NUMBER_OF_CPU_FEATURES
+  VECTOR_FACILITY,
+  NUMBER_OF_CPU_FEATURES,
+
+  // S390 feature aliases. The load/store-on-condition and interlocked-access
+  // facilities are installed together with the distinct-operands facility
+  // (STFLE bit 45).
+  LOAD_STORE_ON_COND = DISTINCT_OPS,
+  INTERLOCKED_ACCESS = DISTINCT_OPS
 };
 
 
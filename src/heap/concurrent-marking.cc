@@ -0,0 +1,352 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/concurrent-marking.h"
+
+#include "src/hashmap.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/mark-compact-inl.h"
+#include "src/heap/objects-visiting.h"
+#include "src/heap/spaces-inl.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+// Visits objects on a background thread. All results that have to be
+// published on the main thread (live bytes, recorded slots, bailouts) are
+// kept locally until the task finishes.
+class ConcurrentMarking::Visitor {
+ public:
+  explicit Visitor(std::vector<HeapObject*>* work)
+      : work_(work),
+        live_bytes_(HashMap::PointersMatch),
+        marked_bytes_(0),
+        marked_objects_(0),
+        bailouts_(0) {}
+
+  void VisitObject(HeapObject* object) {
+    Map* map = object->synchronized_map();
+    if (!CanVisitConcurrently(object, map)) {
+      AddBailout(object);
+      return;
+    }
+    MarkBit mark_bit = Marking::MarkBitFrom(object);
+    // Claim the object before reading its body. From now on the write barrier
+    // treats the object as black.
+    if (!Marking::TryGreyToBlack(mark_bit)) return;
+    MarkObject(map);
+    int size;
+    if (map->visitor_id() == StaticVisitorBase::kVisitFixedArray) {
+      // The array may be trimmed concurrently. Trimmed elements are left in
+      // place and remain valid, so scanning up to the length we read first is
+      // safe.
+      int length = FixedArray::cast(object)->synchronized_length();
+      size = FixedArray::SizeFor(length);
+      VisitPointers(object,
+                    HeapObject::RawField(object, FixedArray::kHeaderSize),
+                    HeapObject::RawField(object, size));
+    } else {
+      size = object->SizeFromMap(map);
+    }
+    IncrementLiveBytes(MemoryChunk::FromAddress(object->address()), size);
+    marked_bytes_ += size;
+    marked_objects_++;
+  }
+
+  void VisitPointers(HeapObject* host, Object** start, Object** end) {
+    for (Object** slot = start; slot < end; slot++) {
+      Object* value = reinterpret_cast<Object*>(
+          base::NoBarrier_Load(reinterpret_cast<base::AtomicWord*>(slot)));
+      if (!value->IsHeapObject()) continue;
+      HeapObject* target = HeapObject::cast(value);
+      if (Page::FromAddress(target->address())->IsEvacuationCandidate()) {
+        recorded_slots_.push_back(RecordedSlot(host, slot));
+      }
+      MarkObject(target);
+    }
+  }
+
+  void MarkObject(HeapObject* object) {
+    if (!Marking::TryWhiteToGrey(Marking::MarkBitFrom(object))) return;
+    // Objects in new space can be written without a write barrier right after
+    // their allocation, so only the main thread may visit them.
+    if (MemoryChunk::FromAddress(object->address())->InNewSpace()) {
+      AddBailout(object);
+    } else {
+      work_->push_back(object);
+    }
+  }
+
+  void AddBailout(HeapObject* object) {
+    bailout_work_.push_back(object);
+    bailouts_++;
+  }
+
+  void IncrementLiveBytes(MemoryChunk* chunk, intptr_t by) {
+    uint32_t hash = static_cast<uint32_t>(
+        reinterpret_cast<uintptr_t>(chunk) >> kPageSizeBits);
+    HashMap::Entry* entry = live_bytes_.LookupOrInsert(chunk, hash);
+    entry->value = reinterpret_cast<void*>(
+        reinterpret_cast<intptr_t>(entry->value) + by);
+  }
+
+  std::vector<HeapObject*>* bailout_work() { return &bailout_work_; }
+  std::vector<RecordedSlot>* recorded_slots() { return &recorded_slots_; }
+  HashMap* live_bytes() { return &live_bytes_; }
+  intptr_t marked_bytes() { return marked_bytes_; }
+  intptr_t marked_objects() { return marked_objects_; }
+  intptr_t bailouts() { return bailouts_; }
+
+ private:
+  std::vector<HeapObject*>* work_;
+  std::vector<HeapObject*> bailout_work_;
+  std::vector<RecordedSlot> recorded_slots_;
+  HashMap live_bytes_;
+  intptr_t marked_bytes_;
+  intptr_t marked_objects_;
+  intptr_t bailouts_;
+
+  DISALLOW_COPY_AND_ASSIGN(Visitor);
+};
+
+
+class ConcurrentMarking::Task : public CancelableTask {
+ public:
+  Task(Isolate* isolate, ConcurrentMarking* concurrent_marking, int task_index)
+      : CancelableTask(isolate),
+        concurrent_marking_(concurrent_marking),
+        task_index_(task_index) {}
+
+  virtual ~Task() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { concurrent_marking_->Run(task_index_); }
+
+  ConcurrentMarking* concurrent_marking_;
+  int task_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(Task);
+};
+
+
+ConcurrentMarking::ConcurrentMarking(Heap* heap)
+    : heap_(heap),
+      pending_tasks_semaphore_(0),
+      abort_(0),
+      marked_bytes_(0),
+      marked_objects_(0),
+      bailouts_(0) {}
+
+
+ConcurrentMarking::~ConcurrentMarking() {
+  for (int i = 0; i < kMaxTasks; i++) {
+    DCHECK(tasks_[i].id == kNoTask);
+  }
+}
+
+
+bool ConcurrentMarking::CanVisitConcurrently(HeapObject* object, Map* map) {
+  // Large objects are scanned in chunks using the progress bar, which is
+  // only maintained by the main thread.
+  MemoryChunk* chunk = MemoryChunk::FromAddress(object->address());
+  if (chunk->InNewSpace() || chunk->owner()->identity() == LO_SPACE) {
+    return false;
+  }
+  // Fillers have to be skipped because their mark bits may overlap with the
+  // mark bits of the next object.
+  if (map->instance_type() == FILLER_TYPE) return false;
+  // Only objects whose layout cannot change under the marker are visited
+  // concurrently: fixed arrays, which only contain tagged values, and objects
+  // without any pointers in their body. Everything else (e.g. JSObjects,
+  // which may have unboxed double fields after a map change, and all objects
+  // with weak or custom visitation) is left to the main thread.
+  switch (map->visitor_id()) {
+    case StaticVisitorBase::kVisitFixedArray:
+    case StaticVisitorBase::kVisitFixedDoubleArray:
+    case StaticVisitorBase::kVisitByteArray:
+    case StaticVisitorBase::kVisitSeqOneByteString:
+    case StaticVisitorBase::kVisitSeqTwoByteString:
+      return true;
+    default:
+      return map->visitor_id() >= StaticVisitorBase::kVisitDataObject &&
+             map->visitor_id() <= StaticVisitorBase::kVisitDataObjectGeneric;
+  }
+}
+
+
+void ConcurrentMarking::Push(HeapObject* object) {
+  main_thread_work_.push_back(object);
+}
+
+
+void ConcurrentMarking::ScheduleTasks() {
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    shared_work_.insert(shared_work_.end(), main_thread_work_.begin(),
+                        main_thread_work_.end());
+    if (shared_work_.empty()) return;
+  }
+  main_thread_work_.clear();
+  for (int i = 0; i < NumberOfTasks(); i++) {
+    TaskState* state = &tasks_[i];
+    if (state->id != kNoTask) {
+      if (!base::Acquire_Load(&state->finished)) continue;
+      ReleaseTask(state);
+    }
+    Task* task = new Task(heap_->isolate(), this, i);
+    state->id = task->id();
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+}
+
+
+void ConcurrentMarking::ReleaseTask(TaskState* state) {
+  pending_tasks_semaphore_.Wait();
+  state->id = kNoTask;
+  base::NoBarrier_Store(&state->finished, 0);
+}
+
+
+int ConcurrentMarking::NumberOfTasks() {
+  int available_threads = static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  return Max(1, Min(static_cast<int>(kMaxTasks), available_threads));
+}
+
+
+void ConcurrentMarking::FlushBailouts(MarkingDeque* marking_deque) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  for (HeapObject* object : bailout_work_) {
+    // If the deque overflows, the object stays grey and is found again when
+    // the heap is rescanned for grey objects.
+    marking_deque->Push(object);
+  }
+  bailout_work_.clear();
+}
+
+
+void ConcurrentMarking::Stop() {
+  base::Release_Store(&abort_, 1);
+  for (int i = 0; i < kMaxTasks; i++) {
+    TaskState* state = &tasks_[i];
+    if (state->id == kNoTask) continue;
+    if (heap_->isolate()->cancelable_task_manager()->TryAbort(state->id)) {
+      state->id = kNoTask;
+    } else {
+      ReleaseTask(state);
+    }
+  }
+  base::Release_Store(&abort_, 0);
+
+  MarkingDeque* marking_deque =
+      heap_->mark_compact_collector()->marking_deque();
+  if (marking_deque->in_use()) {
+    for (HeapObject* object : main_thread_work_) marking_deque->Push(object);
+    for (HeapObject* object : shared_work_) marking_deque->Push(object);
+    FlushBailouts(marking_deque);
+  }
+  main_thread_work_.clear();
+  shared_work_.clear();
+  bailout_work_.clear();
+
+  for (const LiveBytes& entry : live_bytes_) {
+    entry.first->IncrementLiveBytes(static_cast<int>(entry.second));
+  }
+  live_bytes_.clear();
+
+  MarkCompactCollector* collector = heap_->mark_compact_collector();
+  for (const RecordedSlot& entry : recorded_slots_) {
+    Object** slot = entry.second;
+    Object* value = *slot;
+    if (value->IsHeapObject()) collector->RecordSlot(entry.first, slot, value);
+  }
+  recorded_slots_.clear();
+}
+
+
+bool ConcurrentMarking::IsIdle() {
+  if (!main_thread_work_.empty()) return false;
+  for (int i = 0; i < kMaxTasks; i++) {
+    if (tasks_[i].id != kNoTask && !base::Acquire_Load(&tasks_[i].finished)) {
+      return false;
+    }
+  }
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  return shared_work_.empty() && bailout_work_.empty();
+}
+
+
+void ConcurrentMarking::ResetStatistics() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  marked_bytes_ = 0;
+  marked_objects_ = 0;
+  bailouts_ = 0;
+}
+
+
+bool ConcurrentMarking::TakeBatch(std::vector<HeapObject*>* local) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  size_t count = Min(kBatchSize, shared_work_.size());
+  if (count == 0) return false;
+  local->insert(local->end(), shared_work_.end() - count, shared_work_.end());
+  shared_work_.resize(shared_work_.size() - count);
+  return true;
+}
+
+
+void ConcurrentMarking::PublishBatch(std::vector<HeapObject*>* local) {
+  // Publish the oldest half of the local work so that idle tasks can pick it
+  // up, while the newest objects stay local for better locality.
+  size_t count = local->size() / 2;
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  shared_work_.insert(shared_work_.end(), local->begin(),
+                      local->begin() + count);
+  local->erase(local->begin(), local->begin() + count);
+}
+
+
+void ConcurrentMarking::Run(int task_index) {
+  std::vector<HeapObject*> local;
+  Visitor visitor(&local);
+  while (!ShouldAbort() && TakeBatch(&local)) {
+    while (!local.empty()) {
+      HeapObject* object = local.back();
+      local.pop_back();
+      visitor.VisitObject(object);
+      if (local.size() > 2 * kBatchSize) PublishBatch(&local);
+      if (ShouldAbort()) break;
+    }
+  }
+
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    // Objects that were not visited yet are still grey.
+    shared_work_.insert(shared_work_.end(), local.begin(), local.end());
+    bailout_work_.insert(bailout_work_.end(),
+                         visitor.bailout_work()->begin(),
+                         visitor.bailout_work()->end());
+    recorded_slots_.insert(recorded_slots_.end(),
+                           visitor.recorded_slots()->begin(),
+                           visitor.recorded_slots()->end());
+    HashMap* live_bytes = visitor.live_bytes();
+    for (HashMap::Entry* entry = live_bytes->Start(); entry != nullptr;
+         entry = live_bytes->Next(entry)) {
+      live_bytes_.push_back(
+          LiveBytes(reinterpret_cast<MemoryChunk*>(entry->key),
+                    reinterpret_cast<intptr_t>(entry->value)));
+    }
+    marked_bytes_ += visitor.marked_bytes();
+    marked_objects_ += visitor.marked_objects();
+    bailouts_ += visitor.bailouts();
+  }
+
+  base::Release_Store(&tasks_[task_index].finished, 1);
+  pending_tasks_semaphore_.Signal();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,127 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONCURRENT_MARKING_H_
+#define V8_HEAP_CONCURRENT_MARKING_H_
+
+#include <utility>
+#include <vector>
+
+#include "src/base/atomicops.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/cancelable-task.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Forward declarations.
+class Heap;
+class HeapObject;
+class Map;
+class MarkingDeque;
+class MemoryChunk;
+
+// Marks objects on background threads while JavaScript is running.
+//
+// The incremental marker hands grey objects that can be visited concurrently
+// (see CanVisitConcurrently) to the background tasks instead of visiting them
+// itself. The background tasks take back objects they cannot visit
+// (bailouts), which the main thread picks up in its next step.
+//
+// Background tasks claim an object by turning it black before reading its
+// body. While concurrent marking is enabled, the write barrier shades every
+// written value regardless of the color of the host object (see
+// IncrementalMarking::BaseRecordWrite), so a racing write is never lost.
+//
+// Live bytes and recorded slots are accumulated per task and published on the
+// main thread in Stop(). Stop() must be called before objects are moved or
+// freed, i.e. before every GC, and before marking is finalized.
+class ConcurrentMarking {
+ public:
+  static const int kMaxTasks = 4;
+
+  explicit ConcurrentMarking(Heap* heap);
+  ~ConcurrentMarking();
+
+  // Returns true if the background tasks may visit |object| with the given
+  // |map| while the mutator is running.
+  static bool CanVisitConcurrently(HeapObject* object, Map* map);
+
+  // Hands a grey object over to the background tasks. Main thread only.
+  void Push(HeapObject* object);
+
+  // Publishes pushed objects and starts background tasks if there is work.
+  void ScheduleTasks();
+
+  // Moves objects the background tasks could not visit to |marking_deque|.
+  void FlushBailouts(MarkingDeque* marking_deque);
+
+  // Stops all background tasks, moves the remaining work to the marking
+  // deque and publishes live bytes and recorded slots.
+  void Stop();
+
+  // Returns true if there is neither pending nor running background work.
+  bool IsIdle();
+
+  void ResetStatistics();
+  intptr_t marked_bytes() { return marked_bytes_; }
+  intptr_t marked_objects() { return marked_objects_; }
+  intptr_t bailouts() { return bailouts_; }
+
+ private:
+  class Task;
+  class Visitor;
+
+  typedef std::pair<HeapObject*, Object**> RecordedSlot;
+  typedef std::pair<MemoryChunk*, intptr_t> LiveBytes;
+
+  struct TaskState {
+    TaskState() : id(kNoTask), finished(0) {}
+    uint32_t id;
+    base::Atomic32 finished;
+  };
+
+  static const uint32_t kNoTask = 0;
+  static const size_t kBatchSize = 64;
+
+  // Called on background threads.
+  void Run(int task_index);
+  bool ShouldAbort() { return base::Acquire_Load(&abort_) != 0; }
+  bool TakeBatch(std::vector<HeapObject*>* local);
+  void PublishBatch(std::vector<HeapObject*>* local);
+
+  // Waits for the completion signal of a finished task.
+  void ReleaseTask(TaskState* state);
+
+  int NumberOfTasks();
+
+  Heap* heap_;
+
+  // Objects pushed by the main thread, published in ScheduleTasks.
+  std::vector<HeapObject*> main_thread_work_;
+
+  // Guards all fields below up to the statistics.
+  base::Mutex mutex_;
+  std::vector<HeapObject*> shared_work_;
+  std::vector<HeapObject*> bailout_work_;
+  std::vector<LiveBytes> live_bytes_;
+  std::vector<RecordedSlot> recorded_slots_;
+
+  TaskState tasks_[kMaxTasks];
+  base::Semaphore pending_tasks_semaphore_;
+  base::Atomic32 abort_;
+
+  intptr_t marked_bytes_;
+  intptr_t marked_objects_;
+  intptr_t bailouts_;
+
+  DISALLOW_COPY_AND_ASSIGN(ConcurrentMarking);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONCURRENT_MARKING_H_
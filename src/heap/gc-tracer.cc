@@ -73,7 +73,10 @@ GCTracer::Event::Event(Type type, const char* gc_reason,
       incremental_marking_duration(0.0),
       cumulative_pure_incremental_marking_duration(0.0),
       pure_incremental_marking_duration(0.0),
-      longest_incremental_marking_step(0.0) {
+      longest_incremental_marking_step(0.0),
+      parallel_scavenge_tasks(0),
+      parallel_marking_threads(0),
+      parallel_pointer_update_tasks(0) {
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     scopes[i] = 0;
   }
@@ -443,6 +446,8 @@ void GCTracer::PrintNVP() const {
                    "reduce_memory=%d "
                    "scavenge=%.2f "
                    "old_new=%.2f "
+                   "parallel=%.2f "
+                   "parallel_tasks=%d "
                    "weak=%.2f "
                    "roots=%.2f "
                    "code=%.2f "
@@ -481,6 +486,8 @@ void GCTracer::PrintNVP() const {
                    current_.reduce_memory,
                    current_.scopes[Scope::SCAVENGER_SCAVENGE],
                    current_.scopes[Scope::SCAVENGER_OLD_TO_NEW_POINTERS],
+                   current_.scopes[Scope::SCAVENGER_PARALLEL],
+                   current_.parallel_scavenge_tasks,
                    current_.scopes[Scope::SCAVENGER_WEAK],
                    current_.scopes[Scope::SCAVENGER_ROOTS],
                    current_.scopes[Scope::SCAVENGER_CODE_FLUSH_CANDIDATES],
@@ -527,12 +534,16 @@ void GCTracer::PrintNVP() const {
           "evacuate.new_space=%.1f "
           "evacuate.update_pointers=%.1f "
           "evacuate.update_pointers.between_evacuated=%.1f "
+          "evacuate.update_pointers.parallel=%.1f "
+          "evacuate.update_pointers.parallel_tasks=%d "
           "evacuate.update_pointers.to_evacuated=%.1f "
           "evacuate.update_pointers.to_new=%.1f "
           "evacuate.update_pointers.weak=%.1f "
           "finish=%.1f "
           "mark=%.1f "
           "mark.finish_incremental=%.1f "
+          "mark.parallel=%.1f "
+          "mark.parallel_threads=%d "
           "mark.prepare_code_flush=%.1f "
           "mark.roots=%.1f "
           "mark.weak_closure=%.1f "
@@ -593,11 +604,15 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::MC_EVACUATE_NEW_SPACE],
           current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS],
           current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS_BETWEEN_EVACUATED],
+          current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS_PARALLEL],
+          current_.parallel_pointer_update_tasks,
           current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS_TO_EVACUATED],
           current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS_TO_NEW],
           current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS_WEAK],
           current_.scopes[Scope::MC_FINISH], current_.scopes[Scope::MC_MARK],
           current_.scopes[Scope::MC_MARK_FINISH_INCREMENTAL],
+          current_.scopes[Scope::MC_MARK_PARALLEL],
+          current_.parallel_marking_threads,
           current_.scopes[Scope::MC_MARK_PREPARE_CODE_FLUSH],
           current_.scopes[Scope::MC_MARK_ROOTS],
           current_.scopes[Scope::MC_MARK_WEAK_CLOSURE],
@@ -115,6 +115,7 @@ class GCTracer {
       MC_EVACUATE_NEW_SPACE,
       MC_EVACUATE_UPDATE_POINTERS,
       MC_EVACUATE_UPDATE_POINTERS_BETWEEN_EVACUATED,
+      MC_EVACUATE_UPDATE_POINTERS_PARALLEL,
       MC_EVACUATE_UPDATE_POINTERS_TO_EVACUATED,
       MC_EVACUATE_UPDATE_POINTERS_TO_NEW,
       MC_EVACUATE_UPDATE_POINTERS_WEAK,
@@ -122,6 +123,7 @@ class GCTracer {
       MC_INCREMENTAL_FINALIZE,
       MC_MARK,
       MC_MARK_FINISH_INCREMENTAL,
+      MC_MARK_PARALLEL,
       MC_MARK_PREPARE_CODE_FLUSH,
       MC_MARK_ROOTS,
       MC_MARK_WEAK_CLOSURE,
@@ -132,6 +134,7 @@ class GCTracer {
       SCAVENGER_CODE_FLUSH_CANDIDATES,
       SCAVENGER_OBJECT_GROUPS,
       SCAVENGER_OLD_TO_NEW_POINTERS,
+      SCAVENGER_PARALLEL,
       SCAVENGER_ROOTS,
       SCAVENGER_SCAVENGE,
       SCAVENGER_SEMISPACE,
@@ -303,6 +306,18 @@ class GCTracer {
     // (value at start of event)
     double longest_incremental_marking_step;
 
+    // Number of tasks that took part in a parallel scavenge, or 0 if the
+    // scavenge was done on the main thread only.
+    int parallel_scavenge_tasks;
+
+    // Largest number of threads that took part in a parallel marking phase
+    // of a mark-compact, or 0 if parallel marking was not used.
+    int parallel_marking_threads;
+
+    // Number of tasks that updated pointers after evacuation in parallel, or
+    // 0 if pointers were updated on the main thread only.
+    int parallel_pointer_update_tasks;
+
     // Amounts of time spent in different scopes during GC.
     double scopes[Scope::NUMBER_OF_SCOPES];
   };
@@ -344,6 +359,23 @@ class GCTracer {
 
   void AddSurvivalRatio(double survival_ratio);
 
+  // Log the number of tasks used by the current parallel scavenge.
+  void AddParallelScavengeEvent(int tasks) {
+    current_.parallel_scavenge_tasks = tasks;
+  }
+
+  // Log the number of threads used by parallel marking in the current
+  // mark-compact.
+  void AddParallelMarkingEvent(int threads) {
+    current_.parallel_marking_threads = threads;
+  }
+
+  // Log the number of tasks used to update pointers after evacuation in the
+  // current mark-compact.
+  void AddParallelPointerUpdateEvent(int tasks) {
+    current_.parallel_pointer_update_tasks = tasks;
+  }
+
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, intptr_t bytes);
 
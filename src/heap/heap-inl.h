@@ -545,6 +545,37 @@ void Heap::UpdateAllocationSite(HeapObject* object,
 }
 
 
+void Heap::UpdateAllocationSiteCached(HeapObject* object, Map* map,
+                                      int object_size,
+                                      HashMap* pretenuring_feedback) {
+  DCHECK(InFromSpace(object));
+  DCHECK_NE(pretenuring_feedback, global_pretenuring_feedback_);
+  if (!FLAG_allocation_site_pretenuring ||
+      !AllocationSite::CanTrack(map->instance_type()))
+    return;
+  Address memento_address = object->address() + object_size;
+  if (!NewSpacePage::OnSamePage(object->address(),
+                                memento_address + kPointerSize)) {
+    return;
+  }
+  // Mementos are never copied, so their map word is stable even while other
+  // tasks are forwarding objects.
+  HeapObject* candidate = HeapObject::FromAddress(memento_address);
+  MapWord candidate_map_word = candidate->synchronized_map_word();
+  MSAN_MEMORY_IS_INITIALIZED(&candidate_map_word, sizeof(candidate_map_word));
+  if (candidate_map_word.IsForwardingAddress() ||
+      candidate_map_word.ToMap() != allocation_memento_map()) {
+    return;
+  }
+  Address key =
+      AllocationMemento::cast(candidate)->GetAllocationSiteUnchecked();
+  HashMap::Entry* e =
+      pretenuring_feedback->LookupOrInsert(key, ObjectHash(key));
+  DCHECK(e != nullptr);
+  (*bit_cast<intptr_t*>(&e->value))++;
+}
+
+
 void Heap::RemoveAllocationSitePretenuringFeedback(AllocationSite* site) {
   global_pretenuring_feedback_->Remove(
       site, static_cast<uint32_t>(bit_cast<uintptr_t>(site)));
@@ -676,6 +676,15 @@ void Heap::GarbageCollectionEpilogue() {
   isolate_->counters()->alive_after_last_gc()->Set(
       static_cast<int>(SizeOfObjects()));
 
+  // Pooled zone segments are not needed while the heap shrinks.
+  if (ShouldReduceMemory()) ZoneSegmentPool::Trim();
+  isolate_->counters()->zone_segments_pooled()->Set(
+      static_cast<int>(ZoneSegmentPool::pooled_allocations()));
+  isolate_->counters()->zone_segments_fresh()->Set(
+      static_cast<int>(ZoneSegmentPool::fresh_allocations()));
+  isolate_->counters()->zone_segment_pool_size()->Set(
+      static_cast<int>(ZoneSegmentPool::pooled_bytes()));
+
   isolate_->counters()->string_table_capacity()->Set(
       string_table()->Capacity());
   isolate_->counters()->number_of_symbols()->Set(
@@ -1261,6 +1270,11 @@ bool Heap::PerformGarbageCollection(
     GarbageCollector collector, const v8::GCCallbackFlags gc_callback_flags) {
   int freed_global_handles = 0;
 
+  if (FLAG_concurrent_marking) {
+    // Background marking tasks must not observe objects being moved or freed.
+    incremental_marking()->concurrent_marking()->Stop();
+  }
+
   if (collector != SCAVENGER) {
     PROFILE(isolate_, CodeMovingGCEvent());
   }
@@ -1636,6 +1650,10 @@ void Heap::Scavenge() {
 
   scavenge_collector_->SelectScavengingVisitorsTable();
 
+  // Needs to be computed while the objects to scavenge are still in to space.
+  int parallel_scavenging_tasks =
+      scavenge_collector_->NumberOfParallelScavengingTasks();
+
   array_buffer_tracker()->PrepareDiscoveryInNewSpace();
 
   // Flip the semispaces.  After flipping, to space is empty, from space has
@@ -1670,18 +1688,26 @@ void Heap::Scavenge() {
         &IsUnmodifiedHeapObject);
   }
 
-  {
-    // Copy roots.
-    GCTracer::Scope gc_scope(tracer(), GCTracer::Scope::SCAVENGER_ROOTS);
-    IterateRoots(&scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
-  }
+  if (parallel_scavenging_tasks > 1) {
+    // Copy roots, objects reachable from the old generation and their
+    // transitive closure in parallel.
+    GCTracer::Scope gc_scope(tracer(), GCTracer::Scope::SCAVENGER_PARALLEL);
+    new_space_front =
+        scavenge_collector_->ScavengeInParallel(parallel_scavenging_tasks);
+  } else {
+    {
+      // Copy roots.
+      GCTracer::Scope gc_scope(tracer(), GCTracer::Scope::SCAVENGER_ROOTS);
+      IterateRoots(&scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
+    }
 
-  {
-    // Copy objects reachable from the old generation.
-    GCTracer::Scope gc_scope(tracer(),
-                             GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
-    RememberedSet<OLD_TO_NEW>::IterateWithWrapper(this,
-                                                  Scavenger::ScavengeObject);
+    {
+      // Copy objects reachable from the old generation.
+      GCTracer::Scope gc_scope(tracer(),
+                               GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
+      RememberedSet<OLD_TO_NEW>::IterateWithWrapper(this,
+                                                    Scavenger::ScavengeObject);
+    }
   }
 
   {
@@ -3068,6 +3094,12 @@ bool Heap::CanMoveObjectStart(HeapObject* object) {
 
   if (lo_space()->Contains(object)) return false;
 
+  // The concurrent marker may be reading the object's length and body.
+  if (FLAG_concurrent_marking && InOldSpace(object) &&
+      incremental_marking()->IsMarking()) {
+    return false;
+  }
+
   Page* page = Page::FromAddress(address);
   // We can move the object start if:
   // (1) the object is not in old space,
@@ -5269,6 +5301,10 @@ void Heap::NotifyDeserializationComplete() {
 
 
 void Heap::TearDown() {
+  if (FLAG_concurrent_marking) {
+    incremental_marking()->concurrent_marking()->Stop();
+  }
+
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap) {
     Verify();
@@ -1333,6 +1333,13 @@ class Heap {
   inline void UpdateAllocationSite(HeapObject* object,
                                    HashMap* pretenuring_feedback);
 
+  // Same as UpdateAllocationSite<kCached>, but takes the {map} and
+  // {object_size} of {object} explicitly. Used by parallel scavenging tasks,
+  // which may observe a forwarding address instead of the map of {object}.
+  inline void UpdateAllocationSiteCached(HeapObject* object, Map* map,
+                                         int object_size,
+                                         HashMap* pretenuring_feedback);
+
   // Removes an entry from the global pretenuring storage.
   inline void RemoveAllocationSitePretenuringFeedback(AllocationSite* site);
 
@@ -44,7 +44,9 @@ IncrementalMarking::IncrementalMarking(Heap* heap)
       was_activated_(false),
       finalize_marking_completed_(false),
       incremental_marking_finalization_rounds_(0),
-      request_type_(COMPLETE_MARKING) {}
+      request_type_(COMPLETE_MARKING),
+      concurrent_marking_(heap),
+      main_thread_marked_bytes_(0) {}
 
 bool IncrementalMarking::BaseRecordWrite(HeapObject* obj, Object* value) {
   HeapObject* value_heap_obj = HeapObject::cast(value);
@@ -55,7 +57,10 @@ bool IncrementalMarking::BaseRecordWrite(HeapObject* obj, Object* value) {
   DCHECK(!Marking::IsImpossible(obj_bit));
   bool is_black = Marking::IsBlack(obj_bit);
 
-  if (is_black && Marking::IsWhite(value_bit)) {
+  // With concurrent marking, a background thread may be reading the body of
+  // |obj| right now, so the color of |obj| does not tell whether |value| will
+  // be visited. Shade |value| regardless.
+  if ((is_black || FLAG_concurrent_marking) && Marking::IsWhite(value_bit)) {
     WhiteToGreyAndPush(value_heap_obj, value_bit);
     RestartIfNotMarking();
   }
@@ -65,7 +70,12 @@ bool IncrementalMarking::BaseRecordWrite(HeapObject* obj, Object* value) {
 
 void IncrementalMarking::RecordWriteSlow(HeapObject* obj, Object** slot,
                                          Object* value) {
-  if (BaseRecordWrite(obj, value) && slot != NULL) {
+  bool record_slot = BaseRecordWrite(obj, value);
+  // The concurrent marker may have read the slot before this write, so the
+  // slot has to be recorded even if |obj| is not black. Untyped slots that do
+  // not end up in live objects are filtered before evacuation.
+  if (FLAG_concurrent_marking) record_slot = is_compacting_;
+  if (record_slot && slot != NULL) {
     // Object is not going to be rescanned we need to record the slot.
     heap_->mark_compact_collector()->RecordSlot(obj, slot, value);
   }
@@ -78,13 +88,20 @@ void IncrementalMarking::RecordWriteFromCode(HeapObject* obj, Object** slot,
   IncrementalMarking* marking = isolate->heap()->incremental_marking();
 
   MemoryChunk* chunk = MemoryChunk::FromAddress(obj->address());
-  int counter = chunk->write_barrier_counter();
-  if (counter < (MemoryChunk::kWriteBarrierCounterGranularity / 2)) {
-    marking->write_barriers_invoked_since_last_step_ +=
-        MemoryChunk::kWriteBarrierCounterGranularity -
-        chunk->write_barrier_counter();
-    chunk->set_write_barrier_counter(
-        MemoryChunk::kWriteBarrierCounterGranularity);
+  if (FLAG_concurrent_marking) {
+    // Keep the counter exhausted so that the record write stub does not skip
+    // the runtime call based on the color of |obj| (see SetOldSpacePageFlags).
+    marking->write_barriers_invoked_since_last_step_++;
+    chunk->set_write_barrier_counter(0);
+  } else {
+    int counter = chunk->write_barrier_counter();
+    if (counter < (MemoryChunk::kWriteBarrierCounterGranularity / 2)) {
+      marking->write_barriers_invoked_since_last_step_ +=
+          MemoryChunk::kWriteBarrierCounterGranularity -
+          chunk->write_barrier_counter();
+      chunk->set_write_barrier_counter(
+          MemoryChunk::kWriteBarrierCounterGranularity);
+    }
   }
 
   marking->RecordWrite(obj, slot, *slot);
@@ -162,7 +179,11 @@ void IncrementalMarking::BlackToGreyAndUnshift(HeapObject* obj,
   DCHECK(Marking::MarkBitFrom(obj) == mark_bit);
   DCHECK(obj->Size() >= 2 * kPointerSize);
   DCHECK(IsMarking());
-  Marking::BlackToGrey(mark_bit);
+  if (FLAG_concurrent_marking) {
+    Marking::BlackToGreyAtomic(mark_bit);
+  } else {
+    Marking::BlackToGrey(mark_bit);
+  }
   int obj_size = obj->Size();
   MemoryChunk::IncrementLiveBytesFromGC(obj, -obj_size);
   bytes_scanned_ -= obj_size;
@@ -189,7 +210,9 @@ void IncrementalMarking::BlackToGreyAndUnshift(HeapObject* obj,
 
 
 void IncrementalMarking::WhiteToGreyAndPush(HeapObject* obj, MarkBit mark_bit) {
-  Marking::WhiteToGrey(mark_bit);
+  // The concurrent marker may have greyed the object in the meantime, in
+  // which case it also took care of pushing it.
+  if (!Marking::TryWhiteToGrey(mark_bit)) return;
   heap_->mark_compact_collector()->marking_deque()->Push(obj);
 }
 
@@ -201,7 +224,11 @@ static void MarkObjectGreyDoNotEnqueue(Object* obj) {
     if (Marking::IsBlack(mark_bit)) {
       MemoryChunk::IncrementLiveBytesFromGC(heap_obj, -heap_obj->Size());
     }
-    Marking::AnyToGrey(mark_bit);
+    if (FLAG_concurrent_marking) {
+      Marking::AnyToGreyAtomic(mark_bit);
+    } else {
+      Marking::AnyToGrey(mark_bit);
+    }
   }
 }
 
@@ -210,7 +237,11 @@ static inline void MarkBlackOrKeepBlack(HeapObject* heap_object,
                                         MarkBit mark_bit, int size) {
   DCHECK(!Marking::IsImpossible(mark_bit));
   if (Marking::IsBlack(mark_bit)) return;
-  Marking::MarkBlack(mark_bit);
+  if (FLAG_concurrent_marking) {
+    Marking::MarkBlackAtomic(mark_bit);
+  } else {
+    Marking::MarkBlack(mark_bit);
+  }
   MemoryChunk::IncrementLiveBytesFromGC(heap_object, size);
 }
 
@@ -315,7 +346,11 @@ class IncrementalMarkingMarkingVisitor
     HeapObject* heap_object = HeapObject::cast(obj);
     MarkBit mark_bit = Marking::MarkBitFrom(heap_object);
     if (Marking::IsWhite(mark_bit)) {
-      Marking::MarkBlack(mark_bit);
+      if (FLAG_concurrent_marking) {
+        Marking::MarkBlackAtomic(mark_bit);
+      } else {
+        Marking::MarkBlack(mark_bit);
+      }
       MemoryChunk::IncrementLiveBytesFromGC(heap_object, heap_object->Size());
       return true;
     }
@@ -359,6 +394,11 @@ void IncrementalMarking::SetOldSpacePageFlags(MemoryChunk* chunk,
   if (is_marking) {
     chunk->SetFlag(MemoryChunk::POINTERS_TO_HERE_ARE_INTERESTING);
     chunk->SetFlag(MemoryChunk::POINTERS_FROM_HERE_ARE_INTERESTING);
+    // The record write stub only calls into the runtime for black hosts
+    // unless the write barrier counter of the page is exhausted. With
+    // concurrent marking every write has to be reported, so the counter is
+    // kept at zero while marking (see RecordWriteFromCode).
+    if (FLAG_concurrent_marking) chunk->set_write_barrier_counter(0);
   } else {
     chunk->ClearFlag(MemoryChunk::POINTERS_TO_HERE_ARE_INTERESTING);
     chunk->SetFlag(MemoryChunk::POINTERS_FROM_HERE_ARE_INTERESTING);
@@ -371,6 +411,7 @@ void IncrementalMarking::SetNewSpacePageFlags(MemoryChunk* chunk,
   chunk->SetFlag(MemoryChunk::POINTERS_TO_HERE_ARE_INTERESTING);
   if (is_marking) {
     chunk->SetFlag(MemoryChunk::POINTERS_FROM_HERE_ARE_INTERESTING);
+    if (FLAG_concurrent_marking) chunk->set_write_barrier_counter(0);
   } else {
     chunk->ClearFlag(MemoryChunk::POINTERS_FROM_HERE_ARE_INTERESTING);
   }
@@ -575,6 +616,11 @@ void IncrementalMarking::StartMarking() {
   heap_->mark_compact_collector()->EnsureMarkingDequeIsCommittedAndInitialize(
       MarkCompactCollector::kMaxMarkingDequeSize);
 
+  if (FLAG_concurrent_marking) {
+    concurrent_marking_.ResetStatistics();
+    main_thread_marked_bytes_ = 0;
+  }
+
   ActivateIncrementalWriteBarrier();
 
 // Marking bits are cleared by the sweeper.
@@ -877,11 +923,18 @@ intptr_t IncrementalMarking::ProcessMarkingDeque(intptr_t bytes_to_process) {
     if (map == one_pointer_filler_map || map == two_pointer_filler_map)
       continue;
 
+    if (FLAG_concurrent_marking &&
+        ConcurrentMarking::CanVisitConcurrently(obj, map)) {
+      concurrent_marking_.Push(obj);
+      continue;
+    }
+
     int size = obj->SizeFromMap(map);
     unscanned_bytes_of_large_object_ = 0;
     VisitObject(map, obj, size);
     bytes_processed += size - unscanned_bytes_of_large_object_;
   }
+  main_thread_marked_bytes_ += bytes_processed;
   return bytes_processed;
 }
 
@@ -898,12 +951,22 @@ void IncrementalMarking::ProcessMarkingDeque() {
     Map* map = obj->map();
     if (map == filler_map) continue;
 
-    VisitObject(map, obj, obj->SizeFromMap(map));
+    int size = obj->SizeFromMap(map);
+    VisitObject(map, obj, size);
+    main_thread_marked_bytes_ += size;
   }
 }
 
 
 void IncrementalMarking::Hurry() {
+  if (FLAG_concurrent_marking) {
+    // Take over the remaining work of the background marker.
+    concurrent_marking_.Stop();
+    if (!heap_->mark_compact_collector()->marking_deque()->IsEmpty()) {
+      RestartIfNotMarking();
+    }
+  }
+
   if (state() == MARKING) {
     double start = 0.0;
     if (FLAG_trace_incremental_marking || FLAG_print_cumulative_gc_stat) {
@@ -927,6 +990,10 @@ void IncrementalMarking::Hurry() {
     }
   }
 
+  if (FLAG_concurrent_marking && FLAG_trace_incremental_marking) {
+    PrintConcurrentMarkingStatistics();
+  }
+
   if (FLAG_cleanup_code_caches_at_gc) {
     PolymorphicCodeCache* poly_cache = heap_->polymorphic_code_cache();
     Marking::GreyToBlack(Marking::MarkBitFrom(poly_cache));
@@ -958,6 +1025,7 @@ void IncrementalMarking::Stop() {
     PrintF("[IncrementalMarking] Stopping.\n");
   }
 
+  if (FLAG_concurrent_marking) concurrent_marking_.Stop();
   heap_->new_space()->RemoveAllocationObserver(&observer_);
   IncrementalMarking::set_should_hurry(false);
   ResetStepCounters();
@@ -1188,8 +1256,17 @@ intptr_t IncrementalMarking::Step(intptr_t allocated_bytes,
         StartMarking();
       }
     } else if (state_ == MARKING) {
+      MarkingDeque* marking_deque =
+          heap_->mark_compact_collector()->marking_deque();
+      if (FLAG_concurrent_marking) {
+        concurrent_marking_.FlushBailouts(marking_deque);
+      }
       bytes_processed = ProcessMarkingDeque(bytes_to_process);
-      if (heap_->mark_compact_collector()->marking_deque()->IsEmpty()) {
+      if (FLAG_concurrent_marking) concurrent_marking_.ScheduleTasks();
+      // With concurrent marking, marking is only complete once the background
+      // tasks ran out of work as well.
+      if (marking_deque->IsEmpty() &&
+          (!FLAG_concurrent_marking || concurrent_marking_.IsIdle())) {
         if (completion == FORCE_COMPLETION ||
             IsIdleMarkingDelayCounterLimitReached()) {
           if (!finalize_marking_completed_) {
@@ -1251,5 +1328,20 @@ void IncrementalMarking::IncrementIdleMarkingDelayCounter() {
 void IncrementalMarking::ClearIdleMarkingDelayCounter() {
   idle_marking_delay_counter_ = 0;
 }
+
+
+void IncrementalMarking::PrintConcurrentMarkingStatistics() {
+  intptr_t concurrent_kb = concurrent_marking_.marked_bytes() / KB;
+  intptr_t main_thread_kb = main_thread_marked_bytes_ / KB;
+  intptr_t total_kb = concurrent_kb + main_thread_kb;
+  PrintF(
+      "[IncrementalMarking] Concurrent marking: marked %d KB off-thread "
+      "(%d objects, %d%%), %d KB on the main thread, %d bailouts.\n",
+      static_cast<int>(concurrent_kb),
+      static_cast<int>(concurrent_marking_.marked_objects()),
+      total_kb > 0 ? static_cast<int>(concurrent_kb * 100 / total_kb) : 0,
+      static_cast<int>(main_thread_kb),
+      static_cast<int>(concurrent_marking_.bailouts()));
+}
 }  // namespace internal
 }  // namespace v8
@@ -7,6 +7,7 @@
 
 #include "src/cancelable-task.h"
 #include "src/execution.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking-job.h"
 #include "src/heap/spaces.h"
@@ -218,6 +219,8 @@ class IncrementalMarking {
     return &incremental_marking_job_;
   }
 
+  ConcurrentMarking* concurrent_marking() { return &concurrent_marking_; }
+
  private:
   class Observer : public AllocationObserver {
    public:
@@ -270,6 +273,8 @@ class IncrementalMarking {
 
   void IncrementIdleMarkingDelayCounter();
 
+  void PrintConcurrentMarkingStatistics();
+
   Heap* heap_;
 
   Observer observer_;
@@ -302,6 +307,12 @@ class IncrementalMarking {
 
   IncrementalMarkingJob incremental_marking_job_;
 
+  ConcurrentMarking concurrent_marking_;
+
+  // Bytes marked on the main thread in the current cycle. Only maintained
+  // with --concurrent-marking for --trace-incremental-marking.
+  intptr_t main_thread_marked_bytes_;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(IncrementalMarking);
 };
 }  // namespace internal
@@ -60,6 +60,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       heap_(heap),
       marking_deque_memory_(NULL),
       marking_deque_memory_committed_(0),
+      parallel_marking_(this),
       code_flusher_(nullptr),
       have_code_to_deoptimize_(false),
       compacting_(false),
@@ -1850,22 +1851,38 @@ void MarkCompactCollector::MarkImplicitRefGroups(
 // marking stack have been marked, or are overflowed in the heap.
 void MarkCompactCollector::EmptyMarkingDeque() {
   Map* filler_map = heap_->one_pointer_filler_map();
-  while (!marking_deque_.IsEmpty()) {
-    HeapObject* object = marking_deque_.Pop();
-    // Explicitly skip one word fillers. Incremental markbit patterns are
-    // correct only for objects that occupy at least two words.
-    Map* map = object->map();
-    if (map == filler_map) continue;
+  // Object statistics are only collected by the sequential visitor.
+  bool parallel = FLAG_parallel_marking && !FLAG_track_gc_object_stats;
+  do {
+    while (!marking_deque_.IsEmpty()) {
+      HeapObject* object = marking_deque_.Pop();
+      // Explicitly skip one word fillers. Incremental markbit patterns are
+      // correct only for objects that occupy at least two words.
+      Map* map = object->map();
+      if (map == filler_map) continue;
 
-    DCHECK(object->IsHeapObject());
-    DCHECK(heap()->Contains(object));
-    DCHECK(!Marking::IsWhite(Marking::MarkBitFrom(object)));
+      DCHECK(object->IsHeapObject());
+      DCHECK(heap()->Contains(object));
+      DCHECK(!Marking::IsWhite(Marking::MarkBitFrom(object)));
 
-    MarkBit map_mark = Marking::MarkBitFrom(map);
-    MarkObject(map, map_mark);
+      if (parallel && ParallelMarking::CanVisitInParallel(map)) {
+        parallel_marking_.Push(object);
+        continue;
+      }
 
-    MarkCompactMarkingVisitor::IterateBody(map, object);
-  }
+      MarkBit map_mark = Marking::MarkBitFrom(map);
+      MarkObject(map, map_mark);
+
+      MarkCompactMarkingVisitor::IterateBody(map, object);
+    }
+    if (parallel && !parallel_marking_.IsEmpty()) {
+      // Objects that need special visitation are pushed back onto the
+      // marking deque.
+      GCTracer::Scope gc_scope(heap()->tracer(),
+                               GCTracer::Scope::MC_MARK_PARALLEL);
+      parallel_marking_.ProcessObjects();
+    }
+  } while (!marking_deque_.IsEmpty());
 }
 
 
@@ -2107,6 +2124,8 @@ void MarkCompactCollector::MarkLiveObjects() {
     ProcessEphemeralMarking(&root_visitor, true);
   }
 
+  heap_->tracer()->AddParallelMarkingEvent(parallel_marking_.TakeMaxThreads());
+
   if (FLAG_print_cumulative_gc_stat) {
     heap_->tracer()->AddMarkingTime(heap_->MonotonicallyIncreasingTimeInMs() -
                                     start_time);
@@ -3696,50 +3715,244 @@ void MarkCompactCollector::EvacuateNewSpaceAndCandidates() {
 }
 
 
-void MarkCompactCollector::UpdatePointersAfterEvacuation() {
-  GCTracer::Scope gc_scope(heap()->tracer(),
-                           GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS);
+// Work list for updating pointers after evacuation. An item is a slots
+// buffer, the old-to-new remembered set of a chunk, or a to-space page. Items
+// are claimed by bumping an atomic index, so each one is processed by exactly
+// one thread. Slots are updated with a compare-and-swap (see
+// PointersUpdatingVisitor::UpdateSlot), since a slot may be recorded in more
+// than one item.
+class MarkCompactCollector::PointersUpdatingJob {
+ public:
+  explicit PointersUpdatingJob(MarkCompactCollector* collector)
+      : collector_(collector), next_item_(0) {}
+
+  void AddSlotsBufferChain(SlotsBuffer* buffer) {
+    for (; buffer != NULL; buffer = buffer->next()) {
+      items_.Add(Item(SLOTS_BUFFER, buffer));
+    }
+  }
+
+  void AddOldToNewChunk(MemoryChunk* chunk) {
+    items_.Add(Item(OLD_TO_NEW_CHUNK, chunk));
+  }
+
+  void AddToSpacePage(NewSpacePage* page) {
+    items_.Add(Item(TO_SPACE_PAGE, page));
+  }
+
+  int length() const { return items_.length(); }
+
+  // Processes items until none are left. Called on every participating
+  // thread.
+  void Run() {
+    Heap* heap = collector_->heap();
+    PointersUpdatingVisitor visitor(heap);
+    Address to_space_top = heap->new_space()->top();
+    while (true) {
+      int index = base::NoBarrier_AtomicIncrement(&next_item_, 1) - 1;
+      if (index >= items_.length()) return;
+      const Item& item = items_[index];
+      switch (item.type) {
+        case SLOTS_BUFFER:
+          collector_->UpdateSlots(static_cast<SlotsBuffer*>(item.data));
+          break;
+        case OLD_TO_NEW_CHUNK:
+          RememberedSet<OLD_TO_NEW>::IterateChunkWithWrapper(
+              heap, static_cast<MemoryChunk*>(item.data), UpdatePointer);
+          break;
+        case TO_SPACE_PAGE:
+          UpdateToSpacePage(static_cast<NewSpacePage*>(item.data),
+                            to_space_top, &visitor);
+          break;
+      }
+    }
+  }
+
+ private:
+  enum ItemType { SLOTS_BUFFER, OLD_TO_NEW_CHUNK, TO_SPACE_PAGE };
+
+  struct Item {
+    Item(ItemType type, void* data) : type(type), data(data) {}
+    ItemType type;
+    void* data;
+  };
+
+  static void UpdateToSpacePage(NewSpacePage* page, Address top,
+                                PointersUpdatingVisitor* visitor) {
+    Address current = page->area_start();
+    Address limit =
+        (page == NewSpacePage::FromLimit(top)) ? top : page->area_end();
+    while (current < limit) {
+      HeapObject* object = HeapObject::FromAddress(current);
+      Map* map = object->map();
+      int size = object->SizeFromMap(map);
+      if (!object->IsFiller()) {
+        object->IterateBody(map->instance_type(), size, visitor);
+      }
+      current += size;
+    }
+  }
+
+  MarkCompactCollector* collector_;
+  List<Item> items_;
+  base::Atomic32 next_item_;
+
+  DISALLOW_COPY_AND_ASSIGN(PointersUpdatingJob);
+};
+
+
+class MarkCompactCollector::PointersUpdatingTask : public CancelableTask {
+ public:
+  PointersUpdatingTask(Heap* heap, PointersUpdatingJob* job,
+                       base::Semaphore* on_finish)
+      : CancelableTask(heap->isolate()), job_(job), on_finish_(on_finish) {}
+
+  virtual ~PointersUpdatingTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    job_->Run();
+    on_finish_->Signal();
+  }
+
+  PointersUpdatingJob* job_;
+  base::Semaphore* on_finish_;
+
+  DISALLOW_COPY_AND_ASSIGN(PointersUpdatingTask);
+};
+
+
+int MarkCompactCollector::NumberOfPointerUpdatingTasks(int items) {
+  if (!FLAG_parallel_pointer_update) return 1;
+  // Items vary in size, so every task should get a few of them to balance
+  // the load.
+  const int kItemsPerTask = 8;
+  const int kMaxTasks = 8;
+  int tasks = 1 + items / kItemsPerTask;
+  int available_threads = 1 + static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  int cores = Max(1, base::SysInfo::NumberOfProcessors());
+  return Min(Min(tasks, kMaxTasks), Min(available_threads, cores));
+}
+
+
+void MarkCompactCollector::UpdatePointersInParallel(
+    PointersUpdatingVisitor* updating_visitor) {
+  GCTracer::Scope gc_scope(
+      heap()->tracer(), GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_PARALLEL);
+  // Roots are updated before any task starts. Stack iteration looks up code
+  // objects by pc and should not race with the patching of code targets.
+  heap_->IterateRoots(updating_visitor, VISIT_ALL_IN_SWEEP_NEWSPACE);
+
+  PointersUpdatingJob job(this);
+  job.AddSlotsBufferChain(migration_slots_buffer_);
+  for (int i = 0; i < evacuation_slots_buffers_.length(); i++) {
+    job.AddSlotsBufferChain(evacuation_slots_buffers_[i]);
+  }
+  for (Page* p : evacuation_candidates_) {
+    if (p->IsEvacuationCandidate()) job.AddSlotsBufferChain(p->slots_buffer());
+  }
   {
-    GCTracer::Scope gc_scope(
-        heap()->tracer(),
-        GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_TO_EVACUATED);
-    UpdateSlotsRecordedIn(migration_slots_buffer_);
-    if (FLAG_trace_fragmentation_verbose) {
-      PrintF("  migration slots buffer: %d\n",
-             SlotsBuffer::SizeOfChain(migration_slots_buffer_));
+    PointerChunkIterator it(heap());
+    MemoryChunk* chunk;
+    while ((chunk = it.next()) != nullptr) {
+      if (RememberedSet<OLD_TO_NEW>::HasSlots(chunk)) {
+        job.AddOldToNewChunk(chunk);
+      }
     }
-    slots_buffer_allocator_->DeallocateChain(&migration_slots_buffer_);
-    DCHECK(migration_slots_buffer_ == NULL);
+  }
+  NewSpace* new_space = heap()->new_space();
+  NewSpacePageIterator it(new_space->bottom(), new_space->top());
+  while (it.has_next()) {
+    job.AddToSpacePage(it.next());
+  }
 
-    // TODO(hpayer): Process the slots buffers in parallel. This has to be done
-    // after evacuation of all pages finishes.
-    int buffers = evacuation_slots_buffers_.length();
-    for (int i = 0; i < buffers; i++) {
-      SlotsBuffer* buffer = evacuation_slots_buffers_[i];
-      UpdateSlotsRecordedIn(buffer);
-      slots_buffer_allocator_->DeallocateChain(&buffer);
+  const int num_tasks = NumberOfPointerUpdatingTasks(job.length());
+  base::Semaphore pending_tasks(0);
+  uint32_t* task_ids = new uint32_t[num_tasks];
+  for (int i = 1; i < num_tasks; i++) {
+    PointersUpdatingTask* task =
+        new PointersUpdatingTask(heap(), &job, &pending_tasks);
+    task_ids[i] = task->id();
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+
+  // Contribute on the main thread.
+  job.Run();
+
+  // Tasks that have not started yet are not needed anymore.
+  for (int i = 1; i < num_tasks; i++) {
+    if (!isolate()->cancelable_task_manager()->TryAbort(task_ids[i])) {
+      pending_tasks.Wait();
     }
-    evacuation_slots_buffers_.Rewind(0);
   }
+  delete[] task_ids;
+  heap()->tracer()->AddParallelPointerUpdateEvent(num_tasks);
 
-  // Second pass: find pointers to new space and update them.
+  if (FLAG_trace_fragmentation_verbose) {
+    PrintF("  migration slots buffer: %d\n",
+           SlotsBuffer::SizeOfChain(migration_slots_buffer_));
+  }
+  slots_buffer_allocator_->DeallocateChain(&migration_slots_buffer_);
+  DCHECK(migration_slots_buffer_ == NULL);
+  for (int i = 0; i < evacuation_slots_buffers_.length(); i++) {
+    SlotsBuffer* buffer = evacuation_slots_buffers_[i];
+    slots_buffer_allocator_->DeallocateChain(&buffer);
+  }
+  evacuation_slots_buffers_.Rewind(0);
+}
+
+
+void MarkCompactCollector::UpdatePointersAfterEvacuation() {
+  GCTracer::Scope gc_scope(heap()->tracer(),
+                           GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS);
   PointersUpdatingVisitor updating_visitor(heap());
+  const bool parallel = FLAG_parallel_pointer_update;
 
-  {
-    GCTracer::Scope gc_scope(
-        heap()->tracer(), GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_TO_NEW);
-    // Update pointers in to space.
-    SemiSpaceIterator to_it(heap()->new_space());
-    for (HeapObject* object = to_it.Next(); object != NULL;
-         object = to_it.Next()) {
-      Map* map = object->map();
-      object->IterateBody(map->instance_type(), object->SizeFromMap(map),
-                          &updating_visitor);
+  if (parallel) {
+    UpdatePointersInParallel(&updating_visitor);
+  } else {
+    {
+      GCTracer::Scope gc_scope(
+          heap()->tracer(),
+          GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_TO_EVACUATED);
+      UpdateSlotsRecordedIn(migration_slots_buffer_);
+      if (FLAG_trace_fragmentation_verbose) {
+        PrintF("  migration slots buffer: %d\n",
+               SlotsBuffer::SizeOfChain(migration_slots_buffer_));
+      }
+      slots_buffer_allocator_->DeallocateChain(&migration_slots_buffer_);
+      DCHECK(migration_slots_buffer_ == NULL);
+
+      int buffers = evacuation_slots_buffers_.length();
+      for (int i = 0; i < buffers; i++) {
+        SlotsBuffer* buffer = evacuation_slots_buffers_[i];
+        UpdateSlotsRecordedIn(buffer);
+        slots_buffer_allocator_->DeallocateChain(&buffer);
+      }
+      evacuation_slots_buffers_.Rewind(0);
     }
-    // Update roots.
-    heap_->IterateRoots(&updating_visitor, VISIT_ALL_IN_SWEEP_NEWSPACE);
 
-    RememberedSet<OLD_TO_NEW>::IterateWithWrapper(heap_, UpdatePointer);
+    // Second pass: find pointers to new space and update them.
+    {
+      GCTracer::Scope gc_scope(
+          heap()->tracer(),
+          GCTracer::Scope::MC_EVACUATE_UPDATE_POINTERS_TO_NEW);
+      // Update pointers in to space.
+      SemiSpaceIterator to_it(heap()->new_space());
+      for (HeapObject* object = to_it.Next(); object != NULL;
+           object = to_it.Next()) {
+        Map* map = object->map();
+        object->IterateBody(map->instance_type(), object->SizeFromMap(map),
+                            &updating_visitor);
+      }
+      // Update roots.
+      heap_->IterateRoots(&updating_visitor, VISIT_ALL_IN_SWEEP_NEWSPACE);
+
+      RememberedSet<OLD_TO_NEW>::IterateWithWrapper(heap_, UpdatePointer);
+    }
   }
 
   {
@@ -3751,7 +3964,8 @@ void MarkCompactCollector::UpdatePointersAfterEvacuation() {
              p->IsFlagSet(Page::RESCAN_ON_EVACUATION));
 
       if (p->IsEvacuationCandidate()) {
-        UpdateSlotsRecordedIn(p->slots_buffer());
+        // The parallel phase has already updated the slots of the page.
+        if (!parallel) UpdateSlotsRecordedIn(p->slots_buffer());
         if (FLAG_trace_fragmentation_verbose) {
           PrintF("  page %p slots buffer: %d\n", reinterpret_cast<void*>(p),
                  SlotsBuffer::SizeOfChain(p->slots_buffer()));
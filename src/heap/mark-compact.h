@@ -6,6 +6,7 @@
 #define V8_HEAP_MARK_COMPACT_H_
 
 #include "src/base/bits.h"
+#include "src/heap/parallel-marking.h"
 #include "src/heap/spaces.h"
 #include "src/heap/store-buffer.h"
 
@@ -24,6 +25,7 @@ typedef void (*MarkObjectFunction)(Heap* heap, HeapObject* object);
 class CodeFlusher;
 class MarkCompactCollector;
 class MarkingVisitor;
+class PointersUpdatingVisitor;
 class RootMarkingVisitor;
 class SlotsBuffer;
 class SlotsBufferAllocator;
@@ -112,6 +114,40 @@ class Marking : public AllStatic {
     markbit.Next().Set();
   }
 
+  // The following transitions may race with the concurrent and parallel
+  // markers. They update the mark bits atomically and return false if
+  // another thread already changed the color.
+  INLINE(static bool TryWhiteToGrey(MarkBit markbit)) {
+    return markbit.TrySet();
+  }
+
+  INLINE(static bool TryGreyToBlack(MarkBit markbit)) {
+    return markbit.Get() && markbit.Next().TrySet();
+  }
+
+  INLINE(static bool TryWhiteToBlack(MarkBit markbit)) {
+    if (!markbit.TrySet()) return false;
+    markbit.Next().SetAtomic();
+    return true;
+  }
+
+  // Atomic versions of transitions the main thread makes while the
+  // concurrent marker runs.
+  INLINE(static void MarkBlackAtomic(MarkBit markbit)) {
+    markbit.SetAtomic();
+    markbit.Next().SetAtomic();
+  }
+
+  INLINE(static void BlackToGreyAtomic(MarkBit markbit)) {
+    DCHECK(IsBlack(markbit));
+    markbit.Next().ClearAtomic();
+  }
+
+  INLINE(static void AnyToGreyAtomic(MarkBit markbit)) {
+    markbit.SetAtomic();
+    markbit.Next().ClearAtomic();
+  }
+
   INLINE(static void BlackToGrey(HeapObject* obj)) {
     BlackToGrey(MarkBitFrom(obj));
   }
@@ -513,6 +549,8 @@ class MarkCompactCollector {
   class EvacuateVisitorBase;
   class Evacuator;
   class HeapObjectVisitor;
+  class PointersUpdatingJob;
+  class PointersUpdatingTask;
   class SweeperTask;
 
   typedef std::vector<Page*> SweepingList;
@@ -570,6 +608,7 @@ class MarkCompactCollector {
   friend class IncrementalMarkingMarkingVisitor;
   friend class MarkCompactMarkingVisitor;
   friend class MarkingVisitor;
+  friend class ParallelMarking;
   friend class RecordMigratedSlotVisitor;
   friend class RootMarkingVisitor;
   friend class SharedFunctionInfoMarkingVisitor;
@@ -722,6 +761,14 @@ class MarkCompactCollector {
 
   void UpdatePointersAfterEvacuation();
 
+  // The number of tasks, including the main thread, used to update pointers
+  // after evacuation.
+  int NumberOfPointerUpdatingTasks(int items);
+
+  // Updates recorded slots, old-to-new slots, pointers in to-space and roots
+  // on the main thread and background tasks. Slots buffers are released.
+  void UpdatePointersInParallel(PointersUpdatingVisitor* updating_visitor);
+
   // Iterates through all live objects on a page using marking information.
   // Returns whether all objects have successfully been visited.
   bool VisitLiveObjects(MemoryChunk* page, HeapObjectVisitor* visitor,
@@ -768,6 +815,7 @@ class MarkCompactCollector {
   base::VirtualMemory* marking_deque_memory_;
   size_t marking_deque_memory_committed_;
   MarkingDeque marking_deque_;
+  ParallelMarking parallel_marking_;
   CodeFlusher* code_flusher_;
   bool have_code_to_deoptimize_;
 
@@ -0,0 +1,392 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/parallel-marking.h"
+
+#include "src/base/sys-info.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/mark-compact-inl.h"
+#include "src/heap/objects-visiting-inl.h"
+#include "src/heap/spaces-inl.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+// Per-thread marking state. Only the owner touches the local stack; the
+// shared deque is guarded by |mutex_| and may be stolen from by other
+// workers.
+class ParallelMarking::Worker {
+ public:
+  explicit Worker(ParallelMarking* parallel_marking)
+      : parallel_marking_(parallel_marking),
+        shared_size_(0),
+        live_bytes_(HashMap::PointersMatch) {}
+
+  // Only valid while no background task is running.
+  bool IsEmpty() { return local_.empty() && shared_.empty(); }
+
+  size_t local_size() { return local_.size(); }
+
+  bool HasSharedWork() { return base::Acquire_Load(&shared_size_) > 0; }
+
+  // Pushes an object that was marked and accounted for by the caller.
+  void Push(HeapObject* object) {
+    local_.push_back(object);
+    // Only share work if somebody is waiting for it.
+    if (local_.size() > kMaxLocalWork &&
+        base::Acquire_Load(&parallel_marking_->idle_workers_) > 0) {
+      Share();
+    }
+  }
+
+  bool Pop(HeapObject** object) {
+    if (local_.empty()) {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      if (shared_.empty()) return false;
+      local_.swap(shared_);
+      base::Release_Store(&shared_size_, 0);
+    }
+    *object = local_.back();
+    local_.pop_back();
+    return true;
+  }
+
+  // Moves the oldest half of the shared deque of |this| to |thief|.
+  bool StealInto(Worker* thief) {
+    DCHECK(thief->local_.empty());
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (shared_.empty()) return false;
+    size_t count = (shared_.size() + 1) / 2;
+    thief->local_.insert(thief->local_.end(), shared_.begin(),
+                         shared_.begin() + count);
+    shared_.erase(shared_.begin(), shared_.begin() + count);
+    base::Release_Store(&shared_size_, static_cast<int>(shared_.size()));
+    return true;
+  }
+
+  void VisitObject(HeapObject* object) {
+    DCHECK(Marking::IsBlack(Marking::MarkBitFrom(object)));
+    Map* map = object->map();
+    MarkObject(map);
+    Visitor visitor(this, object);
+    int size = object->SizeFromMap(map);
+    // Same body iteration as the corresponding StaticMarkingVisitor callbacks.
+    int id = map->visitor_id();
+    if (id == StaticVisitorBase::kVisitFixedArray) {
+      FixedArray::BodyDescriptor::IterateBody(object, size, &visitor);
+    } else if (id >= StaticVisitorBase::kVisitJSObject &&
+               id <= StaticVisitorBase::kVisitJSObjectGeneric) {
+      JSObject::BodyDescriptor::IterateBody(object, size, &visitor);
+    } else if (id >= StaticVisitorBase::kVisitStruct &&
+               id <= StaticVisitorBase::kVisitStructGeneric) {
+      StructBodyDescriptor::IterateBody(object, size, &visitor);
+    }
+  }
+
+  void MarkObject(HeapObject* object) {
+    MarkBit mark_bit = Marking::MarkBitFrom(object);
+    if (!Marking::TryWhiteToBlack(mark_bit)) return;
+    Map* map = object->map();
+    if (CanVisitInParallel(map)) {
+      IncrementLiveBytes(MemoryChunk::FromAddress(object->address()),
+                         object->SizeFromMap(map));
+      Push(object);
+    } else {
+      // Live bytes are accounted for when the object is pushed to the marking
+      // deque.
+      bailouts_.push_back(object);
+    }
+  }
+
+  void RecordSlot(HeapObject* host, Object** slot) {
+    recorded_slots_.push_back(RecordedSlot(host, slot));
+  }
+
+  std::vector<HeapObject*>* bailouts() { return &bailouts_; }
+  std::vector<RecordedSlot>* recorded_slots() { return &recorded_slots_; }
+  HashMap* live_bytes() { return &live_bytes_; }
+
+ private:
+  class Visitor : public ObjectVisitor {
+   public:
+    Visitor(Worker* worker, HeapObject* host) : worker_(worker), host_(host) {}
+
+    void VisitPointers(Object** start, Object** end) override {
+      for (Object** p = start; p < end; p++) {
+        Object* value = *p;
+        if (!value->IsHeapObject()) continue;
+        HeapObject* target = HeapObject::cast(value);
+        if (Page::FromAddress(target->address())->IsEvacuationCandidate()) {
+          worker_->RecordSlot(host_, p);
+        }
+        worker_->MarkObject(target);
+      }
+    }
+
+   private:
+    Worker* worker_;
+    HeapObject* host_;
+  };
+
+  // Moves the oldest half of the local stack to the shared deque.
+  void Share() {
+    size_t count = local_.size() / 2;
+    {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      shared_.insert(shared_.end(), local_.begin(), local_.begin() + count);
+      local_.erase(local_.begin(), local_.begin() + count);
+      base::Release_Store(&shared_size_, static_cast<int>(shared_.size()));
+    }
+    parallel_marking_->NotifyIdleWorkers();
+  }
+
+  void IncrementLiveBytes(MemoryChunk* chunk, intptr_t by) {
+    uint32_t hash = static_cast<uint32_t>(
+        reinterpret_cast<uintptr_t>(chunk) >> kPageSizeBits);
+    HashMap::Entry* entry = live_bytes_.LookupOrInsert(chunk, hash);
+    entry->value = reinterpret_cast<void*>(
+        reinterpret_cast<intptr_t>(entry->value) + by);
+  }
+
+  ParallelMarking* parallel_marking_;
+  std::vector<HeapObject*> local_;
+
+  base::Mutex mutex_;
+  std::vector<HeapObject*> shared_;
+  base::Atomic32 shared_size_;
+
+  std::vector<HeapObject*> bailouts_;
+  std::vector<RecordedSlot> recorded_slots_;
+  HashMap live_bytes_;
+
+  DISALLOW_COPY_AND_ASSIGN(Worker);
+};
+
+
+class ParallelMarking::Task : public CancelableTask {
+ public:
+  Task(Isolate* isolate, ParallelMarking* parallel_marking, int index)
+      : CancelableTask(isolate),
+        parallel_marking_(parallel_marking),
+        index_(index) {}
+
+  virtual ~Task() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    base::Barrier_AtomicIncrement(&parallel_marking_->idle_workers_, -1);
+    parallel_marking_->RunWorker(index_);
+    parallel_marking_->pending_tasks_semaphore_.Signal();
+  }
+
+  ParallelMarking* parallel_marking_;
+  int index_;
+
+  DISALLOW_COPY_AND_ASSIGN(Task);
+};
+
+
+ParallelMarking::ParallelMarking(MarkCompactCollector* collector)
+    : collector_(collector),
+      heap_(collector->heap()),
+      num_tasks_(0),
+      tasks_started_(false),
+      max_threads_(0),
+      num_workers_(0),
+      idle_workers_(0),
+      pending_tasks_semaphore_(0) {
+  for (int i = 0; i <= kMaxTasks; i++) {
+    workers_[i] = new Worker(this);
+  }
+}
+
+
+ParallelMarking::~ParallelMarking() {
+  for (int i = 0; i <= kMaxTasks; i++) {
+    delete workers_[i];
+  }
+}
+
+
+bool ParallelMarking::CanVisitInParallel(Map* map) {
+  // Fillers have to be skipped because their mark bits may overlap with the
+  // mark bits of the next object.
+  if (map->instance_type() == FILLER_TYPE) return false;
+  int id = map->visitor_id();
+  switch (id) {
+    case StaticVisitorBase::kVisitFixedArray:
+    case StaticVisitorBase::kVisitFixedDoubleArray:
+    case StaticVisitorBase::kVisitByteArray:
+    case StaticVisitorBase::kVisitSeqOneByteString:
+    case StaticVisitorBase::kVisitSeqTwoByteString:
+      return true;
+    default:
+      return (id >= StaticVisitorBase::kVisitDataObject &&
+              id <= StaticVisitorBase::kVisitDataObjectGeneric) ||
+             (id >= StaticVisitorBase::kVisitJSObject &&
+              id <= StaticVisitorBase::kVisitJSObjectGeneric) ||
+             (id >= StaticVisitorBase::kVisitStruct &&
+              id <= StaticVisitorBase::kVisitStructGeneric);
+  }
+}
+
+
+void ParallelMarking::Push(HeapObject* object) { workers_[0]->Push(object); }
+
+
+bool ParallelMarking::IsEmpty() { return workers_[0]->IsEmpty(); }
+
+
+void ParallelMarking::ProcessObjects() {
+  num_tasks_ = 0;
+  tasks_started_ = false;
+  base::NoBarrier_Store(&num_workers_, 1);
+  base::NoBarrier_Store(&idle_workers_, 0);
+
+  RunWorker(0);
+  JoinTasks();
+
+  for (int i = 0; i <= num_tasks_; i++) {
+    PublishResults(workers_[i]);
+  }
+  max_threads_ = Max(max_threads_, 1 + num_tasks_);
+}
+
+
+int ParallelMarking::TakeMaxThreads() {
+  int result = max_threads_;
+  max_threads_ = 0;
+  return result;
+}
+
+
+void ParallelMarking::PublishResults(Worker* worker) {
+  DCHECK(worker->IsEmpty());
+  for (HeapObject* object : *worker->bailouts()) {
+    collector_->PushBlack(object);
+  }
+  worker->bailouts()->clear();
+
+  for (const RecordedSlot& entry : *worker->recorded_slots()) {
+    collector_->RecordSlot(entry.first, entry.second, *entry.second);
+  }
+  worker->recorded_slots()->clear();
+
+  HashMap* live_bytes = worker->live_bytes();
+  for (HashMap::Entry* entry = live_bytes->Start(); entry != nullptr;
+       entry = live_bytes->Next(entry)) {
+    reinterpret_cast<MemoryChunk*>(entry->key)
+        ->IncrementLiveBytes(
+            static_cast<int>(reinterpret_cast<intptr_t>(entry->value)));
+  }
+  live_bytes->Clear();
+}
+
+
+int ParallelMarking::NumberOfTasks() {
+  int available_threads = static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  // The main thread takes part in marking, too.
+  int cores = base::SysInfo::NumberOfProcessors() - 1;
+  return Max(0, Min(static_cast<int>(kMaxTasks),
+                    Min(available_threads, cores)));
+}
+
+
+void ParallelMarking::StartTasks() {
+  DCHECK(!tasks_started_);
+  tasks_started_ = true;
+  int num_tasks = NumberOfTasks();
+  if (num_tasks == 0) return;
+  // The main thread is busy, so marking cannot terminate while the counters
+  // are updated. Tasks are idle until they start running.
+  base::NoBarrier_Store(&num_workers_, 1 + num_tasks);
+  base::Barrier_AtomicIncrement(&idle_workers_, num_tasks);
+  for (int i = 0; i < num_tasks; i++) {
+    Task* task = new Task(heap_->isolate(), this, i + 1);
+    task_ids_[i] = task->id();
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+  num_tasks_ = num_tasks;
+}
+
+
+void ParallelMarking::JoinTasks() {
+  for (int i = 0; i < num_tasks_; i++) {
+    if (!heap_->isolate()->cancelable_task_manager()->TryAbort(
+            task_ids_[i])) {
+      pending_tasks_semaphore_.Wait();
+    }
+  }
+}
+
+
+void ParallelMarking::RunWorker(int index) {
+  Worker* worker = workers_[index];
+  for (;;) {
+    HeapObject* object;
+    while (worker->Pop(&object)) {
+      worker->VisitObject(object);
+      if (index == 0 && !tasks_started_ &&
+          worker->local_size() >= kMinWorkForTasks) {
+        StartTasks();
+      }
+    }
+    if (Steal(worker)) continue;
+
+    // Out of work. Marking is done once all workers are idle, as only busy
+    // workers can create new work.
+    base::Barrier_AtomicIncrement(&idle_workers_, 1);
+    if (!WaitForWork()) return;
+    base::Barrier_AtomicIncrement(&idle_workers_, -1);
+  }
+}
+
+
+bool ParallelMarking::WaitForWork() {
+  base::LockGuard<base::Mutex> guard(&idle_mutex_);
+  for (;;) {
+    if (base::Acquire_Load(&idle_workers_) ==
+        base::Acquire_Load(&num_workers_)) {
+      // Wake up the other idle workers so that they terminate, too.
+      work_available_.NotifyAll();
+      return false;
+    }
+    if (HasWork()) return true;
+    work_available_.Wait(&idle_mutex_);
+  }
+}
+
+
+void ParallelMarking::NotifyIdleWorkers() {
+  // Taking the lock orders the notification after the check in WaitForWork
+  // of a worker that is about to wait.
+  base::LockGuard<base::Mutex> guard(&idle_mutex_);
+  work_available_.NotifyAll();
+}
+
+
+bool ParallelMarking::Steal(Worker* thief) {
+  int num_workers = base::Acquire_Load(&num_workers_);
+  for (int i = 0; i < num_workers; i++) {
+    Worker* victim = workers_[i];
+    if (victim != thief && victim->StealInto(thief)) return true;
+  }
+  return false;
+}
+
+
+bool ParallelMarking::HasWork() {
+  int num_workers = base::Acquire_Load(&num_workers_);
+  for (int i = 0; i < num_workers; i++) {
+    if (workers_[i]->HasSharedWork()) return true;
+  }
+  return false;
+}
+
+}  // namespace internal
+}  // namespace v8
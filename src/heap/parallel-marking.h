@@ -0,0 +1,118 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PARALLEL_MARKING_H_
+#define V8_HEAP_PARALLEL_MARKING_H_
+
+#include <utility>
+#include <vector>
+
+#include "src/base/atomicops.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/globals.h"
+#include "src/hashmap.h"
+
+namespace v8 {
+namespace internal {
+
+// Forward declarations.
+class Heap;
+class HeapObject;
+class Map;
+class MarkCompactCollector;
+
+// Computes the transitive closure of the marking deque on several threads
+// during the atomic pause of a full mark-compact.
+//
+// Objects with a plain body (fixed arrays, JSObjects, structs and data
+// objects) are handed over by the collector (see CanVisitInParallel) and
+// visited by the main thread together with background tasks. Each task owns
+// a local stack and a stealable deque; idle tasks steal the oldest half of
+// another task's deque. Objects that need the collector's special visitation
+// (maps, code, weak objects, ...) are pushed back to the marking deque and
+// visited by the main thread once the parallel phase is over.
+//
+// Marking an object is a single atomic white-to-black transition, so every
+// object is visited once. Live bytes and recorded slots are accumulated per
+// task and published on the main thread.
+class ParallelMarking {
+ public:
+  // Maximum number of background tasks. The main thread is not counted.
+  static const int kMaxTasks = 7;
+
+  explicit ParallelMarking(MarkCompactCollector* collector);
+  ~ParallelMarking();
+
+  static bool CanVisitInParallel(Map* map);
+
+  // Hands a black object over to the parallel phase. Main thread only.
+  void Push(HeapObject* object);
+
+  bool IsEmpty();
+
+  // Visits all pushed objects and everything reachable from them that can be
+  // visited in parallel. Background tasks are started once the main thread
+  // has enough work to share. Other reachable objects are pushed to the
+  // marking deque.
+  void ProcessObjects();
+
+  // Largest number of threads, main thread included, that took part in a
+  // parallel phase since the last call.
+  int TakeMaxThreads();
+
+ private:
+  class Task;
+  class Worker;
+
+  typedef std::pair<HeapObject*, Object**> RecordedSlot;
+
+  // Background tasks are only started once the main thread has this many
+  // objects on its local stack.
+  static const size_t kMinWorkForTasks = 256;
+  // Local stacks larger than this publish half of their objects.
+  static const size_t kMaxLocalWork = 128;
+
+  int NumberOfTasks();
+  void StartTasks();
+  void JoinTasks();
+  void RunWorker(int index);
+
+  // Moves half of the work of another worker to |thief|. Returns false if
+  // there was nothing to steal.
+  bool Steal(Worker* thief);
+  bool HasWork();
+
+  // Blocks an idle worker until another worker shares work, returning true,
+  // or until all workers are idle, returning false.
+  bool WaitForWork();
+  void NotifyIdleWorkers();
+
+  void PublishResults(Worker* worker);
+
+  MarkCompactCollector* collector_;
+  Heap* heap_;
+
+  Worker* workers_[kMaxTasks + 1];
+  uint32_t task_ids_[kMaxTasks];
+  int num_tasks_;
+  bool tasks_started_;
+  int max_threads_;
+
+  // Termination detection. A worker is idle if it ran out of work and could
+  // not steal any. Tasks count as idle until they start running.
+  base::Atomic32 num_workers_;
+  base::Atomic32 idle_workers_;
+  base::Mutex idle_mutex_;
+  base::ConditionVariable work_available_;
+  base::Semaphore pending_tasks_semaphore_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelMarking);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PARALLEL_MARKING_H_
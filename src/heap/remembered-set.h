@@ -62,20 +62,33 @@ class RememberedSet {
     PointerChunkIterator it(heap);
     MemoryChunk* chunk;
     while ((chunk = it.next()) != nullptr) {
-      SlotSet* slots = GetSlotSet(chunk);
-      if (slots != nullptr) {
-        size_t pages = (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
-        int new_count = 0;
-        for (size_t page = 0; page < pages; page++) {
-          new_count += slots[page].Iterate(callback);
-        }
-        if (new_count == 0) {
-          ReleaseSlotSet(chunk);
-        }
+      IterateChunk(chunk, callback);
+    }
+  }
+
+  // Iterates and filters the remembered set of a single {chunk}. Different
+  // chunks can be iterated concurrently, as long as no slots are inserted
+  // into them at the same time.
+  template <typename Callback>
+  static void IterateChunk(MemoryChunk* chunk, Callback callback) {
+    SlotSet* slots = GetSlotSet(chunk);
+    if (slots != nullptr) {
+      size_t pages = (chunk->size() + Page::kPageSize - 1) / Page::kPageSize;
+      int new_count = 0;
+      for (size_t page = 0; page < pages; page++) {
+        new_count += slots[page].Iterate(callback);
+      }
+      if (new_count == 0) {
+        ReleaseSlotSet(chunk);
       }
     }
   }
 
+  // Returns true if the remembered set of {chunk} may contain slots.
+  static bool HasSlots(MemoryChunk* chunk) {
+    return GetSlotSet(chunk) != nullptr;
+  }
+
   // Iterates and filters the remembered set with the given callback.
   // The callback should take (HeapObject** slot, HeapObject* target) and
   // update the slot.
@@ -89,6 +102,15 @@ class RememberedSet {
     });
   }
 
+  // Same as IterateWithWrapper, restricted to a single {chunk}.
+  template <typename Callback>
+  static void IterateChunkWithWrapper(Heap* heap, MemoryChunk* chunk,
+                                      Callback callback) {
+    IterateChunk(chunk, [heap, callback](Address addr) {
+      return Wrapper(heap, addr, callback);
+    });
+  }
+
   // Eliminates all stale slots from the remembered set, i.e.
   // slots that are not part of live objects anymore. This method must be
   // called after marking, when the whole transitive closure is known and
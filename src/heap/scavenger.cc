@@ -4,13 +4,25 @@
 
 #include "src/heap/scavenger.h"
 
+#include "src/base/atomicops.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/sys-info.h"
+#include "src/cancelable-task.h"
 #include "src/contexts.h"
+#include "src/heap/array-buffer-tracker.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap.h"
 #include "src/heap/objects-visiting-inl.h"
+#include "src/heap/remembered-set.h"
 #include "src/heap/scavenger-inl.h"
+#include "src/heap/spaces-inl.h"
+#include "src/heap/store-buffer-inl.h"
 #include "src/isolate.h"
 #include "src/log.h"
 #include "src/profiler/cpu-profiler.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -403,12 +415,16 @@ void Scavenger::ScavengeObjectSlow(HeapObject** p, HeapObject* object) {
 }
 
 
+bool Scavenger::LoggingAndProfilingEnabled() {
+  return FLAG_verify_predictable || isolate()->logger()->is_logging() ||
+         isolate()->cpu_profiler()->is_profiling() ||
+         (isolate()->heap_profiler() != NULL &&
+          isolate()->heap_profiler()->is_tracking_object_moves());
+}
+
+
 void Scavenger::SelectScavengingVisitorsTable() {
-  bool logging_and_profiling =
-      FLAG_verify_predictable || isolate()->logger()->is_logging() ||
-      isolate()->cpu_profiler()->is_profiling() ||
-      (isolate()->heap_profiler() != NULL &&
-       isolate()->heap_profiler()->is_tracking_object_moves());
+  bool logging_and_profiling = LoggingAndProfilingEnabled();
 
   if (!heap()->incremental_marking()->IsMarking()) {
     if (!logging_and_profiling) {
@@ -445,6 +461,496 @@ void Scavenger::SelectScavengingVisitorsTable() {
 }
 
 
+// Shared pool of objects that still need to be visited during a parallel
+// scavenge. Workers keep a local stack of objects and only publish segments
+// of it when other workers ran out of work. The pool also detects
+// termination, i.e., the point where all registered workers are idle and no
+// work is left.
+class Scavenger::ScavengingWorklist {
+ public:
+  static const int kSegmentSize = 64;
+
+  struct Segment : public Malloced {
+    Segment() : count(0) {}
+
+    int count;
+    HeapObject* objects[kSegmentSize];
+  };
+
+  ScavengingWorklist() : registered_(0), idle_(0), done_(false) {}
+
+  ~ScavengingWorklist() { DCHECK(segments_.is_empty()); }
+
+  // Registers a worker. Returns false if the scavenge already terminated, in
+  // which case the worker must not take part anymore.
+  bool Register() {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (done_) return false;
+    registered_++;
+    return true;
+  }
+
+  void Push(Segment* segment) {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    DCHECK(!done_);
+    segments_.Add(segment);
+    work_available_.NotifyOne();
+  }
+
+  // Returns a published segment, waiting for other workers to publish one if
+  // necessary. Returns nullptr once all registered workers are idle.
+  Segment* Pop() {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    base::NoBarrier_AtomicIncrement(&idle_, 1);
+    while (segments_.is_empty() && !done_) {
+      if (base::NoBarrier_Load(&idle_) == registered_) {
+        done_ = true;
+        work_available_.NotifyAll();
+        break;
+      }
+      work_available_.Wait(&mutex_);
+    }
+    if (done_) return nullptr;
+    base::NoBarrier_AtomicIncrement(&idle_, -1);
+    return segments_.RemoveLast();
+  }
+
+  // Racy check used to decide whether publishing work is worthwhile.
+  bool HasIdleWorkers() { return base::NoBarrier_Load(&idle_) > 0; }
+
+ private:
+  base::Mutex mutex_;
+  base::ConditionVariable work_available_;
+  List<Segment*> segments_;
+  int registered_;
+  base::Atomic32 idle_;
+  bool done_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScavengingWorklist);
+};
+
+
+// State of a single participant of a parallel scavenge. All data that would
+// require synchronization is cached locally and merged back on the main
+// thread in {Finalize}:
+// - copies into to-space are allocated from a local allocation buffer,
+// - promoted objects are allocated in a local compaction space,
+// - old-to-new slots of promoted objects are recorded in a local store buffer,
+// - allocation site feedback is recorded in a local hash map.
+// Objects are forwarded with a compare-and-swap on their map word, so that
+// two workers racing for the same object agree on a single copy.
+class Scavenger::ScavengingWorker : public Malloced {
+ public:
+  ScavengingWorker(Heap* heap, ScavengingWorklist* worklist,
+                   List<MemoryChunk*>* chunks, base::Atomic32* next_chunk)
+      : heap_(heap),
+        worklist_(worklist),
+        chunks_(chunks),
+        next_chunk_(next_chunk),
+        compaction_spaces_(heap),
+        buffer_(LocalAllocationBuffer::InvalidBuffer()),
+        local_store_buffer_(heap),
+        local_pretenuring_feedback_(HashMap::PointersMatch,
+                                    kInitialLocalPretenuringFeedbackCapacity),
+        new_space_exhausted_(false),
+        promoted_size_(0),
+        semispace_copied_size_(0),
+        duration_(0.0) {}
+
+  bool Register() { return worklist_->Register(); }
+
+  // Scavenges the roots. Must be called on the main thread.
+  void ScavengeRoots() {
+    RootVisitor visitor(this);
+    heap_->IterateRoots(&visitor, VISIT_ALL_IN_SCAVENGE);
+  }
+
+  // Scavenges old-to-new slots of unclaimed chunks and then computes the
+  // transitive closure together with the other workers.
+  void Run() {
+    double start = heap_->MonotonicallyIncreasingTimeInMs();
+    for (;;) {
+      int index =
+          base::Barrier_AtomicIncrement(next_chunk_, 1) - 1;
+      if (index >= chunks_->length()) break;
+      RememberedSet<OLD_TO_NEW>::IterateChunkWithWrapper(
+          heap_, chunks_->at(index), [this](HeapObject** slot,
+                                            HeapObject* object) {
+            ScavengeObject(slot, object);
+          });
+      ProcessLocalWorklist();
+    }
+    for (;;) {
+      ProcessLocalWorklist();
+      ScavengingWorklist::Segment* segment = worklist_->Pop();
+      if (segment == nullptr) break;
+      for (int i = 0; i < segment->count; i++) {
+        local_worklist_.Add(segment->objects[i]);
+      }
+      delete segment;
+    }
+    duration_ += heap_->MonotonicallyIncreasingTimeInMs() - start;
+  }
+
+  // Merges back locally cached data. Must be called on the main thread.
+  void Finalize() {
+    DCHECK(local_worklist_.is_empty());
+    // Closing the buffer fills its unused part with a filler object.
+    buffer_ = LocalAllocationBuffer::InvalidBuffer();
+    heap_->old_space()->MergeCompactionSpace(
+        compaction_spaces_.Get(OLD_SPACE));
+    heap_->IncrementPromotedObjectsSize(promoted_size_);
+    heap_->IncrementSemiSpaceCopiedObjectSize(semispace_copied_size_);
+    heap_->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
+    local_store_buffer_.Process(heap_->store_buffer());
+  }
+
+  // Slots of objects that could not be copied.
+  List<HeapObject**>* failed_slots() { return &failed_slots_; }
+
+  intptr_t promoted_size() { return promoted_size_; }
+  intptr_t semispace_copied_size() { return semispace_copied_size_; }
+  double duration() { return duration_; }
+
+ private:
+  static const int kInitialLocalPretenuringFeedbackCapacity = 256;
+  static const intptr_t kLabSize = 8 * KB;
+  static const int kMaxLabObjectSize = 256;
+
+  class RootVisitor : public ObjectVisitor {
+   public:
+    explicit RootVisitor(ScavengingWorker* worker) : worker_(worker) {}
+
+    void VisitPointer(Object** p) override { VisitPointers(p, p + 1); }
+
+    void VisitPointers(Object** start, Object** end) override {
+      for (Object** p = start; p < end; p++) {
+        Object* object = *p;
+        if (!worker_->heap_->InNewSpace(object)) continue;
+        worker_->ScavengeObject(reinterpret_cast<HeapObject**>(p),
+                                reinterpret_cast<HeapObject*>(object));
+      }
+    }
+
+   private:
+    ScavengingWorker* worker_;
+  };
+
+  // Visits the body of an object copied by this worker. Slots of promoted
+  // objects that still point into new space are recorded.
+  class BodyVisitor : public ObjectVisitor {
+   public:
+    BodyVisitor(ScavengingWorker* worker, bool record_slots)
+        : worker_(worker), record_slots_(record_slots) {}
+
+    void VisitPointers(Object** start, Object** end) override {
+      Heap* heap = worker_->heap_;
+      for (Object** p = start; p < end; p++) {
+        Object* object = *p;
+        if (!object->IsHeapObject() || !heap->InFromSpace(object)) continue;
+        worker_->ScavengeObject(reinterpret_cast<HeapObject**>(p),
+                                HeapObject::cast(object));
+        if (record_slots_ && heap->InNewSpace(*p)) {
+          worker_->local_store_buffer_.Record(reinterpret_cast<Address>(p));
+        }
+      }
+    }
+
+    // Code objects never live in new space.
+    void VisitCodeEntry(Address code_entry_slot) override {}
+
+   private:
+    ScavengingWorker* worker_;
+    bool record_slots_;
+  };
+
+  // Same alignment as used by the sequential ScavengingVisitor.
+  static AllocationAlignment RequiredAlignment(Map* map) {
+    InstanceType type = map->instance_type();
+    if (type == FIXED_DOUBLE_ARRAY_TYPE || type == FIXED_FLOAT64_ARRAY_TYPE) {
+      return kDoubleAligned;
+    }
+    return kWordAligned;
+  }
+
+  inline void ScavengeObject(HeapObject** slot, HeapObject* object) {
+    DCHECK(heap_->InFromSpace(object));
+    MapWord map_word = object->synchronized_map_word();
+    if (map_word.IsForwardingAddress()) {
+      *slot = map_word.ToForwardingAddress();
+      return;
+    }
+    Map* map = map_word.ToMap();
+    int size = object->SizeFromMap(map);
+    AllocationAlignment alignment = RequiredAlignment(map);
+
+    HeapObject* target = nullptr;
+    if (!heap_->ShouldBePromoted(object->address(), size)) {
+      target = AllocateInNewSpace(size, alignment);
+    }
+    if (target == nullptr) {
+      AllocationResult allocation =
+          compaction_spaces_.Get(OLD_SPACE)->AllocateRaw(size, alignment);
+      if (!allocation.To(&target)) {
+        // Like the sequential scavenger, keep the object in new space.
+        target = AllocateInNewSpace(size, alignment);
+      }
+    }
+    if (target == nullptr) {
+      // Leave the object to the sequential scavenger, which runs once all
+      // tasks are done and the space they hold has been merged back.
+      failed_slots_.Add(slot);
+      return;
+    }
+
+    heap_->CopyBlock(target->address(), object->address(), size);
+    // Another worker may have forwarded the object after we read its map.
+    target->set_map_word(MapWord::FromMap(map));
+
+    base::AtomicWord old_value = static_cast<base::AtomicWord>(
+        MapWord::FromMap(map).ToRawValue());
+    base::AtomicWord new_value = static_cast<base::AtomicWord>(
+        MapWord::FromForwardingAddress(target).ToRawValue());
+    base::AtomicWord* map_slot = reinterpret_cast<base::AtomicWord*>(
+        object->address() + HeapObject::kMapOffset);
+    if (base::Release_CompareAndSwap(map_slot, old_value, new_value) !=
+        old_value) {
+      // Lost the race. Give up our copy and use the winning one.
+      heap_->CreateFillerObjectAt(target->address(), size);
+      *slot = object->synchronized_map_word().ToForwardingAddress();
+      return;
+    }
+    *slot = target;
+
+    heap_->UpdateAllocationSiteCached(object, map, size,
+                                      &local_pretenuring_feedback_);
+    if (heap_->InNewSpace(target)) {
+      semispace_copied_size_ += size;
+    } else {
+      promoted_size_ += size;
+      if (V8_UNLIKELY(map->instance_type() == JS_ARRAY_BUFFER_TYPE)) {
+        heap_->array_buffer_tracker()->Promote(JSArrayBuffer::cast(target));
+      }
+    }
+    PushLocal(target);
+  }
+
+  void PushLocal(HeapObject* object) {
+    local_worklist_.Add(object);
+    if (local_worklist_.length() >= 2 * ScavengingWorklist::kSegmentSize &&
+        worklist_->HasIdleWorkers()) {
+      ScavengingWorklist::Segment* segment = new ScavengingWorklist::Segment();
+      while (segment->count < ScavengingWorklist::kSegmentSize) {
+        segment->objects[segment->count++] = local_worklist_.RemoveLast();
+      }
+      worklist_->Push(segment);
+    }
+  }
+
+  void ProcessLocalWorklist() {
+    while (!local_worklist_.is_empty()) {
+      HeapObject* object = local_worklist_.RemoveLast();
+      Map* map = object->map();
+      int size = object->SizeFromMap(map);
+      bool in_new_space = heap_->InNewSpace(object);
+      if (in_new_space && map->instance_type() == JS_ARRAY_BUFFER_TYPE &&
+          !JSArrayBuffer::cast(object)->is_external()) {
+        heap_->array_buffer_tracker()->MarkLive(JSArrayBuffer::cast(object));
+      }
+      BodyVisitor visitor(this, !in_new_space);
+      object->IterateBody(map->instance_type(), size, &visitor);
+    }
+  }
+
+  // Returns nullptr if the object cannot be copied within new space.
+  HeapObject* AllocateInNewSpace(int size, AllocationAlignment alignment) {
+    if (new_space_exhausted_) return nullptr;
+    AllocationResult allocation;
+    if (size > kMaxLabObjectSize) {
+      allocation = AllocateInNewSpaceSynchronized(size, alignment);
+    } else {
+      allocation = buffer_.IsValid()
+                       ? buffer_.AllocateRawAligned(size, alignment)
+                       : AllocationResult::Retry(NEW_SPACE);
+      if (allocation.IsRetry()) {
+        AllocationResult lab =
+            AllocateInNewSpaceSynchronized(static_cast<int>(kLabSize),
+                                           kWordAligned);
+        LocalAllocationBuffer saved_old_buffer = buffer_;
+        buffer_ = LocalAllocationBuffer::FromResult(heap_, lab, kLabSize);
+        if (!buffer_.IsValid()) {
+          new_space_exhausted_ = true;
+          return nullptr;
+        }
+        buffer_.TryMerge(&saved_old_buffer);
+        allocation = buffer_.AllocateRawAligned(size, alignment);
+      }
+    }
+    HeapObject* target = nullptr;
+    if (!allocation.To(&target)) return nullptr;
+    return target;
+  }
+
+  AllocationResult AllocateInNewSpaceSynchronized(
+      int size, AllocationAlignment alignment) {
+    NewSpace* new_space = heap_->new_space();
+    AllocationResult allocation =
+        new_space->AllocateRawSynchronized(size, alignment);
+    if (allocation.IsRetry() && new_space->AddFreshPageSynchronized()) {
+      allocation = new_space->AllocateRawSynchronized(size, alignment);
+    }
+    return allocation;
+  }
+
+  Heap* heap_;
+  ScavengingWorklist* worklist_;
+
+  // Chunks with old-to-new slots, claimed by bumping {next_chunk_}.
+  List<MemoryChunk*>* chunks_;
+  base::Atomic32* next_chunk_;
+
+  List<HeapObject*> local_worklist_;
+  List<HeapObject**> failed_slots_;
+
+  // Locally cached heap data.
+  CompactionSpaceCollection compaction_spaces_;
+  LocalAllocationBuffer buffer_;
+  LocalStoreBuffer local_store_buffer_;
+  HashMap local_pretenuring_feedback_;
+  bool new_space_exhausted_;
+
+  // Book keeping info.
+  intptr_t promoted_size_;
+  intptr_t semispace_copied_size_;
+  double duration_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScavengingWorker);
+};
+
+
+class Scavenger::ParallelScavengingTask : public CancelableTask {
+ public:
+  ParallelScavengingTask(Heap* heap, ScavengingWorker* worker,
+                         base::Semaphore* on_finish)
+      : CancelableTask(heap->isolate()),
+        worker_(worker),
+        on_finish_(on_finish) {}
+
+  virtual ~ParallelScavengingTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    if (worker_->Register()) worker_->Run();
+    on_finish_->Signal();
+  }
+
+  ScavengingWorker* worker_;
+  base::Semaphore* on_finish_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelScavengingTask);
+};
+
+
+int Scavenger::NumberOfParallelScavengingTasks() {
+  if (!FLAG_parallel_scavenge) return 1;
+  // Transferring marks and reporting object moves are not thread-safe.
+  bool should_record = FLAG_log_gc;
+#ifdef DEBUG
+  should_record = should_record || FLAG_heap_stats;
+#endif
+  if (should_record || heap()->incremental_marking()->IsMarking() ||
+      LoggingAndProfilingEnabled()) {
+    return 1;
+  }
+  // Use one task per kBytesPerTask of new space objects, which is an upper
+  // bound for the amount of surviving objects.
+  const intptr_t kBytesPerTask = 256 * KB;
+  const int kMaxTasks = 8;
+  int tasks =
+      1 + static_cast<int>(heap()->new_space()->Size() / kBytesPerTask);
+  int available_threads = 1 + static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  int cores = Max(1, base::SysInfo::NumberOfProcessors());
+  return Min(Min(tasks, kMaxTasks), Min(available_threads, cores));
+}
+
+
+Address Scavenger::ScavengeInParallel(int num_tasks) {
+  DCHECK_GT(num_tasks, 1);
+
+  List<MemoryChunk*> chunks;
+  {
+    PointerChunkIterator it(heap());
+    MemoryChunk* chunk;
+    while ((chunk = it.next()) != nullptr) {
+      if (RememberedSet<OLD_TO_NEW>::HasSlots(chunk)) chunks.Add(chunk);
+    }
+  }
+
+  ScavengingWorklist worklist;
+  base::Atomic32 next_chunk = 0;
+  base::Semaphore pending_tasks(0);
+  ScavengingWorker** workers = new ScavengingWorker*[num_tasks];
+  uint32_t* task_ids = new uint32_t[num_tasks];
+  for (int i = 0; i < num_tasks; i++) {
+    workers[i] = new ScavengingWorker(heap(), &worklist, &chunks, &next_chunk);
+  }
+
+  // The main thread registers first so that the scavenge cannot terminate
+  // before the roots have been visited.
+  bool registered = workers[0]->Register();
+  DCHECK(registered);
+  USE(registered);
+  for (int i = 1; i < num_tasks; i++) {
+    ParallelScavengingTask* task =
+        new ParallelScavengingTask(heap(), workers[i], &pending_tasks);
+    task_ids[i] = task->id();
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+
+  // Contribute on the main thread.
+  workers[0]->ScavengeRoots();
+  workers[0]->Run();
+
+  // Tasks that have not started yet are not needed anymore.
+  for (int i = 1; i < num_tasks; i++) {
+    if (!isolate()->cancelable_task_manager()->TryAbort(task_ids[i])) {
+      pending_tasks.Wait();
+    }
+  }
+
+  List<HeapObject**> failed_slots;
+  for (int i = 0; i < num_tasks; i++) {
+    workers[i]->Finalize();
+    failed_slots.AddAll(*workers[i]->failed_slots());
+    if (FLAG_trace_parallel_scavenge) {
+      PrintIsolate(isolate(),
+                   "parallel scavenge: task=%d time=%.2f promoted=%" V8_PTR_PREFIX
+                   "d semi_space_copied=%" V8_PTR_PREFIX "d\n",
+                   i, workers[i]->duration(), workers[i]->promoted_size(),
+                   workers[i]->semispace_copied_size());
+    }
+    delete workers[i];
+  }
+  delete[] workers;
+  delete[] task_ids;
+  heap()->tracer()->AddParallelScavengeEvent(num_tasks);
+
+  // All objects copied so far have already been visited. Objects the tasks
+  // could not find space for are copied sequentially, which also tries the
+  // main old space, and are visited by the caller's DoScavenge.
+  Address new_space_front = heap()->new_space()->top();
+  heap()->promotion_queue()->SetNewLimit(new_space_front);
+  for (int i = 0; i < failed_slots.length(); i++) {
+    HeapObject** slot = failed_slots[i];
+    ScavengeObject(slot, *slot);
+  }
+  return new_space_front;
+}
+
+
 Isolate* Scavenger::isolate() { return heap()->isolate(); }
 
 
@@ -33,10 +33,30 @@ class Scavenger {
   // of the heap (i.e. incremental marking, logging and profiling).
   void SelectScavengingVisitorsTable();
 
+  // Returns the number of tasks to use for scavenging the roots and the
+  // old-to-new remembered set in parallel, or 1 if the current state of the
+  // heap requires a sequential scavenge. Must be called before the semispaces
+  // are flipped.
+  int NumberOfParallelScavengingTasks();
+
+  // Copies all objects reachable from the roots and the old-to-new remembered
+  // set, using {num_tasks} - 1 background tasks with the main thread
+  // contributing. Must be called right after the semispaces are flipped.
+  // Objects the tasks fail to allocate space for are copied sequentially.
+  // Returns the start of the to-space objects that still have to be visited,
+  // together with the promotion queue.
+  Address ScavengeInParallel(int num_tasks);
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
  private:
+  class ParallelScavengingTask;
+  class ScavengingWorker;
+  class ScavengingWorklist;
+
+  bool LoggingAndProfilingEnabled();
+
   Heap* heap_;
   VisitorDispatchTable<ScavengingCallback> scavenging_visitors_table_;
 };
@@ -138,6 +138,35 @@ class MarkBit {
   inline bool Get() { return (*cell_ & mask_) != 0; }
   inline void Clear() { *cell_ &= ~mask_; }
 
+  // Atomic versions of Set() and Clear(), for use while the concurrent or
+  // parallel markers may update other bits of the same cell.
+  inline void SetAtomic() { TrySet(); }
+  inline void ClearAtomic() {
+    for (;;) {
+      CellType old_value = *cell_;
+      if ((old_value & mask_) == 0) return;
+      if (UpdateCell(old_value, old_value & ~mask_)) return;
+    }
+  }
+
+  // Atomically sets the bit and returns true if it was not set before, i.e.
+  // if this call won a race against other threads setting the bit.
+  inline bool TrySet() {
+    for (;;) {
+      CellType old_value = *cell_;
+      if ((old_value & mask_) != 0) return false;
+      if (UpdateCell(old_value, old_value | mask_)) return true;
+    }
+  }
+
+  inline bool UpdateCell(CellType old_value, CellType new_value) {
+    base::Atomic32* cell = reinterpret_cast<base::Atomic32*>(cell_);
+    return base::NoBarrier_CompareAndSwap(
+               cell, static_cast<base::Atomic32>(old_value),
+               static_cast<base::Atomic32>(new_value)) ==
+           static_cast<base::Atomic32>(old_value);
+  }
+
   CellType* cell_;
   CellType mask_;
 
@@ -49,6 +49,7 @@ function AtomicsCompareExchangeJS(sta, index, oldValue, newValue) {
   newValue = TO_NUMBER(newValue);
   return %_AtomicsCompareExchange(sta, index, oldValue, newValue);
 }
+%SetForceInlineFlag(AtomicsCompareExchangeJS);
 
 function AtomicsLoadJS(sta, index) {
   CheckSharedIntegerTypedArray(sta);
@@ -58,6 +59,7 @@ function AtomicsLoadJS(sta, index) {
   }
   return %_AtomicsLoad(sta, index);
 }
+%SetForceInlineFlag(AtomicsLoadJS);
 
 function AtomicsStoreJS(sta, index, value) {
   CheckSharedIntegerTypedArray(sta);
@@ -68,6 +70,7 @@ function AtomicsStoreJS(sta, index, value) {
   value = TO_NUMBER(value);
   return %_AtomicsStore(sta, index, value);
 }
+%SetForceInlineFlag(AtomicsStoreJS);
 
 function AtomicsAddJS(ia, index, value) {
   CheckSharedIntegerTypedArray(ia);
@@ -78,6 +81,7 @@ function AtomicsAddJS(ia, index, value) {
   value = TO_NUMBER(value);
   return %_AtomicsAdd(ia, index, value);
 }
+%SetForceInlineFlag(AtomicsAddJS);
 
 function AtomicsSubJS(ia, index, value) {
   CheckSharedIntegerTypedArray(ia);
@@ -88,6 +92,7 @@ function AtomicsSubJS(ia, index, value) {
   value = TO_NUMBER(value);
   return %_AtomicsSub(ia, index, value);
 }
+%SetForceInlineFlag(AtomicsSubJS);
 
 function AtomicsAndJS(ia, index, value) {
   CheckSharedIntegerTypedArray(ia);
@@ -98,6 +103,7 @@ function AtomicsAndJS(ia, index, value) {
   value = TO_NUMBER(value);
   return %_AtomicsAnd(ia, index, value);
 }
+%SetForceInlineFlag(AtomicsAndJS);
 
 function AtomicsOrJS(ia, index, value) {
   CheckSharedIntegerTypedArray(ia);
@@ -108,6 +114,7 @@ function AtomicsOrJS(ia, index, value) {
   value = TO_NUMBER(value);
   return %_AtomicsOr(ia, index, value);
 }
+%SetForceInlineFlag(AtomicsOrJS);
 
 function AtomicsXorJS(ia, index, value) {
   CheckSharedIntegerTypedArray(ia);
@@ -118,6 +125,7 @@ function AtomicsXorJS(ia, index, value) {
   value = TO_NUMBER(value);
   return %_AtomicsXor(ia, index, value);
 }
+%SetForceInlineFlag(AtomicsXorJS);
 
 function AtomicsExchangeJS(ia, index, value) {
   CheckSharedIntegerTypedArray(ia);
@@ -128,6 +136,7 @@ function AtomicsExchangeJS(ia, index, value) {
   value = TO_NUMBER(value);
   return %_AtomicsExchange(ia, index, value);
 }
+%SetForceInlineFlag(AtomicsExchangeJS);
 
 function AtomicsIsLockFreeJS(size) {
   return %_AtomicsIsLockFree(size);
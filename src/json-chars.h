@@ -0,0 +1,121 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_CHARS_H_
+#define V8_JSON_CHARS_H_
+
+#include "src/base/bits.h"
+#include "src/globals.h"
+#include "src/utils.h"
+
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+// Characters that end a JSON string literal or cannot be copied verbatim
+// between a JSON string literal and a JS string: control characters, the
+// quote and the backslash.
+template <typename Char>
+inline bool IsJsonSpecialChar(Char c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+
+// Returns a word with the top bit of every Char sized lane of |word| set if
+// that lane holds a special character. Lanes above a special character may
+// also be set, so this only tells whether the word needs a closer look.
+template <typename Char>
+inline uintptr_t JsonSpecialCharLanes(uintptr_t word) {
+  const uintptr_t kLaneMask =
+      (static_cast<uintptr_t>(1) << (8 * sizeof(Char))) - 1;
+  const uintptr_t kLowBits = kUintptrAllBitsSet / kLaneMask;
+  const uintptr_t kHighBits = kLowBits << (8 * sizeof(Char) - 1);
+  uintptr_t quote = word ^ (kLowBits * '"');
+  uintptr_t backslash = word ^ (kLowBits * '\\');
+  uintptr_t control = (word - kLowBits * 0x20) & ~word;
+  uintptr_t is_quote = (quote - kLowBits) & ~quote;
+  uintptr_t is_backslash = (backslash - kLowBits) & ~backslash;
+  return (control | is_quote | is_backslash) & kHighBits;
+}
+
+
+// Returns the offset of the first special character in |chars|, or |length|
+// if there is none. Clean runs are skipped a vector or a word at a time.
+template <typename Char>
+inline int JsonSpecialCharStart(const Char* chars, int length) {
+  const Char* start = chars;
+  const Char* limit = chars + length;
+
+#if V8_HOST_ARCH_X64
+  const int kCharsPerVector = sizeof(__m128i) / sizeof(Char);
+  if (length >= kCharsPerVector) {
+    // SSE2 is part of the x64 baseline.
+    __m128i quote, backslash, control_max;
+    if (sizeof(Char) == 1) {
+      quote = _mm_set1_epi8('"');
+      backslash = _mm_set1_epi8('\\');
+      control_max = _mm_set1_epi8(0x1f);
+    } else {
+      quote = _mm_set1_epi16('"');
+      backslash = _mm_set1_epi16('\\');
+      control_max = _mm_set1_epi16(0x1f);
+    }
+    while (chars + kCharsPerVector <= limit) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+      __m128i special;
+      if (sizeof(Char) == 1) {
+        // Unsigned v <= 0x1f iff min(v, 0x1f) == v.
+        special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, quote),
+                         _mm_cmpeq_epi8(v, backslash)),
+            _mm_cmpeq_epi8(_mm_min_epu8(v, control_max), v));
+      } else {
+        // Unsigned v <= 0x1f iff v - 0x1f saturates to 0.
+        special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi16(v, quote),
+                         _mm_cmpeq_epi16(v, backslash)),
+            _mm_cmpeq_epi16(_mm_subs_epu16(v, control_max),
+                            _mm_setzero_si128()));
+      }
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+      if (mask != 0) {
+        return static_cast<int>(chars - start) +
+               base::bits::CountTrailingZeros32(mask) / sizeof(Char);
+      }
+      chars += kCharsPerVector;
+    }
+  }
+#else
+  const int kCharsPerWord = sizeof(uintptr_t) / sizeof(Char);
+  if (length >= 2 * kCharsPerWord) {
+    // Check unaligned characters.
+    while (!IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+      if (IsJsonSpecialChar(*chars)) return static_cast<int>(chars - start);
+      ++chars;
+    }
+    // Check aligned words.
+    while (chars + kCharsPerWord <= limit) {
+      uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+      if (JsonSpecialCharLanes<Char>(word) != 0) break;
+      chars += kCharsPerWord;
+    }
+  }
+#endif
+
+  // Check the remaining characters, including the rest of a word that holds
+  // a special character.
+  while (chars < limit) {
+    if (IsJsonSpecialChar(*chars)) break;
+    ++chars;
+  }
+  return static_cast<int>(chars - start);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_CHARS_H_
@@ -0,0 +1,54 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json-parser.h"
+
+namespace v8 {
+namespace internal {
+
+MaybeHandle<Object> ThrowJsonParseError(Isolate* isolate, Handle<String> source,
+                                        int position, uc32 c0) {
+  Factory* factory = isolate->factory();
+  MessageTemplate::Template message;
+  Handle<Object> arg1 = Handle<Smi>(Smi::FromInt(position), isolate);
+  Handle<Object> arg2;
+
+  switch (c0) {
+    case JsonParser<true>::kEndOfString:
+      message = MessageTemplate::kJsonParseUnexpectedEOS;
+      break;
+    case '-':
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+      message = MessageTemplate::kJsonParseUnexpectedTokenNumber;
+      break;
+    case '"':
+      message = MessageTemplate::kJsonParseUnexpectedTokenString;
+      break;
+    default:
+      message = MessageTemplate::kJsonParseUnexpectedToken;
+      arg2 = arg1;
+      arg1 = factory->LookupSingleCharacterStringFromCode(c0);
+      break;
+  }
+
+  Handle<Script> script(factory->NewScript(source));
+  // We should sent compile error event because we compile JSON object in
+  // separated source file.
+  isolate->debug()->OnCompileError(script);
+  MessageLocation location(script, position, position + 1);
+  Handle<Object> error = factory->NewSyntaxError(message, arg1, arg2);
+  return isolate->Throw<Object>(error, &location);
+}
+
+}  // namespace internal
+}  // namespace v8
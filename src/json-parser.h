@@ -10,6 +10,7 @@
 #include "src/debug/debug.h"
 #include "src/factory.h"
 #include "src/field-type.h"
+#include "src/json-chars.h"
 #include "src/messages.h"
 #include "src/parsing/scanner.h"
 #include "src/parsing/token.h"
@@ -21,6 +22,12 @@ namespace internal {
 enum ParseElementResult { kElementFound, kElementNotFound, kNullHandle };
 
 
+// Throws the SyntaxError for a JSON text with the unexpected character |c0|
+// (or kEndOfString) at |position|.
+MaybeHandle<Object> ThrowJsonParseError(Isolate* isolate, Handle<String> source,
+                                        int position, uc32 c0);
+
+
 // A simple json parser.
 template <bool seq_one_byte>
 class JsonParser BASE_EMBEDDED {
@@ -31,6 +38,9 @@ class JsonParser BASE_EMBEDDED {
 
   static const int kEndOfString = -1;
 
+  // Objects created from sources at least this long are pretenured.
+  static const int kPretenureTreshold = 100 * 1024;
+
  private:
   explicit JsonParser(Handle<String> source)
       : source_(source),
@@ -39,6 +49,8 @@ class JsonParser BASE_EMBEDDED {
         factory_(isolate_->factory()),
         object_constructor_(isolate_->native_context()->object_function(),
                             isolate_),
+        shape_cache_(isolate_->heap()->empty_fixed_array(), isolate_),
+        shape_cache_next_(0),
         position_(-1) {
     source_ = String::Flatten(source_);
     pretenure_ = (source_length_ >= kPretenureTreshold) ? TENURED : NOT_TENURED;
@@ -46,6 +58,7 @@ class JsonParser BASE_EMBEDDED {
     // Optimized fast case where we only have Latin1 characters.
     if (seq_one_byte) {
       seq_source_ = Handle<SeqOneByteString>::cast(source_);
+      shape_cache_ = factory()->NewFixedArray(kShapeCacheSize);
     }
   }
 
@@ -103,6 +116,15 @@ class JsonParser BASE_EMBEDDED {
   }
 
   bool ParseJsonString(Handle<String> expected) {
+    if (!MatchJsonString(expected)) return false;
+    position_ = position_ + expected->length() + 1;
+    AdvanceSkipWhitespace();
+    return true;
+  }
+
+  // Checks whether the string at position_ is |expected| without escapes,
+  // without consuming it.
+  bool MatchJsonString(Handle<String> expected) {
     int length = expected->length();
     if (source_->length() - position_ - 1 > length) {
       DisallowHeapAllocation no_gc;
@@ -117,11 +139,7 @@ class JsonParser BASE_EMBEDDED {
             return false;
           }
         }
-        if (input_chars[length] == '"') {
-          position_ = position_ + length + 1;
-          AdvanceSkipWhitespace();
-          return true;
-        }
+        return input_chars[length] == '"';
       }
     }
     return false;
@@ -185,7 +203,6 @@ class JsonParser BASE_EMBEDDED {
   inline Handle<JSFunction> object_constructor() { return object_constructor_; }
 
   static const int kInitialSpecialStringLength = 32;
-  static const int kPretenureTreshold = 100 * 1024;
 
 
  private:
@@ -194,6 +211,16 @@ class JsonParser BASE_EMBEDDED {
   void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
                                ZoneList<Handle<Object> >* properties);
 
+  // The shape cache remembers the maps of recently parsed objects, so that
+  // objects with the same keys in the same order can follow their transitions
+  // by comparing the keys in place, without internalizing them or searching
+  // transition arrays. A shape is a FixedArray of the maps from the one with
+  // the first property to the one with all of them.
+  Handle<FixedArray> LookupCachedShape(Handle<Map> map);
+  void AddCachedShape(Handle<Map> map);
+
+  static const int kShapeCacheSize = 4;
+
   Handle<String> source_;
   int source_length_;
   Handle<SeqOneByteString> seq_source_;
@@ -203,6 +230,9 @@ class JsonParser BASE_EMBEDDED {
   Factory* factory_;
   Zone zone_;
   Handle<JSFunction> object_constructor_;
+  // Holds up to kShapeCacheSize shapes. Empty unless seq_one_byte.
+  Handle<FixedArray> shape_cache_;
+  int shape_cache_next_;
   uc32 c0_;
   int position_;
 };
@@ -217,45 +247,7 @@ MaybeHandle<Object> JsonParser<seq_one_byte>::ParseJson() {
     if (isolate_->has_pending_exception()) return Handle<Object>::null();
 
     // Parse failed. Current character is the unexpected token.
-    Factory* factory = this->factory();
-    MessageTemplate::Template message;
-    Handle<Object> arg1 = Handle<Smi>(Smi::FromInt(position_), isolate());
-    Handle<Object> arg2;
-
-    switch (c0_) {
-      case kEndOfString:
-        message = MessageTemplate::kJsonParseUnexpectedEOS;
-        break;
-      case '-':
-      case '0':
-      case '1':
-      case '2':
-      case '3':
-      case '4':
-      case '5':
-      case '6':
-      case '7':
-      case '8':
-      case '9':
-        message = MessageTemplate::kJsonParseUnexpectedTokenNumber;
-        break;
-      case '"':
-        message = MessageTemplate::kJsonParseUnexpectedTokenString;
-        break;
-      default:
-        message = MessageTemplate::kJsonParseUnexpectedToken;
-        arg2 = arg1;
-        arg1 = factory->LookupSingleCharacterStringFromCode(c0_);
-        break;
-    }
-
-    Handle<Script> script(factory->NewScript(source_));
-    // We should sent compile error event because we compile JSON object in
-    // separated source file.
-    isolate()->debug()->OnCompileError(script);
-    MessageLocation location(script, position_, position_ + 1);
-    Handle<Object> error = factory->NewSyntaxError(message, arg1, arg2);
-    return isolate()->template Throw<Object>(error, &location);
+    return ThrowJsonParseError(isolate(), source_, position_, c0_);
   }
   return result;
 }
@@ -356,6 +348,8 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
   DCHECK_EQ(c0_, '{');
 
   bool transitioning = true;
+  // The cached shape the keys have matched so far, if any.
+  Handle<FixedArray> shape;
 
   AdvanceSkipWhitespace();
   if (c0_ != '}') {
@@ -383,18 +377,30 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       // Try to follow existing transitions as long as possible. Once we stop
       // transitioning, no transition can be found anymore.
       DCHECK(transitioning);
-      // First check whether there is a single expected transition. If so, try
-      // to parse it first.
       bool follow_expected = false;
       Handle<Map> target;
-      if (seq_one_byte) {
+      // First check whether the object continues like a recently parsed one.
+      if (seq_one_byte && descriptor == 0) shape = LookupCachedShape(map);
+      if (!shape.is_null()) {
+        if (descriptor < shape->length()) {
+          target = handle(Map::cast(shape->get(descriptor)), isolate());
+          key = handle(
+              String::cast(target->instance_descriptors()->GetKey(descriptor)),
+              isolate());
+          follow_expected = ParseJsonString(key);
+        }
+        if (!follow_expected) shape = Handle<FixedArray>::null();
+      }
+      // Then check whether there is a single expected transition. If so, try
+      // to parse it first.
+      if (seq_one_byte && !follow_expected) {
         key = TransitionArray::ExpectedTransitionKey(map);
         follow_expected = !key.is_null() && ParseJsonString(key);
+        if (follow_expected) {
+          target = TransitionArray::ExpectedTransitionTarget(map);
+        }
       }
-      // If the expected transition hits, follow it.
-      if (follow_expected) {
-        target = TransitionArray::ExpectedTransitionTarget(map);
-      } else {
+      if (!follow_expected) {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
         key = ParseJsonInternalizedString();
@@ -449,6 +455,10 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
     // If we transitioned until the very end, transition the map now.
     if (transitioning) {
       CommitStateToJsonObject(json_object, map, &properties);
+      if (seq_one_byte && descriptor > 0 &&
+          (shape.is_null() || shape->length() != descriptor)) {
+        AddCachedShape(map);
+      }
     } else {
       while (MatchSkipWhiteSpace(',')) {
         HandleScope local_scope(isolate());
@@ -510,6 +520,49 @@ void JsonParser<seq_one_byte>::CommitStateToJsonObject(
 }
 
 
+template <bool seq_one_byte>
+Handle<FixedArray> JsonParser<seq_one_byte>::LookupCachedShape(
+    Handle<Map> map) {
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < shape_cache_->length(); i++) {
+    Object* entry = shape_cache_->get(i);
+    if (!entry->IsFixedArray()) continue;
+    FixedArray* shape = FixedArray::cast(entry);
+    Map* first = Map::cast(shape->get(0));
+    Map* last = Map::cast(shape->get(shape->length() - 1));
+    // Deprecating a map deprecates the maps transitioned to from it.
+    if (last->is_deprecated()) {
+      shape_cache_->set(i, Smi::FromInt(0));
+      continue;
+    }
+    if (first->GetBackPointer() != *map) continue;
+    Handle<String> key(String::cast(first->instance_descriptors()->GetKey(0)),
+                       isolate());
+    if (MatchJsonString(key)) return handle(shape, isolate());
+  }
+  return Handle<FixedArray>::null();
+}
+
+
+template <bool seq_one_byte>
+void JsonParser<seq_one_byte>::AddCachedShape(Handle<Map> map) {
+  DCHECK_EQ(kShapeCacheSize, shape_cache_->length());
+  int length = map->NumberOfOwnDescriptors();
+  Handle<FixedArray> shape = factory()->NewFixedArray(length);
+  DisallowHeapAllocation no_gc;
+  Map* current = *map;
+  for (int i = length - 1; i >= 0; i--) {
+    DCHECK_EQ(i + 1, current->NumberOfOwnDescriptors());
+    shape->set(i, current);
+    Object* back_pointer = current->GetBackPointer();
+    if (!back_pointer->IsMap()) return;
+    current = Map::cast(back_pointer);
+  }
+  shape_cache_->set(shape_cache_next_, *shape);
+  shape_cache_next_ = (shape_cache_next_ + 1) % kShapeCacheSize;
+}
+
+
 // Parse a JSON array. Position must be right at '['.
 template <bool seq_one_byte>
 Handle<Object> JsonParser<seq_one_byte>::ParseJsonArray() {
@@ -667,8 +720,19 @@ Handle<String> JsonParser<seq_one_byte>::SlowScanJsonString(
       // Latin1 characters, there's no need to test whether we can store the
       // character. Otherwise check whether the UC16 source character can fit
       // in the Latin1 sink.
-      if (sizeof(SinkChar) == kUC16Size || seq_one_byte ||
-          c0_ <= String::kMaxOneByteCharCode) {
+      if (seq_one_byte) {
+        // Copy the run up to the next special character in bulk.
+        int run = JsonSpecialCharStart(
+            seq_source_->GetChars() + position_,
+            Min(source_length_ - position_, length - count));
+        DCHECK_LT(0, run);
+        CopyChars(seq_string->GetChars() + count,
+                  seq_source_->GetChars() + position_, run);
+        count += run;
+        position_ += run - 1;
+        Advance();
+      } else if (sizeof(SinkChar) == kUC16Size ||
+                 c0_ <= String::kMaxOneByteCharCode) {
         SeqStringSet(seq_string, count++, c0_);
         Advance();
       } else {
@@ -752,26 +816,27 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
     // Fast path for existing internalized strings.  If the the string being
     // parsed is not a known internalized string, contains backslashes or
     // unexpectedly reaches the end of string, return with an empty handle.
-    uint32_t running_hash = isolate()->heap()->HashSeed();
-    int position = position_;
-    uc32 c0 = c0_;
-    do {
-      if (c0 == '\\') {
-        c0_ = c0;
-        int beg_pos = position_;
-        position_ = position;
-        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_,
-                                                             beg_pos,
-                                                             position_);
-      }
-      if (c0 < 0x20) return Handle<String>::null();
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
-      position++;
-      if (position >= source_length_) return Handle<String>::null();
-      c0 = seq_source_->SeqOneByteStringGet(position);
-    } while (c0 != '"');
+    int position =
+        position_ + JsonSpecialCharStart(seq_source_->GetChars() + position_,
+                                         source_length_ - position_);
+    if (position >= source_length_) return Handle<String>::null();
+    uc32 c0 = seq_source_->SeqOneByteStringGet(position);
+    if (c0 == '\\') {
+      c0_ = c0;
+      int beg_pos = position_;
+      position_ = position;
+      return SlowScanJsonString<SeqOneByteString, uint8_t>(source_,
+                                                           beg_pos,
+                                                           position_);
+    }
+    if (c0 < 0x20) return Handle<String>::null();
+    DCHECK_EQ('"', c0);
     int length = position - position_;
+    uint32_t running_hash = isolate()->heap()->HashSeed();
+    const uint8_t* chars = seq_source_->GetChars() + position_;
+    for (int i = 0; i < length; i++) {
+      running_hash = StringHasher::AddCharacterCore(running_hash, chars[i]);
+    }
     uint32_t hash = (length <= String::kMaxHashCalcLength)
                         ? StringHasher::GetHashCore(running_hash)
                         : static_cast<uint32_t>(length);
@@ -810,8 +875,24 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   }
 
   int beg_pos = position_;
+  if (seq_one_byte) {
+    // Fast case without escape characters: find the closing quote in bulk.
+    position_ += JsonSpecialCharStart(seq_source_->GetChars() + position_,
+                                      source_length_ - position_);
+    if (position_ >= source_length_) {
+      c0_ = kEndOfString;
+      return Handle<String>::null();
+    }
+    c0_ = seq_source_->SeqOneByteStringGet(position_);
+    if (c0_ == '\\') {
+      return SlowScanJsonString<SeqOneByteString, uint8_t>(source_,
+                                                           beg_pos,
+                                                           position_);
+    }
+    if (c0_ < 0x20) return Handle<String>::null();
+  }
   // Fast case for Latin1 only without escape characters.
-  do {
+  while (c0_ != '"') {
     // Check for control character (0x00-0x1f) or unterminated string (<0).
     if (c0_ < 0x20) return Handle<String>::null();
     if (c0_ != '\\') {
@@ -827,7 +908,7 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
                                                            beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
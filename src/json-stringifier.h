@@ -6,6 +6,7 @@
 #define V8_JSON_STRINGIFIER_H_
 
 #include "src/conversions.h"
+#include "src/json-chars.h"
 #include "src/lookup.h"
 #include "src/messages.h"
 #include "src/string-builder.h"
@@ -110,6 +111,10 @@ class BasicJsonStringifier BASE_EMBEDDED {
 
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
+
+  // Bounds on the number of characters of a string serialized at once.
+  static const int kMaxStringChunkLength = 1024;
+  static const int kMinStringChunkLength = 16;
 };
 
 
@@ -609,13 +614,18 @@ void BasicJsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
-  for (int i = 0; i < src.length(); i++) {
-    SrcChar c = src[i];
-    if (DoNotEscape(c)) {
-      dest->Append(c);
-    } else {
-      dest->AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
-    }
+  // Copy the runs between characters that need escaping in bulk. Only
+  // characters below 0x80 need it, so the table lookup stays in bounds.
+  const SrcChar* chars = src.start();
+  int length = src.length();
+  int i = 0;
+  while (true) {
+    int run = JsonSpecialCharStart(chars + i, length - i);
+    dest->AppendChars(chars + i, run);
+    i += run;
+    if (i == length) break;
+    dest->AppendCString(&JsonEscapeTable[chars[i] * kJsonEscapeTableEntrySize]);
+    i++;
   }
 }
 
@@ -624,21 +634,32 @@ template <typename SrcChar, typename DestChar>
 void BasicJsonStringifier::SerializeString_(Handle<String> string) {
   int length = string->length();
   builder_.Append<uint8_t, DestChar>('"');
-  // We make a rough estimate to find out if the current string can be
-  // serialized without allocating a new string part. The worst case length of
-  // an escaped character is 6.  Shifting the remainin string length right by 3
-  // is a more pessimistic estimate, but faster to calculate.
-  int worst_case_length = length << 3;
-  if (builder_.CurrentPartCanFit(worst_case_length)) {
-    DisallowHeapAllocation no_gc;
-    Vector<const SrcChar> vector = string->GetCharVector<SrcChar>();
-    IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
-        &builder_, worst_case_length);
-    SerializeStringUnchecked_(vector, &no_extend);
-  } else {
-    FlatStringReader reader(isolate_, string);
-    for (int i = 0; i < reader.length(); i++) {
-      SrcChar c = reader.Get<SrcChar>(i);
+  // Serialize the string in chunks that fit into the current string part, so
+  // that long strings are copied in bulk as well. We make a rough estimate to
+  // find out if a chunk can be serialized without allocating a new string
+  // part. The worst case length of an escaped character is 6.  Shifting the
+  // chunk length left by 3 is a more pessimistic estimate, but faster to
+  // calculate.
+  int start = 0;
+  while (start < length) {
+    int chunk_length = Min(length - start, kMaxStringChunkLength);
+    while (chunk_length > kMinStringChunkLength &&
+           !builder_.CurrentPartCanFit(chunk_length << 3)) {
+      chunk_length >>= 1;
+    }
+    int worst_case_length = chunk_length << 3;
+    if (builder_.CurrentPartCanFit(worst_case_length)) {
+      DisallowHeapAllocation no_gc;
+      Vector<const SrcChar> vector =
+          string->GetCharVector<SrcChar>().SubVector(start,
+                                                     start + chunk_length);
+      IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
+          &builder_, worst_case_length);
+      SerializeStringUnchecked_(vector, &no_extend);
+      start += chunk_length;
+    } else {
+      // Fill up the current part, which allocates the next one.
+      SrcChar c = string->GetCharVector<SrcChar>()[start++];
       if (DoNotEscape(c)) {
         builder_.Append<SrcChar, DestChar>(c);
       } else {
@@ -0,0 +1,906 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json-tape.h"
+
+#include "src/char-predicates-inl.h"
+#include "src/conversions.h"
+#include "src/global-handles.h"
+#include "src/json-chars.h"
+#include "src/json-parser.h"
+#include "src/unicode-decoder.h"
+#include "src/unicode-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// Scans a JSON text into a JsonTape. Follows the grammar and the error
+// positions of JsonParser, but only records what it finds.
+template <typename Char>
+class JsonTokenizer BASE_EMBEDDED {
+ public:
+  JsonTokenizer(JsonTape* tape, const Char* chars, uintptr_t stack_limit,
+                int max_depth)
+      : tape_(tape),
+        chars_(chars),
+        length_(tape->length_),
+        stack_limit_(stack_limit),
+        max_depth_(max_depth),
+        depth_(0),
+        position_(-1),
+        key_table_(NULL),
+        key_table_capacity_(0) {}
+
+  ~JsonTokenizer() { DeleteArray(key_table_); }
+
+  void Tokenize() {
+    AdvanceSkipWhitespace();
+    if (!ScanJsonValue() || c0_ != kEndOfString) {
+      if (!tape_->stack_overflow_ && !tape_->too_deep_) {
+        tape_->error_position_ = position_;
+        tape_->error_char_ = c0_;
+      }
+    }
+  }
+
+ private:
+  static const int kEndOfString = JsonParser<true>::kEndOfString;
+  static const int kInitialKeyTableCapacity = 64;
+
+  inline void Advance() {
+    position_++;
+    c0_ = position_ < length_ ? chars_[position_] : kEndOfString;
+  }
+
+  inline void AdvanceSkipWhitespace() {
+    do {
+      Advance();
+    } while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r');
+  }
+
+  inline void SkipWhitespace() {
+    while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r') {
+      Advance();
+    }
+  }
+
+  // Whether the characters fit a one-byte string. Only ASCII does if the
+  // source is UTF-8.
+  bool IsOneByte(const uint8_t* chars, int length) const {
+    return !tape_->utf8_ || String::IsAscii(chars, length);
+  }
+  bool IsOneByte(const uc16* chars, int length) const {
+    return String::IsOneByte(chars, length);
+  }
+
+  // Appends chars_[from..to) to unescaped_, decoding them if the source is
+  // UTF-8. Clears |one_byte| if any of them is not Latin1.
+  void AddUnescaped(int from, int to, bool* one_byte);
+
+  inline uc32 AdvanceGetChar() {
+    Advance();
+    return c0_;
+  }
+
+  inline bool MatchSkipWhiteSpace(uc32 c) {
+    if (c0_ == c) {
+      AdvanceSkipWhitespace();
+      return true;
+    }
+    return false;
+  }
+
+  inline void Add(JsonTape::Tag tag, int payload) {
+    tape_->entries_.Add(JsonTape::Encode(tag, payload));
+  }
+
+  // Each of these returns false with the unexpected character in c0_.
+  bool ScanJsonValue();
+  bool ScanJsonObject();
+  bool ScanJsonArray();
+  bool ScanJsonNumber();
+  bool ScanJsonString(JsonTape::Slice* slice);
+  bool ScanEscapedJsonString(int start, JsonTape::Slice* slice);
+
+  // Returns the index of the key at c0_ in keys_, or -1.
+  int ScanJsonKey();
+  int LookupKey(const JsonTape::Slice& name);
+  const Char* KeyChars(int key) const {
+    return chars_ + tape_->keys_[key].name.start;
+  }
+
+  JsonTape* tape_;
+  const Char* chars_;
+  int length_;
+  uintptr_t stack_limit_;
+  int max_depth_;
+  int depth_;  // Of the object or array being scanned.
+  uc32 c0_;
+  int position_;
+  // Open addressing hash table of keys_ indices + 1, for keys without escapes.
+  int* key_table_;
+  int key_table_capacity_;
+};
+
+
+template <typename Char>
+bool JsonTokenizer<Char>::ScanJsonValue() {
+  if (GetCurrentStackPosition() < stack_limit_) {
+    tape_->stack_overflow_ = true;
+    return false;
+  }
+
+  if (c0_ == '"') {
+    JsonTape::Slice slice;
+    if (!ScanJsonString(&slice)) return false;
+    Add(JsonTape::kString, tape_->strings_.length());
+    tape_->strings_.Add(slice);
+    return true;
+  }
+  if ((c0_ >= '0' && c0_ <= '9') || c0_ == '-') return ScanJsonNumber();
+  if (c0_ == '{') return ScanJsonObject();
+  if (c0_ == '[') return ScanJsonArray();
+  if (c0_ == 'f') {
+    if (AdvanceGetChar() == 'a' && AdvanceGetChar() == 'l' &&
+        AdvanceGetChar() == 's' && AdvanceGetChar() == 'e') {
+      AdvanceSkipWhitespace();
+      Add(JsonTape::kFalse, 0);
+      return true;
+    }
+    return false;
+  }
+  if (c0_ == 't') {
+    if (AdvanceGetChar() == 'r' && AdvanceGetChar() == 'u' &&
+        AdvanceGetChar() == 'e') {
+      AdvanceSkipWhitespace();
+      Add(JsonTape::kTrue, 0);
+      return true;
+    }
+    return false;
+  }
+  if (c0_ == 'n') {
+    if (AdvanceGetChar() == 'u' && AdvanceGetChar() == 'l' &&
+        AdvanceGetChar() == 'l') {
+      AdvanceSkipWhitespace();
+      Add(JsonTape::kNull, 0);
+      return true;
+    }
+    return false;
+  }
+  return false;
+}
+
+
+template <typename Char>
+bool JsonTokenizer<Char>::ScanJsonObject() {
+  DCHECK_EQ(c0_, '{');
+  if (depth_ == max_depth_) {
+    tape_->too_deep_ = true;
+    return false;
+  }
+  depth_++;
+  int start = tape_->entries_.length();
+  int count = 0;
+  Add(JsonTape::kObject, 0);
+
+  AdvanceSkipWhitespace();
+  if (c0_ != '}') {
+    do {
+      if (c0_ != '"') return false;
+      int key = ScanJsonKey();
+      if (key < 0 || c0_ != ':') return false;
+      Add(JsonTape::kString, key);
+      AdvanceSkipWhitespace();
+      if (!ScanJsonValue()) return false;
+      count++;
+    } while (MatchSkipWhiteSpace(','));
+    if (c0_ != '}') return false;
+  }
+  AdvanceSkipWhitespace();
+  tape_->entries_[start] = JsonTape::Encode(JsonTape::kObject, count);
+  depth_--;
+  return true;
+}
+
+
+template <typename Char>
+bool JsonTokenizer<Char>::ScanJsonArray() {
+  DCHECK_EQ(c0_, '[');
+  if (depth_ == max_depth_) {
+    tape_->too_deep_ = true;
+    return false;
+  }
+  depth_++;
+  int start = tape_->entries_.length();
+  int count = 0;
+  Add(JsonTape::kArray, 0);
+
+  AdvanceSkipWhitespace();
+  if (c0_ != ']') {
+    do {
+      if (!ScanJsonValue()) return false;
+      count++;
+    } while (MatchSkipWhiteSpace(','));
+    if (c0_ != ']') return false;
+  }
+  AdvanceSkipWhitespace();
+  tape_->entries_[start] = JsonTape::Encode(JsonTape::kArray, count);
+  depth_--;
+  return true;
+}
+
+
+template <typename Char>
+bool JsonTokenizer<Char>::ScanJsonNumber() {
+  bool negative = false;
+  int beg_pos = position_;
+  if (c0_ == '-') {
+    Advance();
+    negative = true;
+  }
+  if (c0_ == '0') {
+    Advance();
+    // Prefix zero is only allowed if it's the only digit before
+    // a decimal point or exponent.
+    if (IsDecimalDigit(c0_)) return false;
+  } else {
+    int i = 0;
+    int digits = 0;
+    if (c0_ < '1' || c0_ > '9') return false;
+    do {
+      i = i * 10 + c0_ - '0';
+      digits++;
+      Advance();
+    } while (IsDecimalDigit(c0_));
+    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E' && digits < 10) {
+      SkipWhitespace();
+      if (negative) i = -i;
+      if (i >= JsonTape::kMinInlineSmi && i <= JsonTape::kMaxInlineSmi) {
+        Add(JsonTape::kSmi, i);
+      } else {
+        Add(JsonTape::kNumber, tape_->numbers_.length());
+        tape_->numbers_.Add(i);
+      }
+      return true;
+    }
+  }
+  if (c0_ == '.') {
+    Advance();
+    if (!IsDecimalDigit(c0_)) return false;
+    do {
+      Advance();
+    } while (IsDecimalDigit(c0_));
+  }
+  if (AsciiAlphaToLower(c0_) == 'e') {
+    Advance();
+    if (c0_ == '-' || c0_ == '+') Advance();
+    if (!IsDecimalDigit(c0_)) return false;
+    do {
+      Advance();
+    } while (IsDecimalDigit(c0_));
+  }
+  Vector<const Char> chars(chars_ + beg_pos, position_ - beg_pos);
+  double number = StringToDouble(&tape_->unicode_cache_, chars,
+                                 NO_FLAGS,  // Hex, octal or trailing junk.
+                                 std::numeric_limits<double>::quiet_NaN());
+  SkipWhitespace();
+  Add(JsonTape::kNumber, tape_->numbers_.length());
+  tape_->numbers_.Add(number);
+  return true;
+}
+
+
+template <typename Char>
+bool JsonTokenizer<Char>::ScanJsonString(JsonTape::Slice* slice) {
+  DCHECK_EQ('"', c0_);
+  Advance();
+  int start = position_;
+  // Skip to the next special character in bulk.
+  position_ += JsonSpecialCharStart(chars_ + start, length_ - start) - 1;
+  Advance();
+  // Check for control character (0x00-0x1f) or unterminated string (<0).
+  if (c0_ < 0x20) return false;
+  if (c0_ == '\\') return ScanEscapedJsonString(start, slice);
+  DCHECK_EQ('"', c0_);
+  slice->start = start;
+  slice->length = position_ - start;
+  slice->unescaped = false;
+  slice->one_byte = IsOneByte(chars_ + start, slice->length);
+  // Advance past the last '"'.
+  AdvanceSkipWhitespace();
+  return true;
+}
+
+
+// Copies the characters scanned so far to unescaped_ and scans the rest of
+// the string there, starting at the '\' in c0_.
+template <typename Char>
+bool JsonTokenizer<Char>::ScanEscapedJsonString(int start,
+                                                JsonTape::Slice* slice) {
+  List<uc16>* unescaped = &tape_->unescaped_;
+  int unescaped_start = unescaped->length();
+  bool one_byte = true;
+  AddUnescaped(start, position_, &one_byte);
+
+  while (c0_ != '"') {
+    // Check for control character (0x00-0x1f) or unterminated string (<0).
+    if (c0_ < 0x20) return false;
+    if (c0_ != '\\') {
+      // Copy the run up to the next special character.
+      int run_start = position_;
+      position_ +=
+          JsonSpecialCharStart(chars_ + run_start, length_ - run_start) - 1;
+      Advance();
+      AddUnescaped(run_start, position_, &one_byte);
+      continue;
+    }
+    uc32 c;
+    Advance();  // Advance past the \.
+    switch (c0_) {
+      case '"':
+      case '\\':
+      case '/':
+        c = c0_;
+        break;
+      case 'b':
+        c = '\x08';
+        break;
+      case 'f':
+        c = '\x0c';
+        break;
+      case 'n':
+        c = '\x0a';
+        break;
+      case 'r':
+        c = '\x0d';
+        break;
+      case 't':
+        c = '\x09';
+        break;
+      case 'u': {
+        c = 0;
+        for (int i = 0; i < 4; i++) {
+          Advance();
+          int digit = HexValue(c0_);
+          if (digit < 0) return false;
+          c = c * 16 + digit;
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+    if (c > String::kMaxOneByteCharCode) one_byte = false;
+    unescaped->Add(static_cast<uc16>(c));
+    Advance();
+  }
+
+  slice->start = unescaped_start;
+  slice->length = unescaped->length() - unescaped_start;
+  slice->unescaped = true;
+  slice->one_byte = one_byte;
+  // Advance past the last '"'.
+  AdvanceSkipWhitespace();
+  return true;
+}
+
+
+template <typename Char>
+void JsonTokenizer<Char>::AddUnescaped(int from, int to, bool* one_byte) {
+  List<uc16>* unescaped = &tape_->unescaped_;
+  if (sizeof(Char) == 1 && tape_->utf8_) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(chars_);
+    size_t cursor = from;
+    while (cursor < static_cast<size_t>(to)) {
+      unibrow::uchar c =
+          unibrow::Utf8::ValueOf(bytes + cursor, to - cursor, &cursor);
+      if (c > String::kMaxOneByteCharCode) *one_byte = false;
+      if (c > unibrow::Utf16::kMaxNonSurrogateCharCode) {
+        unescaped->Add(unibrow::Utf16::LeadSurrogate(c));
+        unescaped->Add(unibrow::Utf16::TrailSurrogate(c));
+      } else {
+        unescaped->Add(static_cast<uc16>(c));
+      }
+    }
+    return;
+  }
+  for (int i = from; i < to; i++) {
+    if (chars_[i] > String::kMaxOneByteCharCode) *one_byte = false;
+    unescaped->Add(chars_[i]);
+  }
+}
+
+
+template <typename Char>
+int JsonTokenizer<Char>::ScanJsonKey() {
+  JsonTape::Key key;
+  if (!ScanJsonString(&key.name)) return -1;
+  if (!key.name.unescaped) {
+    int existing = LookupKey(key.name);
+    if (existing >= 0) return existing;
+  }
+
+  // Same as JsonParser::ParseElement: only canonical array indices up to
+  // 2^32 - 2 are stored as elements.
+  const JsonTape::Slice& name = key.name;
+  key.is_index = false;
+  key.index = 0;
+  if (name.length > 0) {
+    key.is_index = true;
+    for (int i = 0; i < name.length; i++) {
+      int c = name.unescaped ? tape_->unescaped_[name.start + i]
+                             : chars_[name.start + i];
+      int d = c - '0';
+      if (d < 0 || d > 9 || (d == 0 && i == 0 && name.length > 1) ||
+          key.index > 429496729U - ((d + 3) >> 3)) {
+        key.is_index = false;
+        break;
+      }
+      key.index = key.index * 10 + d;
+    }
+  }
+  tape_->keys_.Add(key);
+  return tape_->keys_.length() - 1;
+}
+
+
+// Returns the index of an earlier key with the same characters as |name|, or
+// adds |name| to the table as the next key and returns -1.
+template <typename Char>
+int JsonTokenizer<Char>::LookupKey(const JsonTape::Slice& name) {
+  int next = tape_->keys_.length();
+  if (2 * (next + 1) > key_table_capacity_) {
+    // Grow the table and re-insert the keys without escapes.
+    int capacity = Max(kInitialKeyTableCapacity, 2 * key_table_capacity_);
+    DeleteArray(key_table_);
+    key_table_ = NewArray<int>(capacity);
+    key_table_capacity_ = capacity;
+    memset(key_table_, 0, capacity * sizeof(int));
+    for (int key = 0; key < next; key++) {
+      const JsonTape::Slice& slice = tape_->keys_[key].name;
+      if (slice.unescaped) continue;
+      uint32_t hash = StringHasher::HashSequentialString(
+          KeyChars(key), slice.length, 0);
+      uint32_t entry = hash & (capacity - 1);
+      while (key_table_[entry] != 0) entry = (entry + 1) & (capacity - 1);
+      key_table_[entry] = key + 1;
+    }
+  }
+
+  const Char* chars = chars_ + name.start;
+  uint32_t hash =
+      StringHasher::HashSequentialString(chars, name.length, 0);
+  uint32_t mask = key_table_capacity_ - 1;
+  for (uint32_t entry = hash & mask;; entry = (entry + 1) & mask) {
+    int key = key_table_[entry] - 1;
+    if (key < 0) {
+      key_table_[entry] = next + 1;
+      return -1;
+    }
+    const JsonTape::Slice& slice = tape_->keys_[key].name;
+    if (slice.length == name.length &&
+        CompareChars(KeyChars(key), chars, name.length) == 0) {
+      return key;
+    }
+  }
+}
+
+
+// Creates the value of a tokenized JSON text. Objects are built the way
+// JsonParser builds them, following map transitions while possible.
+class JsonMaterializer BASE_EMBEDDED {
+ public:
+  JsonMaterializer(Isolate* isolate, JsonTape* tape)
+      : isolate_(isolate),
+        factory_(isolate->factory()),
+        tape_(tape),
+        cursor_(0),
+        object_constructor_(isolate->native_context()->object_function(),
+                            isolate) {
+    pretenure_ = tape->length_ >= JsonParser<true>::kPretenureTreshold
+                     ? TENURED
+                     : NOT_TENURED;
+    key_cache_ = factory_->NewFixedArray(tape->keys_.length());
+  }
+
+  Handle<Object> MaterializeJsonValue();
+
+ private:
+  Handle<Object> MaterializeJsonObject(int count);
+  Handle<Object> MaterializeJsonArray(int count);
+  Handle<String> MaterializeJsonString(const JsonTape::Slice& slice);
+  Handle<String> InternalizedKey(int key);
+
+  template <typename SinkChar>
+  void CopySlice(SinkChar* dest, const JsonTape::Slice& slice);
+
+  Vector<const char> Utf8Slice(const JsonTape::Slice& slice) {
+    DCHECK(tape_->utf8_ && !slice.unescaped);
+    return Vector<const char>(
+        reinterpret_cast<const char*>(tape_->one_byte_chars_) + slice.start,
+        slice.length);
+  }
+
+  void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
+                               ZoneList<Handle<Object> >* properties);
+
+  Zone* zone() { return &zone_; }
+
+  Isolate* isolate_;
+  Factory* factory_;
+  JsonTape* tape_;
+  int cursor_;
+  PretenureFlag pretenure_;
+  Zone zone_;
+  Handle<JSFunction> object_constructor_;
+  // Internalized keys, filled in as they are first used.
+  Handle<FixedArray> key_cache_;
+};
+
+
+Handle<Object> JsonMaterializer::MaterializeJsonValue() {
+  StackLimitCheck stack_check(isolate_);
+  if (stack_check.HasOverflowed()) {
+    isolate_->StackOverflow();
+    return Handle<Object>::null();
+  }
+
+  if (stack_check.InterruptRequested()) {
+    ExecutionAccess access(isolate_);
+    // Avoid blocking GC in long running parser (v8:3974).
+    isolate_->stack_guard()->HandleGCInterrupt();
+  }
+
+  uint32_t entry = tape_->entries_[cursor_++];
+  int payload = JsonTape::PayloadOf(entry);
+  switch (JsonTape::TagOf(entry)) {
+    case JsonTape::kNull:
+      return factory_->null_value();
+    case JsonTape::kTrue:
+      return factory_->true_value();
+    case JsonTape::kFalse:
+      return factory_->false_value();
+    case JsonTape::kSmi:
+      return Handle<Smi>(Smi::FromInt(payload), isolate_);
+    case JsonTape::kNumber:
+      return factory_->NewNumber(tape_->numbers_[payload], pretenure_);
+    case JsonTape::kString:
+      return MaterializeJsonString(tape_->strings_[payload]);
+    case JsonTape::kArray:
+      return MaterializeJsonArray(payload);
+    case JsonTape::kObject:
+      return MaterializeJsonObject(payload);
+  }
+  UNREACHABLE();
+  return Handle<Object>::null();
+}
+
+
+Handle<Object> JsonMaterializer::MaterializeJsonObject(int count) {
+  HandleScope scope(isolate_);
+  Handle<JSObject> json_object =
+      factory_->NewJSObject(object_constructor_, pretenure_);
+  Handle<Map> map(json_object->map());
+  int descriptor = 0;
+  ZoneList<Handle<Object> > properties(8, zone());
+  bool transitioning = true;
+
+  for (int i = 0; i < count; i++) {
+    uint32_t entry = tape_->entries_[cursor_++];
+    DCHECK_EQ(JsonTape::kString, JsonTape::TagOf(entry));
+    int key_index = JsonTape::PayloadOf(entry);
+    const JsonTape::Key& key = tape_->keys_[key_index];
+
+    if (key.is_index) {
+      Handle<Object> value = MaterializeJsonValue();
+      if (value.is_null()) return Handle<Object>::null();
+      JSObject::SetOwnElementIgnoreAttributes(json_object, key.index, value,
+                                              NONE)
+          .Assert();
+      continue;
+    }
+
+    Handle<String> name = InternalizedKey(key_index);
+    Handle<Object> value = MaterializeJsonValue();
+    if (value.is_null()) return Handle<Object>::null();
+
+    if (transitioning) {
+      Handle<Map> target = TransitionArray::FindTransitionToField(map, name);
+      if (!target.is_null()) {
+        PropertyDetails details =
+            target->instance_descriptors()->GetDetails(descriptor);
+        Representation expected_representation = details.representation();
+
+        if (value->FitsRepresentation(expected_representation)) {
+          if (expected_representation.IsHeapObject() &&
+              !target->instance_descriptors()
+                   ->GetFieldType(descriptor)
+                   ->NowContains(value)) {
+            Handle<FieldType> value_type(
+                value->OptimalType(isolate_, expected_representation));
+            Map::GeneralizeFieldType(target, descriptor,
+                                     expected_representation, value_type);
+          }
+          DCHECK(target->instance_descriptors()
+                     ->GetFieldType(descriptor)
+                     ->NowContains(value));
+          properties.Add(value, zone());
+          map = target;
+          descriptor++;
+          continue;
+        }
+      }
+      // Commit the intermediate state to the object and stop transitioning.
+      transitioning = false;
+      CommitStateToJsonObject(json_object, map, &properties);
+    }
+
+    JSObject::DefinePropertyOrElementIgnoreAttributes(json_object, name, value)
+        .Check();
+  }
+
+  // If we transitioned until the very end, transition the map now.
+  if (transitioning) CommitStateToJsonObject(json_object, map, &properties);
+  return scope.CloseAndEscape(json_object);
+}
+
+
+void JsonMaterializer::CommitStateToJsonObject(
+    Handle<JSObject> json_object, Handle<Map> map,
+    ZoneList<Handle<Object> >* properties) {
+  JSObject::AllocateStorageForMap(json_object, map);
+  DCHECK(!json_object->map()->is_dictionary_map());
+
+  DisallowHeapAllocation no_gc;
+
+  int length = properties->length();
+  for (int i = 0; i < length; i++) {
+    Handle<Object> value = (*properties)[i];
+    json_object->WriteToField(i, *value);
+  }
+}
+
+
+Handle<Object> JsonMaterializer::MaterializeJsonArray(int count) {
+  HandleScope scope(isolate_);
+  // The length is known up front, so the elements go straight into their
+  // backing store.
+  Handle<FixedArray> fast_elements =
+      factory_->NewFixedArray(count, pretenure_);
+  for (int i = 0; i < count; i++) {
+    Handle<Object> element = MaterializeJsonValue();
+    if (element.is_null()) return Handle<Object>::null();
+    fast_elements->set(i, *element);
+  }
+  Handle<Object> json_array = factory_->NewJSArrayWithElements(
+      fast_elements, FAST_ELEMENTS, Strength::WEAK, pretenure_);
+  return scope.CloseAndEscape(json_array);
+}
+
+
+template <typename SinkChar>
+void JsonMaterializer::CopySlice(SinkChar* dest, const JsonTape::Slice& slice) {
+  if (slice.unescaped) {
+    CopyChars(dest, &tape_->unescaped_[slice.start], slice.length);
+  } else if (tape_->one_byte_chars_ != NULL) {
+    CopyChars(dest, tape_->one_byte_chars_ + slice.start, slice.length);
+  } else {
+    CopyChars(dest, tape_->two_byte_chars_ + slice.start, slice.length);
+  }
+}
+
+
+Handle<String> JsonMaterializer::MaterializeJsonString(
+    const JsonTape::Slice& slice) {
+  if (slice.length == 0) return factory_->empty_string();
+  if (tape_->utf8_ && !slice.one_byte && !slice.unescaped) {
+    Handle<String> result;
+    // Fails if the decoded string is too long.
+    if (!factory_->NewStringFromUtf8(Utf8Slice(slice), pretenure_)
+             .ToHandle(&result)) {
+      return Handle<String>::null();
+    }
+    return result;
+  }
+  if (slice.one_byte) {
+    Handle<SeqOneByteString> result =
+        factory_->NewRawOneByteString(slice.length, pretenure_)
+            .ToHandleChecked();
+    DisallowHeapAllocation no_gc;
+    CopySlice(result->GetChars(), slice);
+    return result;
+  }
+  Handle<SeqTwoByteString> result =
+      factory_->NewRawTwoByteString(slice.length, pretenure_)
+          .ToHandleChecked();
+  DisallowHeapAllocation no_gc;
+  CopySlice(result->GetChars(), slice);
+  return result;
+}
+
+
+Handle<String> JsonMaterializer::InternalizedKey(int key) {
+  Object* cached = key_cache_->get(key);
+  if (cached->IsString()) return Handle<String>(String::cast(cached), isolate_);
+
+  const JsonTape::Slice& name = tape_->keys_[key].name;
+  Handle<String> result;
+  if (tape_->utf8_ && !name.one_byte && !name.unescaped) {
+    result = factory_->InternalizeUtf8String(Utf8Slice(name));
+  } else if (name.one_byte && !name.unescaped &&
+             tape_->one_byte_chars_ != NULL) {
+    result = factory_->InternalizeOneByteString(Vector<const uint8_t>(
+        tape_->one_byte_chars_ + name.start, name.length));
+  } else if (name.one_byte) {
+    Vector<uint8_t> buffer = Vector<uint8_t>::New(name.length);
+    CopySlice(buffer.start(), name);
+    result = factory_->InternalizeOneByteString(
+        Vector<const uint8_t>(buffer.start(), name.length));
+    buffer.Dispose();
+  } else {
+    Vector<uc16> buffer = Vector<uc16>::New(name.length);
+    CopySlice(buffer.start(), name);
+    result = factory_->InternalizeTwoByteString(
+        Vector<const uc16>(buffer.start(), name.length));
+    buffer.Dispose();
+  }
+  key_cache_->set(key, *result);
+  return result;
+}
+
+
+JsonTape::JsonTape()
+    : utf8_(false),
+      one_byte_chars_(NULL),
+      two_byte_chars_(NULL),
+      copied_chars_(NULL),
+      length_(0),
+      tokenized_(false),
+      stack_overflow_(false),
+      too_deep_(false),
+      error_position_(-1),
+      error_char_(0) {}
+
+
+JsonTape::~JsonTape() {
+  if (!source_.is_null()) {
+    GlobalHandles::Destroy(Handle<Object>::cast(source_).location());
+  }
+  free(copied_chars_);
+}
+
+
+void JsonTape::Initialize(Isolate* isolate, Handle<String> source) {
+  DCHECK(!is_initialized());
+  source = String::Flatten(source);
+  source_ = Handle<String>::cast(isolate->global_handles()->Create(*source));
+  length_ = source->length();
+
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent();
+  DCHECK(content.IsFlat());
+  if (content.IsOneByte()) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    if (source->IsExternalString()) {
+      one_byte_chars_ = chars.start();
+    } else {
+      copied_chars_ = malloc(length_);
+      CHECK(copied_chars_ != NULL || length_ == 0);
+      CopyChars(static_cast<uint8_t*>(copied_chars_), chars.start(), length_);
+      one_byte_chars_ = static_cast<const uint8_t*>(copied_chars_);
+    }
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    if (source->IsExternalString()) {
+      two_byte_chars_ = chars.start();
+    } else {
+      copied_chars_ = malloc(length_ * kUC16Size);
+      CHECK(copied_chars_ != NULL || length_ == 0);
+      CopyChars(static_cast<uc16*>(copied_chars_), chars.start(), length_);
+      two_byte_chars_ = static_cast<const uc16*>(copied_chars_);
+    }
+  }
+}
+
+
+void JsonTape::InitializeUtf8(const char* data, int length) {
+  DCHECK(!is_initialized());
+  utf8_ = true;
+  one_byte_chars_ = reinterpret_cast<const uint8_t*>(data);
+  length_ = length;
+}
+
+
+void JsonTape::Tokenize(uintptr_t stack_limit, int max_depth) {
+  DCHECK(is_initialized());
+  DCHECK(!tokenized_);
+  if (one_byte_chars_ != NULL || length_ == 0) {
+    JsonTokenizer<uint8_t>(this, one_byte_chars_, stack_limit, max_depth)
+        .Tokenize();
+  } else {
+    JsonTokenizer<uc16>(this, two_byte_chars_, stack_limit, max_depth)
+        .Tokenize();
+  }
+  tokenized_ = true;
+}
+
+
+void JsonTape::Reset() {
+  entries_.Clear();
+  numbers_.Clear();
+  strings_.Clear();
+  keys_.Clear();
+  unescaped_.Clear();
+  tokenized_ = false;
+  stack_overflow_ = false;
+  too_deep_ = false;
+  error_position_ = -1;
+  error_char_ = 0;
+}
+
+
+MaybeHandle<Object> JsonTape::Materialize(Isolate* isolate) {
+  DCHECK(tokenized_);
+  if (too_deep_) {
+    // Nested deeper than the background thread could take; tokenize it again
+    // with the stack of the main thread.
+    Reset();
+    Tokenize(isolate->stack_guard()->real_climit());
+  }
+  if (stack_overflow_) {
+    isolate->StackOverflow();
+    return MaybeHandle<Object>();
+  }
+  if (error_position_ >= 0) {
+    if (utf8_) return ThrowUtf8ParseError(isolate);
+    return ThrowJsonParseError(isolate, source_, error_position_, error_char_);
+  }
+  JsonMaterializer materializer(isolate, this);
+  Handle<Object> result = materializer.MaterializeJsonValue();
+  if (result.is_null()) return MaybeHandle<Object>();
+  return result;
+}
+
+
+// Decodes the source to report the error the way JSON.parse would for the
+// decoded string, with the position counted in UTF-16 code units.
+MaybeHandle<Object> JsonTape::ThrowUtf8ParseError(Isolate* isolate) {
+  Vector<const char> bytes(reinterpret_cast<const char*>(one_byte_chars_),
+                           length_);
+  Handle<String> source;
+  if (!isolate->factory()->NewStringFromUtf8(bytes).ToHandle(&source)) {
+    return MaybeHandle<Object>();
+  }
+  int position;
+  {
+    Access<UnicodeCache::Utf8Decoder> decoder(
+        isolate->unicode_cache()->utf8_decoder());
+    decoder->Reset(bytes.start(), error_position_);
+    position = static_cast<int>(decoder->Utf16Length());
+  }
+  uc32 c0 = error_char_;
+  if (c0 > static_cast<uc32>(unibrow::Utf8::kMaxOneByteChar)) {
+    size_t cursor = 0;
+    unibrow::uchar c = unibrow::Utf8::ValueOf(
+        one_byte_chars_ + error_position_, length_ - error_position_, &cursor);
+    c0 = c > unibrow::Utf16::kMaxNonSurrogateCharCode
+             ? unibrow::Utf16::LeadSurrogate(c)
+             : c;
+  }
+  return ThrowJsonParseError(isolate, source, position, c0);
+}
+
+
+void BackgroundJsonParsingTask::Run() {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+
+  // The stack of the embedder's thread is unknown, so bound the nesting
+  // instead of checking a stack limit.
+  tape_->Tokenize(0, kMaxNestingDepth);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,138 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_TAPE_H_
+#define V8_JSON_TAPE_H_
+
+#include "include/v8.h"
+#include "src/handles.h"
+#include "src/list.h"
+#include "src/unicode-cache.h"
+
+namespace v8 {
+namespace internal {
+
+// Internal representation of v8::JSON::BackgroundSource, also used to parse
+// UTF-8 without decoding all of it. Tokenize scans and validates a JSON text
+// into a compact tape without touching the heap, so it can run on a
+// background thread. Materialize then only has to create the objects, arrays,
+// strings and heap numbers on the main thread.
+class JsonTape {
+ public:
+  JsonTape();
+  ~JsonTape();
+
+  // Main thread. Keeps |source| alive and makes its characters available to
+  // Tokenize: external strings are read in place, sequential strings are
+  // copied since the GC may move them.
+  void Initialize(Isolate* isolate, Handle<String> source);
+
+  // Same for a UTF-8 text, which is read in place and has to outlive the
+  // tape. Strings are decoded when they are materialized.
+  void InitializeUtf8(const char* data, int length);
+
+  // Any thread. Scans the whole source, recording the first error. Nesting
+  // that reaches |stack_limit| is reported as a stack overflow. Objects and
+  // arrays nested deeper than |max_depth| stop the scan, leaving it to
+  // Materialize to scan the source again.
+  void Tokenize(uintptr_t stack_limit, int max_depth = kMaxInt);
+
+  // Main thread, after Tokenize. Creates the value of the source or throws
+  // the error Tokenize found, tokenizing it again first if it was nested
+  // deeper than the max_depth passed to Tokenize.
+  MaybeHandle<Object> Materialize(Isolate* isolate);
+
+  bool is_tokenized() const { return tokenized_; }
+
+ private:
+  MaybeHandle<Object> ThrowUtf8ParseError(Isolate* isolate);
+
+  // Drops the result of Tokenize.
+  void Reset();
+
+  template <typename Char>
+  friend class JsonTokenizer;
+  friend class JsonMaterializer;
+
+  // Whether |source_| has been set or one_byte_chars_ holds UTF-8.
+  bool is_initialized() const { return !source_.is_null() || utf8_; }
+
+  // Every entry has a 3 bit tag and a 29 bit payload. Arrays and objects
+  // are followed by their elements and by key/value entry pairs; the payload
+  // is the count. Strings index strings_ as values and keys_ as keys.
+  enum Tag { kNull, kTrue, kFalse, kSmi, kNumber, kString, kArray, kObject };
+  static const int kTagBits = 3;
+  static const uint32_t kTagMask = (1 << kTagBits) - 1;
+  static const int kMaxInlineSmi = (1 << (31 - kTagBits)) - 1;
+  static const int kMinInlineSmi = -kMaxInlineSmi - 1;
+
+  static uint32_t Encode(Tag tag, int payload) {
+    return (static_cast<uint32_t>(payload) << kTagBits) | tag;
+  }
+  static Tag TagOf(uint32_t entry) {
+    return static_cast<Tag>(entry & kTagMask);
+  }
+  static int PayloadOf(uint32_t entry) {
+    return static_cast<int32_t>(entry) >> kTagBits;
+  }
+
+  // The characters of a string: a range of the source if it has no escapes,
+  // otherwise a range of unescaped_.
+  struct Slice {
+    int start;
+    int length;
+    bool unescaped;
+    bool one_byte;  // All characters are Latin1, or ASCII in UTF-8.
+  };
+
+  // A property name. Names without escapes are only stored once, so that the
+  // main thread internalizes each of them once.
+  struct Key {
+    Slice name;
+    bool is_index;
+    uint32_t index;
+  };
+
+  Handle<String> source_;  // Global handle, or null for UTF-8.
+  bool utf8_;
+  const uint8_t* one_byte_chars_;
+  const uc16* two_byte_chars_;
+  void* copied_chars_;
+  int length_;  // In bytes for UTF-8.
+  UnicodeCache unicode_cache_;
+
+  List<uint32_t> entries_;
+  List<double> numbers_;
+  List<Slice> strings_;
+  List<Key> keys_;
+  List<uc16> unescaped_;
+
+  bool tokenized_;
+  bool stack_overflow_;
+  bool too_deep_;  // Nested deeper than the max_depth passed to Tokenize.
+  int error_position_;  // -1 if the source is valid JSON.
+  uc32 error_char_;
+
+  DISALLOW_COPY_AND_ASSIGN(JsonTape);
+};
+
+
+class BackgroundJsonParsingTask : public JSON::ParsingTask {
+ public:
+  explicit BackgroundJsonParsingTask(JsonTape* tape) : tape_(tape) {}
+
+  virtual void Run();
+
+ private:
+  // Small enough for the tokenizer to fit in the stack of any thread the
+  // embedder may run the task on.
+  static const int kMaxNestingDepth = 256;
+
+  JsonTape* tape_;  // Not owned.
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_TAPE_H_
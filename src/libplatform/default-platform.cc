@@ -30,20 +30,32 @@ bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate) {
 }
 
 
-const int DefaultPlatform::kMaxThreadPoolSize = 4;
+void SetTracingController(
+    v8::Platform* platform,
+    v8::platform::tracing::TracingController* tracing_controller) {
+  reinterpret_cast<DefaultPlatform*>(platform)->SetTracingController(
+      tracing_controller);
+}
+
+
+const int DefaultPlatform::kMaxThreadPoolSize = 16;
 
 
 DefaultPlatform::DefaultPlatform()
-    : initialized_(false), thread_pool_size_(0) {}
+    : initialized_(false),
+      thread_pool_size_(0),
+      queue_(NULL),
+      tracing_controller_(NULL) {}
 
 
 DefaultPlatform::~DefaultPlatform() {
   base::LockGuard<base::Mutex> guard(&lock_);
-  queue_.Terminate();
   if (initialized_) {
+    queue_->Terminate();
     for (auto i = thread_pool_.begin(); i != thread_pool_.end(); ++i) {
       delete *i;
     }
+    delete queue_;
   }
   for (auto i = main_thread_queue_.begin(); i != main_thread_queue_.end();
        ++i) {
@@ -59,6 +71,7 @@ DefaultPlatform::~DefaultPlatform() {
       i->second.pop();
     }
   }
+  delete tracing_controller_;
 }
 
 
@@ -78,8 +91,11 @@ void DefaultPlatform::EnsureInitialized() {
   if (initialized_) return;
   initialized_ = true;
 
-  for (int i = 0; i < thread_pool_size_; ++i)
-    thread_pool_.push_back(new WorkerThread(&queue_));
+  // SetThreadPoolSize may not have been called.
+  int thread_pool_size = std::max(thread_pool_size_, 1);
+  queue_ = new WorkStealingTaskQueue(thread_pool_size);
+  for (int i = 0; i < thread_pool_size; ++i)
+    thread_pool_.push_back(new WorkerThread(queue_, i));
 }
 
 
@@ -136,7 +152,7 @@ bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
 void DefaultPlatform::CallOnBackgroundThread(Task *task,
                                              ExpectedRuntime expected_runtime) {
   EnsureInitialized();
-  queue_.Append(task);
+  queue_->Append(task, expected_runtime);
 }
 
 
@@ -174,15 +190,25 @@ uint64_t DefaultPlatform::AddTraceEvent(
     char phase, const uint8_t* category_enabled_flag, const char* name,
     uint64_t id, uint64_t bind_id, int num_args, const char** arg_names,
     const uint8_t* arg_types, const uint64_t* arg_values, unsigned int flags) {
-  return 0;
+  if (tracing_controller_ == NULL) return 0;
+  return tracing_controller_->AddTraceEvent(phase, category_enabled_flag, name,
+                                            id, bind_id, num_args, arg_names,
+                                            arg_types, arg_values, flags);
 }
 
 
 void DefaultPlatform::UpdateTraceEventDuration(
-    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {}
+    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {
+  if (tracing_controller_ == NULL) return;
+  tracing_controller_->UpdateTraceEventDuration(category_enabled_flag, name,
+                                                handle);
+}
 
 
 const uint8_t* DefaultPlatform::GetCategoryGroupEnabled(const char* name) {
+  if (tracing_controller_ != NULL) {
+    return tracing_controller_->GetCategoryGroupEnabled(name);
+  }
   static uint8_t no = 0;
   return &no;
 }
@@ -190,10 +216,20 @@ const uint8_t* DefaultPlatform::GetCategoryGroupEnabled(const char* name) {
 
 const char* DefaultPlatform::GetCategoryGroupName(
     const uint8_t* category_enabled_flag) {
+  if (tracing_controller_ != NULL) {
+    return tracing::TracingController::GetCategoryGroupName(
+        category_enabled_flag);
+  }
   static const char dummy[] = "dummy";
   return dummy;
 }
 
+void DefaultPlatform::SetTracingController(
+    tracing::TracingController* tracing_controller) {
+  delete tracing_controller_;
+  tracing_controller_ = tracing_controller;
+}
+
 size_t DefaultPlatform::NumberOfAvailableBackgroundThreads() {
   return static_cast<size_t>(thread_pool_size_);
 }
@@ -10,15 +10,15 @@
 #include <queue>
 #include <vector>
 
+#include "include/libplatform/v8-tracing.h"
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
-#include "src/libplatform/task-queue.h"
+#include "src/libplatform/work-stealing-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
-class TaskQueue;
 class Thread;
 class WorkerThread;
 
@@ -33,6 +33,9 @@ class DefaultPlatform : public Platform {
 
   bool PumpMessageLoop(v8::Isolate* isolate);
 
+  // Takes ownership of |tracing_controller|.
+  void SetTracingController(tracing::TracingController* tracing_controller);
+
   // v8::Platform implementation.
   size_t NumberOfAvailableBackgroundThreads() override;
   void CallOnBackgroundThread(Task* task,
@@ -65,7 +68,10 @@ class DefaultPlatform : public Platform {
   bool initialized_;
   int thread_pool_size_;
   std::vector<WorkerThread*> thread_pool_;
-  TaskQueue queue_;
+  // Created together with the thread pool in EnsureInitialized.
+  WorkStealingTaskQueue* queue_;
+  // Trace events are dropped if no controller is set.
+  tracing::TracingController* tracing_controller_;
   std::map<v8::Isolate*, std::queue<Task*> > main_thread_queue_;
 
   typedef std::pair<double, Task*> DelayedEntry;
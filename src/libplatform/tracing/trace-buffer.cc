@@ -0,0 +1,56 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/tracing/trace-buffer.h"
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+ThreadTraceBuffer::ThreadTraceBuffer(uint32_t buffer_id, size_t capacity)
+    : buffer_id_(buffer_id),
+      capacity_(capacity),
+      events_(new TraceObject[capacity]),
+      num_events_(0),
+      sequence_base_(0),
+      writing_(0) {
+  DCHECK_LT(0u, capacity);
+}
+
+ThreadTraceBuffer::~ThreadTraceBuffer() { delete[] events_; }
+
+TraceObject* ThreadTraceBuffer::AddTraceEvent(bool overwrite,
+                                              uint64_t* handle) {
+  if (num_events_ >= capacity_ && !overwrite) return nullptr;
+  uint64_t sequence = sequence_base_ + num_events_++;
+  *handle = (static_cast<uint64_t>(buffer_id_ + 1) << kSequenceBits) |
+            (sequence & kSequenceMask);
+  return &events_[sequence % capacity_];
+}
+
+TraceObject* ThreadTraceBuffer::GetEventByHandle(uint64_t handle) {
+  if (handle == 0 || BufferIdOf(handle) != buffer_id_) return nullptr;
+  uint64_t sequence = handle & kSequenceMask;
+  uint64_t end = (sequence_base_ + num_events_) & kSequenceMask;
+  // Events older than the last |capacity_| ones have been overwritten.
+  uint64_t age = (end - sequence) & kSequenceMask;
+  if (age == 0 || age > capacity_ || age > num_events_) return nullptr;
+  return &events_[sequence % capacity_];
+}
+
+void ThreadTraceBuffer::Flush(TraceWriter* trace_writer) {
+  uint64_t end = sequence_base_ + num_events_;
+  uint64_t begin = num_events_ > capacity_ ? end - capacity_ : sequence_base_;
+  for (uint64_t sequence = begin; sequence < end; ++sequence) {
+    trace_writer->AppendTraceEvent(&events_[sequence % capacity_]);
+  }
+  sequence_base_ = end;
+  num_events_ = 0;
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
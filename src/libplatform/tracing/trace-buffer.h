@@ -0,0 +1,73 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
+#define V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
+
+#include "include/libplatform/v8-tracing.h"
+#include "src/base/atomicops.h"
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+// The trace events of a single thread. Only the owning thread adds events;
+// the buffer is flushed by the thread that stops tracing, once the owner has
+// finished writing (see TracingController::StopTracing).
+class ThreadTraceBuffer {
+ public:
+  ThreadTraceBuffer(uint32_t buffer_id, size_t capacity);
+  ~ThreadTraceBuffer();
+
+  uint32_t buffer_id() const { return buffer_id_; }
+
+  // Returns the object to record a new event in, or nullptr if the buffer is
+  // full and |overwrite| is false. Otherwise the oldest event is overwritten.
+  // |handle| is set to a nonzero value that identifies the new event.
+  TraceObject* AddTraceEvent(bool overwrite, uint64_t* handle);
+
+  // Returns the event identified by |handle|, or nullptr if it has been
+  // overwritten or flushed since.
+  TraceObject* GetEventByHandle(uint64_t handle);
+
+  // Appends all events to |trace_writer|, oldest first, and clears the buffer.
+  void Flush(TraceWriter* trace_writer);
+
+  // Returns the id of the buffer that |handle| belongs to.
+  static uint32_t BufferIdOf(uint64_t handle) {
+    return static_cast<uint32_t>(handle >> kSequenceBits) - 1;
+  }
+
+  // The owning thread brackets its accesses to the buffer with these, so that
+  // StopTracing can wait for events that are being recorded.
+  void BeginWrite() {
+    base::NoBarrier_Store(&writing_, 1);
+    base::MemoryBarrier();
+  }
+  void EndWrite() { base::Release_Store(&writing_, 0); }
+  bool IsWriting() { return base::Acquire_Load(&writing_) != 0; }
+
+ private:
+  static const int kSequenceBits = 40;
+  static const uint64_t kSequenceMask = (uint64_t{1} << kSequenceBits) - 1;
+
+  uint32_t buffer_id_;
+  size_t capacity_;
+  TraceObject* events_;
+  // Number of events added since the last flush. Events past the capacity
+  // wrapped around.
+  uint64_t num_events_;
+  // Keeps handles of flushed events from matching new events.
+  uint64_t sequence_base_;
+  base::Atomic32 writing_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadTraceBuffer);
+};
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
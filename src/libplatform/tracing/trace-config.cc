@@ -0,0 +1,80 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include "include/libplatform/v8-tracing.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+namespace {
+
+const char kDisabledByDefaultPrefix[] = "disabled-by-default-";
+
+bool StartsWith(const std::string& str, const std::string& prefix) {
+  return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool MatchesPattern(const std::string& pattern, const std::string& category) {
+  if (pattern.empty() || pattern[pattern.size() - 1] != '*') {
+    return pattern == category;
+  }
+  std::string prefix = pattern.substr(0, pattern.size() - 1);
+  // Wildcards only select disabled-by-default categories if the pattern
+  // explicitly asks for them.
+  if (StartsWith(category, kDisabledByDefaultPrefix) &&
+      !StartsWith(prefix, kDisabledByDefaultPrefix)) {
+    return false;
+  }
+  return StartsWith(category, prefix);
+}
+
+bool MatchesAnyPattern(const TraceConfig::StringList& patterns,
+                       const std::string& category) {
+  for (const std::string& pattern : patterns) {
+    if (MatchesPattern(pattern, category)) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+TraceConfig* TraceConfig::CreateDefaultTraceConfig() {
+  TraceConfig* trace_config = new TraceConfig();
+  trace_config->included_categories_.push_back("v8");
+  return trace_config;
+}
+
+void TraceConfig::AddIncludedCategory(const char* included_category) {
+  DCHECK(included_category != NULL && strlen(included_category) > 0);
+  included_categories_.push_back(included_category);
+}
+
+void TraceConfig::AddExcludedCategory(const char* excluded_category) {
+  DCHECK(excluded_category != NULL && strlen(excluded_category) > 0);
+  excluded_categories_.push_back(excluded_category);
+}
+
+bool TraceConfig::IsCategoryGroupEnabled(const char* category_group) const {
+  const char* begin = category_group;
+  while (true) {
+    const char* end = strchr(begin, ',');
+    std::string category =
+        end == NULL ? std::string(begin) : std::string(begin, end - begin);
+    if (!category.empty() &&
+        !MatchesAnyPattern(excluded_categories_, category) &&
+        MatchesAnyPattern(included_categories_, category)) {
+      return true;
+    }
+    if (end == NULL) return false;
+    begin = end + 1;
+  }
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
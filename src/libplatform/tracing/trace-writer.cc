@@ -0,0 +1,188 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/tracing/trace-writer.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "base/trace_event/common/trace_event_common.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+JSONTraceWriter::JSONTraceWriter(std::ostream& stream)
+    : stream_(stream), object_open_(false), append_comma_(false) {}
+
+JSONTraceWriter::~JSONTraceWriter() {
+  if (object_open_) Flush();
+}
+
+void JSONTraceWriter::BeginObject() {
+  stream_ << "{\"traceEvents\":[";
+  object_open_ = true;
+  append_comma_ = false;
+}
+
+void JSONTraceWriter::AppendString(const char* str) {
+  if (str == NULL) {
+    stream_ << "null";
+    return;
+  }
+  stream_ << "\"";
+  for (const char* p = str; *p != '\0'; ++p) {
+    switch (*p) {
+      case '"':
+        stream_ << "\\\"";
+        break;
+      case '\\':
+        stream_ << "\\\\";
+        break;
+      case '\b':
+        stream_ << "\\b";
+        break;
+      case '\f':
+        stream_ << "\\f";
+        break;
+      case '\n':
+        stream_ << "\\n";
+        break;
+      case '\r':
+        stream_ << "\\r";
+        break;
+      case '\t':
+        stream_ << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(*p) < 0x20) {
+          static const char kHexDigits[] = "0123456789abcdef";
+          stream_ << "\\u00" << kHexDigits[(*p >> 4) & 0xf]
+                  << kHexDigits[*p & 0xf];
+        } else {
+          stream_ << *p;
+        }
+        break;
+    }
+  }
+  stream_ << "\"";
+}
+
+void JSONTraceWriter::AppendArgValue(uint8_t type,
+                                     TraceObject::ArgValue value) {
+  switch (type) {
+    case TRACE_VALUE_TYPE_BOOL:
+      stream_ << (value.as_bool ? "true" : "false");
+      break;
+    case TRACE_VALUE_TYPE_UINT:
+      stream_ << value.as_uint;
+      break;
+    case TRACE_VALUE_TYPE_INT:
+      stream_ << value.as_int;
+      break;
+    case TRACE_VALUE_TYPE_DOUBLE: {
+      double val = value.as_double;
+      if (std::isfinite(val)) {
+        std::ostringstream convert_stream;
+        convert_stream << val;
+        std::string real = convert_stream.str();
+        // Keep the value a double when it is read back.
+        if (real.find_first_of(".eE") == std::string::npos) real += ".0";
+        stream_ << real;
+      } else if (std::isnan(val)) {
+        // JSON has no NaN and Infinity literals.
+        stream_ << "\"NaN\"";
+      } else {
+        stream_ << (val < 0 ? "\"-Infinity\"" : "\"Infinity\"");
+      }
+      break;
+    }
+    case TRACE_VALUE_TYPE_POINTER:
+      stream_ << "\"0x" << std::hex
+              << reinterpret_cast<uintptr_t>(value.as_pointer) << std::dec
+              << "\"";
+      break;
+    case TRACE_VALUE_TYPE_STRING:
+    case TRACE_VALUE_TYPE_COPY_STRING:
+      AppendString(value.as_string);
+      break;
+    default:
+      // Convertable values are not supported.
+      stream_ << "null";
+      break;
+  }
+}
+
+void JSONTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  if (!object_open_) BeginObject();
+  if (append_comma_) stream_ << ",";
+  append_comma_ = true;
+  stream_ << "{\"pid\":" << trace_event->pid()
+          << ",\"tid\":" << trace_event->tid()
+          << ",\"ts\":" << trace_event->ts() << ",\"ph\":\""
+          << trace_event->phase() << "\",\"cat\":";
+  AppendString(TracingController::GetCategoryGroupName(
+      trace_event->category_enabled_flag()));
+  stream_ << ",\"name\":";
+  AppendString(trace_event->name());
+  if (trace_event->phase() == TRACE_EVENT_PHASE_COMPLETE) {
+    stream_ << ",\"dur\":" << trace_event->duration();
+  }
+  unsigned int flags = trace_event->flags();
+  if (flags & TRACE_EVENT_FLAG_HAS_ID) {
+    stream_ << ",\"id\":\"0x" << std::hex << trace_event->id() << std::dec
+            << "\"";
+  }
+  if (flags & TRACE_EVENT_FLAG_BIND_TO_ENCLOSING) {
+    stream_ << ",\"bp\":\"e\"";
+  }
+  if (flags & (TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT)) {
+    stream_ << ",\"bind_id\":\"0x" << std::hex << trace_event->bind_id()
+            << std::dec << "\"";
+    if (flags & TRACE_EVENT_FLAG_FLOW_IN) stream_ << ",\"flow_in\":true";
+    if (flags & TRACE_EVENT_FLAG_FLOW_OUT) stream_ << ",\"flow_out\":true";
+  }
+  if (trace_event->phase() == TRACE_EVENT_PHASE_INSTANT) {
+    char scope;
+    switch (flags & TRACE_EVENT_FLAG_SCOPE_MASK) {
+      case TRACE_EVENT_SCOPE_GLOBAL:
+        scope = TRACE_EVENT_SCOPE_NAME_GLOBAL;
+        break;
+      case TRACE_EVENT_SCOPE_PROCESS:
+        scope = TRACE_EVENT_SCOPE_NAME_PROCESS;
+        break;
+      default:
+        scope = TRACE_EVENT_SCOPE_NAME_THREAD;
+        break;
+    }
+    stream_ << ",\"s\":\"" << scope << "\"";
+  }
+  stream_ << ",\"args\":{";
+  const char** arg_names = trace_event->arg_names();
+  const uint8_t* arg_types = trace_event->arg_types();
+  TraceObject::ArgValue* arg_values = trace_event->arg_values();
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    if (i > 0) stream_ << ",";
+    AppendString(arg_names[i]);
+    stream_ << ":";
+    AppendArgValue(arg_types[i], arg_values[i]);
+  }
+  stream_ << "}}";
+}
+
+void JSONTraceWriter::Flush() {
+  if (!object_open_) BeginObject();
+  stream_ << "]}";
+  object_open_ = false;
+  stream_.flush();
+}
+
+TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream& stream) {
+  return new JSONTraceWriter(stream);
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
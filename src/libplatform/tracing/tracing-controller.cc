@@ -0,0 +1,194 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include "include/libplatform/v8-tracing.h"
+#include "src/base/atomicops.h"
+#include "src/base/logging.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/libplatform/tracing/trace-buffer.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+namespace {
+
+// Matches kEnabledForRecording_CategoryGroupEnabledFlags in
+// src/tracing/trace-event.h.
+const uint8_t kEnabledForRecording = 1 << 0;
+
+// The category groups are registered process wide, since the
+// TRACE_EVENT* macros cache the enabled flag of their category group.
+const int kMaxCategoryGroups = 200;
+
+// Returned once all slots are taken. Never enabled.
+const int kCategoryCategoriesExhausted = 0;
+const char* g_category_groups[kMaxCategoryGroups] = {
+    "tracing categories exhausted; must increase kMaxCategoryGroups"};
+uint8_t g_category_group_enabled[kMaxCategoryGroups] = {0};
+
+// Number of used slots. Slots are published with a release store, so the
+// groups can be looked up without taking the lock.
+base::Atomic32 g_category_index = 1;
+base::LazyMutex g_category_mutex = LAZY_MUTEX_INITIALIZER;
+
+}  // namespace
+
+TracingController::TracingController()
+    : trace_writer_(nullptr),
+      trace_config_(nullptr),
+      events_per_thread_(kDefaultEventsPerThread),
+      mutex_(new base::Mutex()),
+      buffer_key_(base::Thread::CreateThreadLocalKey()),
+      recording_(0) {}
+
+TracingController::~TracingController() {
+  for (ThreadTraceBuffer* buffer : buffers_) delete buffer;
+  base::Thread::DeleteThreadLocalKey(buffer_key_);
+  delete trace_writer_;
+  delete trace_config_;
+  delete mutex_;
+}
+
+void TracingController::Initialize(TraceWriter* trace_writer,
+                                   size_t events_per_thread) {
+  DCHECK_LT(0u, events_per_thread);
+  DCHECK(buffers_.empty());
+  delete trace_writer_;
+  trace_writer_ = trace_writer;
+  events_per_thread_ = events_per_thread;
+}
+
+const uint8_t* TracingController::GetCategoryGroupEnabled(
+    const char* category_group) {
+  // Fast path: the group has been registered before.
+  int category_index = base::Acquire_Load(&g_category_index);
+  for (int i = 0; i < category_index; ++i) {
+    if (strcmp(g_category_groups[i], category_group) == 0) {
+      return &g_category_group_enabled[i];
+    }
+  }
+
+  base::LockGuard<base::Mutex> guard(g_category_mutex.Pointer());
+  // Another thread may have registered the group in the meantime.
+  category_index = base::NoBarrier_Load(&g_category_index);
+  for (int i = 0; i < category_index; ++i) {
+    if (strcmp(g_category_groups[i], category_group) == 0) {
+      return &g_category_group_enabled[i];
+    }
+  }
+  if (category_index >= kMaxCategoryGroups) {
+    return &g_category_group_enabled[kCategoryCategoriesExhausted];
+  }
+  // The name is leaked, the enabled flag may be cached forever.
+  g_category_groups[category_index] = strdup(category_group);
+  bool enabled = base::Acquire_Load(&recording_) &&
+                 trace_config_->IsCategoryGroupEnabled(category_group);
+  g_category_group_enabled[category_index] =
+      enabled ? kEnabledForRecording : 0;
+  base::Release_Store(&g_category_index, category_index + 1);
+  return &g_category_group_enabled[category_index];
+}
+
+// static
+const char* TracingController::GetCategoryGroupName(
+    const uint8_t* category_enabled_flag) {
+  uintptr_t category_begin =
+      reinterpret_cast<uintptr_t>(g_category_group_enabled);
+  uintptr_t category_ptr = reinterpret_cast<uintptr_t>(category_enabled_flag);
+  DCHECK(category_ptr >= category_begin &&
+         category_ptr < category_begin + sizeof(g_category_group_enabled));
+  return g_category_groups[category_ptr - category_begin];
+}
+
+ThreadTraceBuffer* TracingController::GetThreadTraceBuffer() {
+  ThreadTraceBuffer* buffer = reinterpret_cast<ThreadTraceBuffer*>(
+      base::Thread::GetThreadLocal(buffer_key_));
+  if (buffer == nullptr) {
+    base::LockGuard<base::Mutex> guard(mutex_);
+    buffer = new ThreadTraceBuffer(static_cast<uint32_t>(buffers_.size()),
+                                   events_per_thread_);
+    buffers_.push_back(buffer);
+    base::Thread::SetThreadLocal(buffer_key_, buffer);
+  }
+  return buffer;
+}
+
+uint64_t TracingController::AddTraceEvent(
+    char phase, const uint8_t* category_enabled_flag, const char* name,
+    uint64_t id, uint64_t bind_id, int num_args, const char** arg_names,
+    const uint8_t* arg_types, const uint64_t* arg_values, unsigned int flags) {
+  if (!base::NoBarrier_Load(&recording_)) return 0;
+  ThreadTraceBuffer* buffer = GetThreadTraceBuffer();
+  uint64_t handle = 0;
+  buffer->BeginWrite();
+  // Recording may have stopped before BeginWrite became visible.
+  if (base::NoBarrier_Load(&recording_)) {
+    bool overwrite = trace_config_->GetTraceRecordMode() == RECORD_CONTINUOUSLY;
+    TraceObject* trace_object = buffer->AddTraceEvent(overwrite, &handle);
+    if (trace_object != nullptr) {
+      trace_object->Initialize(phase, category_enabled_flag, name, id,
+                               bind_id, num_args, arg_names, arg_types,
+                               arg_values, flags);
+    }
+  }
+  buffer->EndWrite();
+  return handle;
+}
+
+void TracingController::UpdateTraceEventDuration(
+    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {
+  if (handle == 0 || !base::NoBarrier_Load(&recording_)) return;
+  // Scoped events end on the thread that began them.
+  ThreadTraceBuffer* buffer = GetThreadTraceBuffer();
+  buffer->BeginWrite();
+  if (base::NoBarrier_Load(&recording_)) {
+    TraceObject* trace_object = buffer->GetEventByHandle(handle);
+    if (trace_object != nullptr) trace_object->UpdateDuration();
+  }
+  buffer->EndWrite();
+}
+
+void TracingController::StartTracing(TraceConfig* trace_config) {
+  DCHECK_NOT_NULL(trace_writer_);
+  DCHECK(!base::NoBarrier_Load(&recording_));
+  delete trace_config_;
+  trace_config_ = trace_config;
+  base::Release_Store(&recording_, 1);
+  UpdateCategoryGroupEnabledFlags();
+}
+
+void TracingController::StopTracing() {
+  base::NoBarrier_Store(&recording_, 0);
+  base::MemoryBarrier();
+  UpdateCategoryGroupEnabledFlags();
+  base::LockGuard<base::Mutex> guard(mutex_);
+  for (ThreadTraceBuffer* buffer : buffers_) {
+    // A thread that saw |recording_| set is still writing its last event.
+    while (buffer->IsWriting()) {
+      base::OS::Sleep(base::TimeDelta::FromMicroseconds(100));
+    }
+    buffer->Flush(trace_writer_);
+  }
+  trace_writer_->Flush();
+}
+
+void TracingController::UpdateCategoryGroupEnabledFlags() {
+  base::LockGuard<base::Mutex> guard(g_category_mutex.Pointer());
+  bool recording = base::NoBarrier_Load(&recording_) != 0;
+  int category_index = base::NoBarrier_Load(&g_category_index);
+  for (int i = 0; i < category_index; ++i) {
+    bool enabled = recording && i != kCategoryCategoriesExhausted &&
+                   trace_config_->IsCategoryGroupEnabled(g_category_groups[i]);
+    g_category_group_enabled[i] = enabled ? kEnabledForRecording : 0;
+  }
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
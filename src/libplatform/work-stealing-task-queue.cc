@@ -0,0 +1,133 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/work-stealing-task-queue.h"
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace platform {
+
+void WorkStealingTaskQueue::WorkerDeque::Push(Task* task) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  tasks_.push_back(task);
+}
+
+
+Task* WorkStealingTaskQueue::WorkerDeque::Pop() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  if (tasks_.empty()) return NULL;
+  Task* result = tasks_.front();
+  tasks_.pop_front();
+  return result;
+}
+
+
+Task* WorkStealingTaskQueue::WorkerDeque::Steal() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  if (tasks_.empty()) return NULL;
+  Task* result = tasks_.back();
+  tasks_.pop_back();
+  return result;
+}
+
+
+bool WorkStealingTaskQueue::WorkerDeque::IsEmpty() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  return tasks_.empty();
+}
+
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(int num_workers)
+    : available_tasks_semaphore_(0),
+      next_worker_(0),
+      terminated_(0),
+      worker_index_key_(base::Thread::CreateThreadLocalKey()) {
+  DCHECK_LT(0, num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.push_back(new Worker());
+  }
+}
+
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() {
+  DCHECK(base::Acquire_Load(&terminated_));
+  for (auto i = workers_.begin(); i != workers_.end(); ++i) {
+    DCHECK((*i)->short_running.IsEmpty());
+    DCHECK((*i)->long_running.IsEmpty());
+    delete *i;
+  }
+  base::Thread::DeleteThreadLocalKey(worker_index_key_);
+}
+
+
+void WorkStealingTaskQueue::BindWorkerThread(int worker_index) {
+  DCHECK(0 <= worker_index && worker_index < num_workers());
+  // Store the index biased by one so that 0 means "not a worker".
+  base::Thread::SetThreadLocalInt(worker_index_key_, worker_index + 1);
+}
+
+
+int WorkStealingTaskQueue::CurrentWorkerIndex() {
+  return base::Thread::GetThreadLocalInt(worker_index_key_) - 1;
+}
+
+
+void WorkStealingTaskQueue::Append(Task* task,
+                                   Platform::ExpectedRuntime expected_runtime) {
+  DCHECK(!base::Acquire_Load(&terminated_));
+  int index = CurrentWorkerIndex();
+  if (index < 0) {
+    // Tasks posted from outside the pool are spread round-robin.
+    uint32_t next = static_cast<uint32_t>(
+        base::NoBarrier_AtomicIncrement(&next_worker_, 1));
+    index = static_cast<int>(next % workers_.size());
+  }
+  DequeFor(workers_[index], expected_runtime)->Push(task);
+  available_tasks_semaphore_.Signal();
+}
+
+
+Task* WorkStealingTaskQueue::TryTake(
+    int worker_index, Platform::ExpectedRuntime expected_runtime) {
+  Task* task = DequeFor(workers_[worker_index], expected_runtime)->Pop();
+  if (task != NULL) return task;
+  int num = num_workers();
+  for (int i = 1; i < num; ++i) {
+    Worker* victim = workers_[(worker_index + i) % num];
+    task = DequeFor(victim, expected_runtime)->Steal();
+    if (task != NULL) return task;
+  }
+  return NULL;
+}
+
+
+Task* WorkStealingTaskQueue::GetNext(int worker_index) {
+  DCHECK(0 <= worker_index && worker_index < num_workers());
+  available_tasks_semaphore_.Wait();
+  for (;;) {
+    Task* task = TryTake(worker_index, Platform::kShortRunningTask);
+    if (task != NULL) return task;
+    task = TryTake(worker_index, Platform::kLongRunningTask);
+    if (task != NULL) return task;
+    if (base::Acquire_Load(&terminated_)) {
+      // Wake up the next worker so that it can terminate as well.
+      available_tasks_semaphore_.Signal();
+      return NULL;
+    }
+    // The semaphore guarantees that a task is available, but it may have been
+    // taken by another worker while a new one was pushed to a deque that we
+    // had already scanned. Try again.
+  }
+}
+
+
+void WorkStealingTaskQueue::Terminate() {
+  DCHECK(!base::Acquire_Load(&terminated_));
+  base::Release_Store(&terminated_, 1);
+  available_tasks_semaphore_.Signal();
+}
+
+}  // namespace platform
+}  // namespace v8
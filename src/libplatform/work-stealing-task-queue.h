@@ -0,0 +1,104 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+#define V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+
+#include <deque>
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/atomicops.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+
+namespace v8 {
+namespace platform {
+
+// A task queue for a fixed number of workers. Every worker owns a pair of
+// deques, one for short running and one for long running tasks, each guarded
+// by its own lock. Tasks are distributed over the workers' deques and idle
+// workers steal from the deques of busy ones, so that concurrent producers and
+// consumers do not contend on a single lock. Short running tasks are always
+// preferred over long running ones, so that long running jobs (e.g.
+// concurrent recompilation) do not delay latency sensitive work (e.g.
+// concurrent sweeping).
+class WorkStealingTaskQueue {
+ public:
+  explicit WorkStealingTaskQueue(int num_workers);
+  ~WorkStealingTaskQueue();
+
+  // Appends a task to the queue. The queue takes ownership of |task|. If
+  // called from one of the workers, the task is queued with that worker.
+  void Append(Task* task, Platform::ExpectedRuntime expected_runtime);
+
+  // Returns the next task to process for the worker with the given index.
+  // Blocks if no task is available. Returns NULL if the queue is terminated
+  // and no task is left.
+  Task* GetNext(int worker_index);
+
+  // Terminate the queue.
+  void Terminate();
+
+  // Must be called on the worker thread before the first call to GetNext.
+  void BindWorkerThread(int worker_index);
+
+  int num_workers() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  class WorkerDeque {
+   public:
+    WorkerDeque() {}
+
+    void Push(Task* task);
+    // The owning worker takes tasks from the front (FIFO order), ...
+    Task* Pop();
+    // ... while stealing workers take them from the back.
+    Task* Steal();
+    bool IsEmpty();
+
+   private:
+    base::Mutex lock_;
+    std::deque<Task*> tasks_;
+
+    DISALLOW_COPY_AND_ASSIGN(WorkerDeque);
+  };
+
+  struct Worker {
+    WorkerDeque short_running;
+    WorkerDeque long_running;
+  };
+
+  static WorkerDeque* DequeFor(Worker* worker,
+                               Platform::ExpectedRuntime expected_runtime) {
+    return expected_runtime == Platform::kShortRunningTask
+               ? &worker->short_running
+               : &worker->long_running;
+  }
+
+  // Tries to take a task of the given kind, first from the worker's own deque
+  // and then from the other workers' deques.
+  Task* TryTake(int worker_index, Platform::ExpectedRuntime expected_runtime);
+
+  // Index of the worker running on the current thread, or -1.
+  int CurrentWorkerIndex();
+
+  std::vector<Worker*> workers_;
+  // Counts the tasks in all deques. A worker that successfully waits on the
+  // semaphore is guaranteed to find a task unless the queue is terminated.
+  base::Semaphore available_tasks_semaphore_;
+  base::Atomic32 next_worker_;
+  base::Atomic32 terminated_;
+  base::Thread::LocalStorageKey worker_index_key_;
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingTaskQueue);
+};
+
+}  // namespace platform
+}  // namespace v8
+
+
+#endif  // V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
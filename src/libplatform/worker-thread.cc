@@ -6,12 +6,25 @@
 
 #include "include/v8-platform.h"
 #include "src/libplatform/task-queue.h"
+#include "src/libplatform/work-stealing-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
 WorkerThread::WorkerThread(TaskQueue* queue)
-    : Thread(Options("V8 WorkerThread")), queue_(queue) {
+    : Thread(Options("V8 WorkerThread")),
+      queue_(queue),
+      work_stealing_queue_(NULL),
+      index_(0) {
+  Start();
+}
+
+
+WorkerThread::WorkerThread(WorkStealingTaskQueue* queue, int index)
+    : Thread(Options("V8 WorkerThread")),
+      queue_(NULL),
+      work_stealing_queue_(queue),
+      index_(index) {
   Start();
 }
 
@@ -22,6 +35,14 @@ WorkerThread::~WorkerThread() {
 
 
 void WorkerThread::Run() {
+  if (work_stealing_queue_ != NULL) {
+    work_stealing_queue_->BindWorkerThread(index_);
+    while (Task* task = work_stealing_queue_->GetNext(index_)) {
+      task->Run();
+      delete task;
+    }
+    return;
+  }
   while (Task* task = queue_->GetNext()) {
     task->Run();
     delete task;
@@ -15,10 +15,13 @@ namespace v8 {
 namespace platform {
 
 class TaskQueue;
+class WorkStealingTaskQueue;
 
 class WorkerThread : public base::Thread {
  public:
   explicit WorkerThread(TaskQueue* queue);
+  // Creates the worker with the given index of a work stealing |queue|.
+  WorkerThread(WorkStealingTaskQueue* queue, int index);
   virtual ~WorkerThread();
 
   // Thread implementation.
@@ -28,6 +31,8 @@ class WorkerThread : public base::Thread {
   friend class QuitTask;
 
   TaskQueue* queue_;
+  WorkStealingTaskQueue* work_stealing_queue_;
+  int index_;
 
   DISALLOW_COPY_AND_ASSIGN(WorkerThread);
 };
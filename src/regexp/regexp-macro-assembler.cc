@@ -101,6 +101,33 @@ void RegExpMacroAssembler::CheckNotInSurrogatePair(int cp_offset,
 }
 
 
+void RegExpMacroAssembler::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                      unsigned c,
+                                                      unsigned and_with,
+                                                      int advance_by) {
+  Label cont, again;
+  Bind(&again);
+  LoadCurrentCharacter(cp_offset, &cont, true);
+  CheckCharacterAfterAnd(c, and_with, &cont);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&again);
+  Bind(&cont);
+}
+
+
+void RegExpMacroAssembler::SkipUntilBitInTable(int cp_offset,
+                                               Handle<ByteArray> table,
+                                               int advance_by) {
+  Label cont, again;
+  Bind(&again);
+  LoadCurrentCharacter(cp_offset, &cont, true);
+  CheckBitInTable(table, &cont);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&again);
+  Bind(&cont);
+}
+
+
 #ifndef V8_INTERPRETED_REGEXP  // Avoid unused code, e.g., on ARM.
 
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler(Isolate* isolate,
@@ -163,6 +163,17 @@ class RegExpMacroAssembler {
   // Check that we are not in the middle of a surrogate pair.
   void CheckNotInSurrogatePair(int cp_offset, Label* on_failure);
 
+  // Boyer-Moore style skip loops. Advance the current position by advance_by
+  // until the character at cp_offset from it is a candidate, or until that
+  // character is past the end of the input. The character is a candidate if,
+  // anded with and_with, it equals c, or if its bit (modulus the kTableSize)
+  // is set in the table. Implementations that scan for candidates one
+  // character at a time may stop at any earlier position.
+  virtual void SkipUntilCharacterAfterAnd(int cp_offset, unsigned c,
+                                          unsigned and_with, int advance_by);
+  virtual void SkipUntilBitInTable(int cp_offset, Handle<ByteArray> table,
+                                   int advance_by);
+
   // Controls the generation of large inlined constants in the code.
   void set_slow_safe(bool ssc) { slow_safe_compiler_ = ssc; }
   bool slow_safe() { return slow_safe_compiler_; }
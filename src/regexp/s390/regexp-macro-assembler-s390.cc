@@ -508,6 +508,84 @@ void RegExpMacroAssemblerS390::CheckBitInTable(Handle<ByteArray> table,
 }
 
 
+void RegExpMacroAssemblerS390::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                          unsigned c,
+                                                          unsigned and_with,
+                                                          int advance_by) {
+  if (mode_ != LATIN1) {
+    RegExpMacroAssembler::SkipUntilCharacterAfterAnd(cp_offset, c, and_with,
+                                                     advance_by);
+    return;
+  }
+  Handle<ByteArray> function_table =
+      isolate()->factory()->NewByteArray(kFunctionTableSize, TENURED);
+  for (int i = 0; i < kFunctionTableSize; i++) {
+    function_table->set(i, (static_cast<unsigned>(i) & and_with) == c ? 1 : 0);
+  }
+  SkipWithTranslateAndTest(cp_offset, function_table);
+}
+
+
+void RegExpMacroAssemblerS390::SkipUntilBitInTable(int cp_offset,
+                                                   Handle<ByteArray> table,
+                                                   int advance_by) {
+  if (mode_ != LATIN1) {
+    RegExpMacroAssembler::SkipUntilBitInTable(cp_offset, table, advance_by);
+    return;
+  }
+  Handle<ByteArray> function_table =
+      isolate()->factory()->NewByteArray(kFunctionTableSize, TENURED);
+  for (int i = 0; i < kFunctionTableSize; i++) {
+    function_table->set(i, table->get(i & kTableMask) != 0 ? 1 : 0);
+  }
+  SkipWithTranslateAndTest(cp_offset, function_table);
+}
+
+
+void RegExpMacroAssemblerS390::SkipWithTranslateAndTest(
+    int cp_offset, Handle<ByteArray> function_table) {
+  // TRT tests up to 256 characters at a time, so this stops at the first
+  // candidate rather than stepping by the skip distance.
+  Label cont, loop, tail, found, not_found, trt_template;
+  CheckPosition(cp_offset, &cont);
+  // r4: address of the first character to test.
+  // r5: number of characters left in the input.
+  __ lay(r4, MemOperand(current_input_offset(), end_of_input_address(),
+                        cp_offset));
+  __ mov(r5, Operand(-cp_offset));
+  __ SubP(r5, current_input_offset());
+  __ mov(r3, Operand(function_table));
+  __ AddP(r3, Operand(ByteArray::kHeaderSize - kHeapObjectTag));
+  __ bind(&loop);
+  __ CmpP(r5, Operand(kFunctionTableSize));
+  __ blt(&tail);
+  __ trt(MemOperand(r4), MemOperand(r3), kFunctionTableSize);
+  __ bne(&found);
+  __ la(r4, MemOperand(r4, kFunctionTableSize));
+  __ SubP(r5, Operand(kFunctionTableSize));
+  __ b(&loop);
+  __ bind(&tail);
+  __ CmpP(r5, Operand::Zero());
+  __ beq(&not_found);
+  // Execute TRT on the remaining 1 to 255 characters.
+  __ SubP(r5, Operand(1));
+  __ larl(r2, &trt_template);
+  __ ex(r5, MemOperand(r2));
+  __ bne(&found);
+  __ bind(&not_found);
+  // No candidate, so the character at cp_offset is at the end of the input.
+  __ mov(current_input_offset(), Operand(-cp_offset));
+  __ b(&cont);
+  __ bind(&trt_template);
+  __ trt(MemOperand(r4), MemOperand(r3), 1);
+  __ bind(&found);
+  // TRT leaves the address of the candidate character in r1.
+  __ SubP(current_input_offset(), r1, end_of_input_address());
+  __ AddP(current_input_offset(), Operand(-cp_offset));
+  __ bind(&cont);
+}
+
+
 bool RegExpMacroAssemblerS390::CheckSpecialCharacterClass(uc16 type,
                                                          Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -52,6 +52,10 @@ class RegExpMacroAssemblerS390 : public NativeRegExpMacroAssembler {
   virtual void CheckCharacterNotInRange(uc16 from, uc16 to,
                                         Label* on_not_in_range);
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set);
+  virtual void SkipUntilCharacterAfterAnd(int cp_offset, unsigned c,
+                                          unsigned and_with, int advance_by);
+  virtual void SkipUntilBitInTable(int cp_offset, Handle<ByteArray> table,
+                                   int advance_by);
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
@@ -128,10 +132,19 @@ class RegExpMacroAssemblerS390 : public NativeRegExpMacroAssembler {
   // Initial size of code buffer.
   static const size_t kRegExpCodeSize = 1024;
 
+  // Size of the TRT function table, one entry per one-byte character.
+  static const int kFunctionTableSize = 256;
+
   // Load a number of characters at the given offset from the
   // current position, into the current-character register.
   void LoadCurrentCharacterUnchecked(int cp_offset, int character_count);
 
+  // Advance the current position to the first one at which the one-byte
+  // character at cp_offset has a nonzero entry in the 256 byte
+  // function_table, scanning with TRT.
+  void SkipWithTranslateAndTest(int cp_offset,
+                                Handle<ByteArray> function_table);
+
   // Check whether preemption has been requested.
   void CheckPreemption();
 
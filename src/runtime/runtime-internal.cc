@@ -13,6 +13,7 @@
 #include "src/isolate-inl.h"
 #include "src/messages.h"
 #include "src/parsing/parser.h"
+#include "src/wasm/wasm-opcodes.h"
 
 namespace v8 {
 namespace internal {
@@ -90,6 +91,18 @@ RUNTIME_FUNCTION(Runtime_ReThrow) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_ThrowWasmError) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_SMI_ARG_CHECKED(reason, 0);
+  RUNTIME_ASSERT(0 <= reason && reason < wasm::kTrapCount);
+  wasm::TrapReason trap_reason = static_cast<wasm::TrapReason>(reason);
+  Handle<String> message = isolate->factory()->NewStringFromAsciiChecked(
+      wasm::WasmOpcodes::TrapReasonMessage(trap_reason));
+  return isolate->Throw(*message);
+}
+
+
 RUNTIME_FUNCTION(Runtime_ThrowStackOverflow) {
   SealHandleScope shs(isolate);
   DCHECK_LE(0, args.length());
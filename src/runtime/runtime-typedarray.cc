@@ -4,6 +4,10 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "src/arguments.h"
 #include "src/factory.h"
 #include "src/messages.h"
@@ -363,6 +367,149 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
 }
 
 
+namespace {
+
+// Sorts elements of at most 16 bits by counting the occurrences of every
+// possible value, which is a radix sort with a single digit.
+template <typename T>
+void CountingSort(T* data, size_t length) {
+  const int kValues = 1 << (8 * sizeof(T));
+  const int kMinValue = std::numeric_limits<T>::min();
+  ScopedVector<size_t> counts(kValues);
+  std::fill(counts.start(), counts.start() + kValues, 0);
+  for (size_t i = 0; i < length; i++) {
+    counts[static_cast<int>(data[i]) - kMinValue]++;
+  }
+  T* out = data;
+  for (int value = 0; value < kValues; value++) {
+    out = std::fill_n(out, counts[value], static_cast<T>(value + kMinValue));
+  }
+}
+
+
+template <typename T>
+bool IsNotNaN(T value) {
+  return !std::isnan(value);
+}
+
+
+// Sorts floating point elements in the default order of
+// %TypedArray%.prototype.sort, where -0 comes before +0 and NaNs come last.
+template <typename T>
+void FloatSort(T* data, size_t length) {
+  T* end = std::partition(data, data + length, IsNotNaN<T>);
+  std::sort(data, end);
+  // The comparison above does not tell -0 from +0; rewrite the zeros.
+  std::pair<T*, T*> zeros = std::equal_range(data, end, static_cast<T>(0));
+  size_t negative_zeros = 0;
+  for (T* p = zeros.first; p != zeros.second; ++p) {
+    if (std::signbit(*p)) negative_zeros++;
+  }
+  std::fill_n(zeros.first, negative_zeros, static_cast<T>(-0.0));
+  std::fill(zeros.first + negative_zeros, zeros.second, static_cast<T>(0));
+}
+
+
+// Counting has to visit every possible value, so short arrays are cheaper to
+// sort by comparison.
+template <typename T>
+void SmallIntegerSort(T* data, size_t length) {
+  const size_t kMinCountingSortLength = (1 << (8 * sizeof(T))) / 16;
+  if (length >= kMinCountingSortLength) {
+    CountingSort(data, length);
+  } else {
+    std::sort(data, data + length);
+  }
+}
+
+
+template <typename T>
+void SortElements(T* data, size_t length) {
+  std::sort(data, data + length);
+}
+
+
+template <>
+void SortElements(uint8_t* data, size_t length) {
+  SmallIntegerSort(data, length);
+}
+
+
+template <>
+void SortElements(int8_t* data, size_t length) {
+  SmallIntegerSort(data, length);
+}
+
+
+template <>
+void SortElements(uint16_t* data, size_t length) {
+  SmallIntegerSort(data, length);
+}
+
+
+template <>
+void SortElements(int16_t* data, size_t length) {
+  SmallIntegerSort(data, length);
+}
+
+
+template <>
+void SortElements(float* data, size_t length) {
+  FloatSort(data, length);
+}
+
+
+template <>
+void SortElements(double* data, size_t length) {
+  FloatSort(data, length);
+}
+
+
+template <typename T>
+void SortTypedArrayElements(void* data, size_t length, bool is_shared) {
+  T* elements = static_cast<T*>(data);
+  if (!is_shared) {
+    SortElements(elements, length);
+    return;
+  }
+  // Other threads may write to a shared buffer while we sort it. Sort a copy
+  // so that racing writes cannot break the invariants the sort relies on.
+  ScopedVector<T> copy(static_cast<int>(length));
+  std::copy(elements, elements + length, copy.start());
+  SortElements(copy.start(), length);
+  std::copy(copy.start(), copy.start() + length, elements);
+}
+
+}  // namespace
+
+
+// Sorts a typed array in place in the default order, without calling back
+// into JS for each comparison.
+RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_CHECKED(JSTypedArray, array, 0);
+  if (array->WasNeutered()) return array;
+
+  size_t length = array->length_value();
+  if (length < 2) return array;
+  void* data = FixedTypedArrayBase::cast(array->elements())->DataPtr();
+  bool is_shared = JSArrayBuffer::cast(array->buffer())->is_shared();
+
+  DisallowHeapAllocation no_gc;
+  switch (array->type()) {
+#define TYPED_ARRAY_CASE(Type, typeName, TYPE, ctype, size) \
+  case kExternal##Type##Array:                              \
+    SortTypedArrayElements<ctype>(data, length, is_shared); \
+    break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+  return array;
+}
+
+
 RUNTIME_FUNCTION(Runtime_TypedArrayMaxSizeInHeap) {
   DCHECK(args.length() == 0);
   DCHECK_OBJECT_SIZE(FLAG_typed_array_max_size_in_heap +
@@ -57,9 +57,9 @@ static unsigned CpuFeaturesImpliedByCompiler() {
   return answer;
 }
 
-// Check whether Store Facility STFLE instruction is available on the platform.
-// Instruction returns a bit vector of the enabled hardware facilities.
-static bool supportsSTFLE() {
+// Returns the hardware capabilities (HWCAP) the kernel passes in the auxiliary
+// vector, or 0 if they cannot be read.
+static uint32_t readHWCAP() {
 #if V8_HOST_ARCH_S390
   static bool read_tried = false;
   static uint32_t auxv_hwcap = 0;
@@ -99,19 +99,26 @@ static bool supportsSTFLE() {
     }
   }
 
-  // Did not find result
-  if (0 == auxv_hwcap) {
-    return false;
-  }
+  return auxv_hwcap;
+#else
+  return 0;
+#endif
+}
 
+// Check whether Store Facility STFLE instruction is available on the platform.
+// Instruction returns a bit vector of the enabled hardware facilities.
+static bool supportsSTFLE() {
   // HWCAP_S390_STFLE is defined to be 4 in include/asm/elf.h.  Currently
   // hardcoded in case that include file does not exist.
   const uint32_t HWCAP_S390_STFLE = 4;
-  return (auxv_hwcap & HWCAP_S390_STFLE);
-#else
-  // STFLE is not available on non-s390 hosts
-  return false;
-#endif
+  return (readHWCAP() & HWCAP_S390_STFLE);
+}
+
+// Check whether the kernel saves and restores the vector registers.
+static bool supportsVectorRegisters() {
+  // HWCAP_S390_VXRS is defined to be 2048 in include/asm/elf.h.
+  const uint32_t HWCAP_S390_VXRS = 2048;
+  return (readHWCAP() & HWCAP_S390_VXRS);
 }
 
 void CpuFeatures::ProbeImpl(bool cross_compile) {
@@ -137,14 +144,15 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
     //    D(B) to specify to memory location to store the facilities bits
     // The facilities we are checking for are:
     //   Bit 45 - Distinct Operands for instructions like ARK, SRK, etc.
-    // As such, we require only 1 double word
-    int64_t facilities[1];
-    facilities[0] = 0;
+    //            and Load/Store On Condition (LOC, LOCG, STOC, etc.)
+    //   Bit 129 - Vector Facility for z/Architecture
+    // As such, we require three double words
+    int64_t facilities[3] = {0L};
     // LHI sets up GPR0
     // STFLE is specified as .insn, as opcode is not recognized.
     // We register the instructions kill r0 (LHI) and the CC (STFLE).
     asm volatile(
-        "lhi   0,0\n"
+        "lhi   0,2\n"
         ".insn s,0xb2b00000,%0\n"
         : "=Q"(facilities)
         :
@@ -153,6 +161,9 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
     // Test for Distinct Operands Facility - Bit 45
     if (facilities[0] & (1lu << (63 - 45))) {
       supported_ |= (1u << DISTINCT_OPS);
+      // Load/Store On Condition and Interlocked Access share facility bit 45.
+      supported_ |= (1u << LOAD_STORE_ON_COND);
+      supported_ |= (1u << INTERLOCKED_ACCESS);
     }
     // Test for General Instruction Extension Facility - Bit 34
     if (facilities[0] & (1lu << (63 - 34))) {
@@ -162,6 +173,12 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
     if (facilities[0] & (1lu << (63 - 37))) {
       supported_ |= (1u << FLOATING_POINT_EXT);
     }
+    // Test for Vector Facility - Bit 129. The vector registers can only be
+    // used if the kernel preserves them across context switches.
+    if ((facilities[2] & (1lu << (63 - (129 - 128)))) &&
+        supportsVectorRegisters()) {
+      supported_ |= (1u << VECTOR_FACILITY);
+    }
   }
 #else
   // All distinct ops instructions can be simulated
@@ -170,7 +187,14 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
   supported_ |= (1u << GENERAL_INSTR_EXT);
 
   supported_ |= (1u << FLOATING_POINT_EXT);
+  // The vector instructions can be simulated
+  supported_ |= (1u << VECTOR_FACILITY);
+  // LOC/LOCG/STOC can be simulated
+  supported_ |= (1u << LOAD_STORE_ON_COND);
+  // LAA/LAN/LAO/LAX can be simulated
+  supported_ |= (1u << INTERLOCKED_ACCESS);
   USE(performSTFLE);  // To avoid assert
+  USE(supportsVectorRegisters);
 #endif
   supported_ |= (1u << FPU);
 }
@@ -192,6 +216,11 @@ void CpuFeatures::PrintFeatures() {
   printf("FPU_EXT=%d\n", CpuFeatures::IsSupported(FLOATING_POINT_EXT));
   printf("GENERAL_INSTR=%d\n", CpuFeatures::IsSupported(GENERAL_INSTR_EXT));
   printf("DISTINCT_OPS=%d\n", CpuFeatures::IsSupported(DISTINCT_OPS));
+  printf("VECTOR_FACILITY=%d\n", CpuFeatures::IsSupported(VECTOR_FACILITY));
+  printf("LOAD_STORE_ON_COND=%d\n",
+         CpuFeatures::IsSupported(LOAD_STORE_ON_COND));
+  printf("INTERLOCKED_ACCESS=%d\n",
+         CpuFeatures::IsSupported(INTERLOCKED_ACCESS));
 }
 
 Register ToRegister(int num) {
@@ -336,6 +365,12 @@ int Assembler::target_at(int pos) {
     imm16 <<= 1;  // BRC immediate is in # of halfwords
     if (imm16 == 0) return kEndOfChain;
     return pos + imm16;
+  } else if (IsCompareAndBranch(opcode)) {
+    // The halfword offset of RIE-b/c sits in bits 16-31 of the instruction.
+    int16_t imm16 = SIGN_EXT_IMM16(((instr >> 16) & kImm16Mask));
+    imm16 <<= 1;
+    if (imm16 == 0) return kEndOfChain;
+    return pos + imm16;
   } else if (LLILF == opcode || BRCL == opcode || LARL == opcode ||
              BRASL == opcode) {
     int32_t imm32 =
@@ -358,7 +393,8 @@ void Assembler::target_at_put(int pos, int target_pos, bool* is_branch) {
 
   if (is_branch != nullptr) {
     *is_branch = (opcode == BRC || opcode == BRCT || opcode == BRCTG ||
-                  opcode == BRCL || opcode == BRASL);
+                  opcode == BRCL || opcode == BRASL ||
+                  IsCompareAndBranch(opcode));
   }
 
   if (BRC == opcode || BRCT == opcode || BRCTG == opcode) {
@@ -367,6 +403,13 @@ void Assembler::target_at_put(int pos, int target_pos, bool* is_branch) {
     CHECK(is_int16(imm16));
     instr_at_put<FourByteInstr>(pos, instr | (imm16 >> 1));
     return;
+  } else if (IsCompareAndBranch(opcode)) {
+    int16_t imm16 = target_pos - pos;
+    instr &= ~(static_cast<uint64_t>(0xffff) << 16);
+    CHECK(is_int16(imm16));
+    instr_at_put<SixByteInstr>(
+        pos, instr | (static_cast<uint64_t>((imm16 >> 1) & 0xffff) << 16));
+    return;
   } else if (BRCL == opcode || LARL == opcode || BRASL == opcode) {
     // Immediate is in # of halfwords
     int32_t imm32 = target_pos - pos;
@@ -391,7 +434,8 @@ int Assembler::max_reach_from(int pos) {
 
   // Check which type of instr.  In theory, we can return
   // the values below + 1, given offset is # of halfwords
-  if (BRC == opcode || BRCT == opcode || BRCTG == opcode) {
+  if (BRC == opcode || BRCT == opcode || BRCTG == opcode ||
+      IsCompareAndBranch(opcode)) {
     return 16;
   } else if (LLILF == opcode || BRCL == opcode || LARL == opcode ||
              BRASL == opcode) {
@@ -667,6 +711,45 @@ void Assembler::rie_f_form(Opcode op, Register r1, Register r2,
   emit6bytes(code);
 }
 
+// RIE-b format: <insn> R1,R2,M3,I4
+//    +--------+----+----+------------------+----+---+--------+
+//    | OpCode | R1 | R2 |        I4        | M3 |///| OpCode |
+//    +--------+----+----+------------------+----+---+--------+
+//    0        8    12   16                 32   36  40      47
+void Assembler::rie_b_form(Opcode op, Register r1, Register r2, Condition m3,
+                           const Operand& i4) {
+  DCHECK(is_uint16(op));
+  DCHECK(is_uint4(m3));
+  DCHECK(is_int16(i4.imm_));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(r1.code())) * B36 |
+                  (static_cast<uint64_t>(r2.code())) * B32 |
+                  (static_cast<uint64_t>(i4.imm_ & 0xFFFF)) * B16 |
+                  (static_cast<uint64_t>(m3)) * B12 |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// RIE-c format: <insn> R1,I2,M3,I4
+//    +--------+----+----+------------------+--------+--------+
+//    | OpCode | R1 | M3 |        I4        |   I2   | OpCode |
+//    +--------+----+----+------------------+--------+--------+
+//    0        8    12   16                 32       40      47
+void Assembler::rie_c_form(Opcode op, Register r1, const Operand& i2,
+                           Condition m3, const Operand& i4) {
+  DCHECK(is_uint16(op));
+  DCHECK(is_uint4(m3));
+  DCHECK(is_uint8(i2.imm_) || is_int8(i2.imm_));
+  DCHECK(is_int16(i4.imm_));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(r1.code())) * B36 |
+                  (static_cast<uint64_t>(m3)) * B32 |
+                  (static_cast<uint64_t>(i4.imm_ & 0xFFFF)) * B16 |
+                  (static_cast<uint64_t>(i2.imm_ & 0xFF)) * B8 |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
 // RIE format: <insn> R1,R3,I2
 //    +--------+----+----+------------------+--------+--------+
 //    | OpCode | R1 | R3 |        I2        |////////| OpCode |
@@ -1373,6 +1456,171 @@ void Assembler::rrfe_form(Opcode op, Condition m3, Condition m4, Register r1,
   emit4bytes(code);
 }
 
+// Vector instructions hold the most significant bit of each vector register
+// field in the RXB field (bits 36-39), so that all 32 registers can be named.
+static inline uint64_t VectorRXB(int field8, int field12, int field16,
+                                 int field32) {
+  return (static_cast<uint64_t>((field8 & 0x10) >> 1 | (field12 & 0x10) >> 2 |
+                                (field16 & 0x10) >> 3 | (field32 & 0x10) >> 4))
+         * B8;
+}
+
+// VRI-a format: <insn> V1,I2,M3
+//    +--------+----+----+-----------------+----+----+--------+
+//    | OpCode | V1 |////|       I2        | M3 |RXB | OpCode |
+//    +--------+----+----+-----------------+----+----+--------+
+//    0        8    12   16                32   36   40      47
+void Assembler::vri_a_form(Opcode op, Simd128Register v1, const Operand& i2,
+                           Condition m3) {
+  DCHECK(is_uint16(op));
+  DCHECK(is_uint16(i2.imm_) || is_int16(i2.imm_));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(v1.code() & 0xF)) * B36 |
+                  (static_cast<uint64_t>(i2.imm_ & 0xFFFF)) * B16 |
+                  (static_cast<uint64_t>(m3 & 0xF)) * B12 |
+                  VectorRXB(v1.code(), 0, 0, 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// VRI-c format: <insn> V1,V3,I2,M4
+//    +--------+----+----+-----------------+----+----+--------+
+//    | OpCode | V1 | V3 |       I2        | M4 |RXB | OpCode |
+//    +--------+----+----+-----------------+----+----+--------+
+//    0        8    12   16                32   36   40      47
+void Assembler::vri_c_form(Opcode op, Simd128Register v1, Simd128Register v3,
+                           const Operand& i2, Condition m4) {
+  DCHECK(is_uint16(op));
+  DCHECK(is_uint16(i2.imm_));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(v1.code() & 0xF)) * B36 |
+                  (static_cast<uint64_t>(v3.code() & 0xF)) * B32 |
+                  (static_cast<uint64_t>(i2.imm_)) * B16 |
+                  (static_cast<uint64_t>(m4 & 0xF)) * B12 |
+                  VectorRXB(v1.code(), v3.code(), 0, 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// VRR-a format: <insn> V1,V2,M3,M4,M5
+//    +--------+----+----+---------+----+----+----+----+--------+
+//    | OpCode | V1 | V2 |/////////| M5 | M4 | M3 |RXB | OpCode |
+//    +--------+----+----+---------+----+----+----+----+--------+
+//    0        8    12   16        24   28   32   36   40      47
+void Assembler::vrr_a_form(Opcode op, Simd128Register v1, Simd128Register v2,
+                           Condition m5, Condition m4, Condition m3) {
+  DCHECK(is_uint16(op));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(v1.code() & 0xF)) * B36 |
+                  (static_cast<uint64_t>(v2.code() & 0xF)) * B32 |
+                  (static_cast<uint64_t>(m5 & 0xF)) * B20 |
+                  (static_cast<uint64_t>(m4 & 0xF)) * B16 |
+                  (static_cast<uint64_t>(m3 & 0xF)) * B12 |
+                  VectorRXB(v1.code(), v2.code(), 0, 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// VRR-b format: <insn> V1,V2,V3,M4,M5
+//    +--------+----+----+----+----+----+----+----+----+--------+
+//    | OpCode | V1 | V2 | V3 |////| M5 |////| M4 |RXB | OpCode |
+//    +--------+----+----+----+----+----+----+----+----+--------+
+//    0        8    12   16   20   24   28   32   36   40      47
+void Assembler::vrr_b_form(Opcode op, Simd128Register v1, Simd128Register v2,
+                           Simd128Register v3, Condition m5, Condition m4) {
+  DCHECK(is_uint16(op));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(v1.code() & 0xF)) * B36 |
+                  (static_cast<uint64_t>(v2.code() & 0xF)) * B32 |
+                  (static_cast<uint64_t>(v3.code() & 0xF)) * B28 |
+                  (static_cast<uint64_t>(m5 & 0xF)) * B20 |
+                  (static_cast<uint64_t>(m4 & 0xF)) * B12 |
+                  VectorRXB(v1.code(), v2.code(), v3.code(), 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// VRR-c format: <insn> V1,V2,V3,M4,M5,M6
+//    +--------+----+----+----+----+----+----+----+----+--------+
+//    | OpCode | V1 | V2 | V3 |////| M6 | M5 | M4 |RXB | OpCode |
+//    +--------+----+----+----+----+----+----+----+----+--------+
+//    0        8    12   16   20   24   28   32   36   40      47
+void Assembler::vrr_c_form(Opcode op, Simd128Register v1, Simd128Register v2,
+                           Simd128Register v3, Condition m6, Condition m5,
+                           Condition m4) {
+  DCHECK(is_uint16(op));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(v1.code() & 0xF)) * B36 |
+                  (static_cast<uint64_t>(v2.code() & 0xF)) * B32 |
+                  (static_cast<uint64_t>(v3.code() & 0xF)) * B28 |
+                  (static_cast<uint64_t>(m6 & 0xF)) * B20 |
+                  (static_cast<uint64_t>(m5 & 0xF)) * B16 |
+                  (static_cast<uint64_t>(m4 & 0xF)) * B12 |
+                  VectorRXB(v1.code(), v2.code(), v3.code(), 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// VRS-b format: <insn> V1,R3,D2(B2),M4
+//    +--------+----+----+----+-------------+----+----+--------+
+//    | OpCode | V1 | R3 | B2 |     D2      | M4 |RXB | OpCode |
+//    +--------+----+----+----+-------------+----+----+--------+
+//    0        8    12   16   20            32   36   40      47
+void Assembler::vrs_b_form(Opcode op, Simd128Register v1, Register r3,
+                           Register b2, Disp d2, Condition m4) {
+  DCHECK(is_uint12(d2));
+  DCHECK(is_uint16(op));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(v1.code() & 0xF)) * B36 |
+                  (static_cast<uint64_t>(r3.code())) * B32 |
+                  (static_cast<uint64_t>(b2.code())) * B28 |
+                  (static_cast<uint64_t>(d2 & 0x0FFF)) * B16 |
+                  (static_cast<uint64_t>(m4 & 0xF)) * B12 |
+                  VectorRXB(v1.code(), 0, 0, 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// VRS-c format: <insn> R1,V3,D2(B2),M4
+//    +--------+----+----+----+-------------+----+----+--------+
+//    | OpCode | R1 | V3 | B2 |     D2      | M4 |RXB | OpCode |
+//    +--------+----+----+----+-------------+----+----+--------+
+//    0        8    12   16   20            32   36   40      47
+void Assembler::vrs_c_form(Opcode op, Register r1, Simd128Register v3,
+                           Register b2, Disp d2, Condition m4) {
+  DCHECK(is_uint12(d2));
+  DCHECK(is_uint16(op));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(r1.code())) * B36 |
+                  (static_cast<uint64_t>(v3.code() & 0xF)) * B32 |
+                  (static_cast<uint64_t>(b2.code())) * B28 |
+                  (static_cast<uint64_t>(d2 & 0x0FFF)) * B16 |
+                  (static_cast<uint64_t>(m4 & 0xF)) * B12 |
+                  VectorRXB(0, v3.code(), 0, 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
+// VRX format: <insn> V1,D2(X2,B2),M3
+//    +--------+----+----+----+-------------+----+----+--------+
+//    | OpCode | V1 | X2 | B2 |     D2      | M3 |RXB | OpCode |
+//    +--------+----+----+----+-------------+----+----+--------+
+//    0        8    12   16   20            32   36   40      47
+void Assembler::vrx_form(Opcode op, Simd128Register v1, Register x2,
+                         Register b2, Disp d2, Condition m3) {
+  DCHECK(is_uint12(d2));
+  DCHECK(is_uint16(op));
+  uint64_t code = (static_cast<uint64_t>(op & 0xFF00)) * B32 |
+                  (static_cast<uint64_t>(v1.code() & 0xF)) * B36 |
+                  (static_cast<uint64_t>(x2.code())) * B32 |
+                  (static_cast<uint64_t>(b2.code())) * B28 |
+                  (static_cast<uint64_t>(d2 & 0x0FFF)) * B16 |
+                  (static_cast<uint64_t>(m3 & 0xF)) * B12 |
+                  VectorRXB(v1.code(), 0, 0, 0) |
+                  (static_cast<uint64_t>(op & 0x00FF));
+  emit6bytes(code);
+}
+
 // end of S390 Instruction generation
 
 // start of S390 instruction
@@ -1380,9 +1628,16 @@ RX_FORM_EMIT(bc, BC)
 RR_FORM_EMIT(bctr, BCTR)
 RXE_FORM_EMIT(ceb, CEB)
 RRE_FORM_EMIT(cefbr, CEFBR)
+RS1_FORM_EMIT(cs, CS)
+RSY1_FORM_EMIT(csg, CSG)
+RSY1_FORM_EMIT(csy, CSY)
 SS1_FORM_EMIT(ed, ED)
 RX_FORM_EMIT(ex, EX)
 RRE_FORM_EMIT(flogr, FLOGR)
+RSY1_FORM_EMIT(laa, LAA)
+RSY1_FORM_EMIT(lan, LAN)
+RSY1_FORM_EMIT(lao, LAO)
+RSY1_FORM_EMIT(lax, LAX)
 RRE_FORM_EMIT(lcgr, LCGR)
 RR_FORM_EMIT(lcr, LCR)
 RX_FORM_EMIT(le_z, LE)
@@ -1408,6 +1663,7 @@ RRE_FORM_EMIT(popcnt, POPCNT_Z)
 RIL1_FORM_EMIT(slfi, SLFI)
 RXY_FORM_EMIT(slgf, SLGF)
 RIL1_FORM_EMIT(slgfi, SLGFI)
+RRE_FORM_EMIT(srst, SRST)
 RXY_FORM_EMIT(strv, STRV)
 RI1_FORM_EMIT(tmll, TMLL)
 SS1_FORM_EMIT(tr, TR)
@@ -1610,6 +1866,59 @@ void Assembler::brc(Condition c, const Operand& opnd) {
   ri_form(BRC, c, halfwordOp);
 }
 
+// Compare And Branch Relative (32)
+void Assembler::crj(Register r1, Register r2, Condition m3,
+                    const Operand& opnd) {
+  // The branch offset is encoded as # of halfwords, so divide by 2.
+  rie_b_form(CRJ, r1, r2, m3, Operand(opnd.immediate() / 2));
+}
+
+// Compare And Branch Relative (64)
+void Assembler::cgrj(Register r1, Register r2, Condition m3,
+                     const Operand& opnd) {
+  rie_b_form(CGRJ, r1, r2, m3, Operand(opnd.immediate() / 2));
+}
+
+// Compare Logical And Branch Relative (32)
+void Assembler::clrj(Register r1, Register r2, Condition m3,
+                     const Operand& opnd) {
+  rie_b_form(CLRJ, r1, r2, m3, Operand(opnd.immediate() / 2));
+}
+
+// Compare Logical And Branch Relative (64)
+void Assembler::clgrj(Register r1, Register r2, Condition m3,
+                      const Operand& opnd) {
+  rie_b_form(CLGRJ, r1, r2, m3, Operand(opnd.immediate() / 2));
+}
+
+// Compare Immediate And Branch Relative (32<-8)
+void Assembler::cij(Register r1, const Operand& i2, Condition m3,
+                    const Operand& opnd) {
+  DCHECK(is_int8(i2.immediate()));
+  rie_c_form(CIJ, r1, i2, m3, Operand(opnd.immediate() / 2));
+}
+
+// Compare Immediate And Branch Relative (64<-8)
+void Assembler::cgij(Register r1, const Operand& i2, Condition m3,
+                     const Operand& opnd) {
+  DCHECK(is_int8(i2.immediate()));
+  rie_c_form(CGIJ, r1, i2, m3, Operand(opnd.immediate() / 2));
+}
+
+// Compare Logical Immediate And Branch Relative (32<-8)
+void Assembler::clij(Register r1, const Operand& i2, Condition m3,
+                     const Operand& opnd) {
+  DCHECK(is_uint8(i2.immediate()));
+  rie_c_form(CLIJ, r1, i2, m3, Operand(opnd.immediate() / 2));
+}
+
+// Compare Logical Immediate And Branch Relative (64<-8)
+void Assembler::clgij(Register r1, const Operand& i2, Condition m3,
+                      const Operand& opnd) {
+  DCHECK(is_uint8(i2.immediate()));
+  rie_c_form(CLGIJ, r1, i2, m3, Operand(opnd.immediate() / 2));
+}
+
 // Branch Relative on Condition (64)
 void Assembler::brcl(Condition c, const Operand& opnd, bool isCodeTarget) {
   Operand halfwordOp = opnd;
@@ -1734,7 +2043,7 @@ void Assembler::cliy(const MemOperand& opnd, const Operand& imm) {
 
 // Compare logical - mem to mem operation
 void Assembler::clc(const MemOperand& opnd1, const MemOperand& opnd2,
-                    Length length) {
+                    uint32_t length) {
   ss_form(CLC, length - 1, opnd1.getBaseRegister(), opnd1.getDisplacement(),
           opnd2.getBaseRegister(), opnd2.getDisplacement());
 }
@@ -1789,6 +2098,13 @@ void Assembler::mvc(const MemOperand& opnd1, const MemOperand& opnd2,
           opnd2.getBaseRegister(), opnd2.getDisplacement());
 }
 
+// Translate And Test
+void Assembler::trt(const MemOperand& opnd1, const MemOperand& opnd2,
+                    uint32_t length) {
+  ss_form(TRT, length - 1, opnd1.getBaseRegister(), opnd1.getDisplacement(),
+          opnd2.getBaseRegister(), opnd2.getDisplacement());
+}
+
 // -----------------------
 // 32-bit Add Instructions
 // -----------------------
@@ -2502,6 +2818,40 @@ void Assembler::lmg(Register r1, Register r2, const MemOperand& src) {
   rsy_form(LMG, r1, r2, src.rb(), src.offset());
 }
 
+// Load On Condition (32)
+void Assembler::locr(Condition m3, Register r1, Register r2) {
+  rrf2_form(LOCR << 16 | m3 * B12 | r1.code() * B4 | r2.code());
+}
+
+// Load On Condition (64)
+void Assembler::locgr(Condition m3, Register r1, Register r2) {
+  rrf2_form(LOCGR << 16 | m3 * B12 | r1.code() * B4 | r2.code());
+}
+
+// Load On Condition (32) - Memory
+void Assembler::loc(Condition m3, Register r1, const MemOperand& src) {
+  DCHECK(src.rx().is(r0));
+  rsy_form(LOC, r1, m3, src.rb(), src.offset());
+}
+
+// Load On Condition (64) - Memory
+void Assembler::locg(Condition m3, Register r1, const MemOperand& src) {
+  DCHECK(src.rx().is(r0));
+  rsy_form(LOCG, r1, m3, src.rb(), src.offset());
+}
+
+// Store On Condition (32)
+void Assembler::stoc(Condition m3, Register r1, const MemOperand& dst) {
+  DCHECK(dst.rx().is(r0));
+  rsy_form(STOC, r1, m3, dst.rb(), dst.offset());
+}
+
+// Store On Condition (64)
+void Assembler::stocg(Condition m3, Register r1, const MemOperand& dst) {
+  DCHECK(dst.rx().is(r0));
+  rsy_form(STOCG, r1, m3, dst.rb(), dst.offset());
+}
+
 // Move integer (32)
 void Assembler::mvhi(const MemOperand& opnd1, const Operand& i2) {
   sil_form(MVHI, opnd1.getBaseRegister(), opnd1.getDisplacement(), i2);
@@ -2897,6 +3247,131 @@ void Assembler::msdbr(DoubleRegister d1, DoubleRegister d3, DoubleRegister d2) {
            Register::from_code(d3.code()), Register::from_code(d2.code()));
 }
 
+// Vector Load
+void Assembler::vl(Simd128Register v1, const MemOperand& opnd) {
+  vrx_form(VL, v1, opnd.rx(), opnd.rb(), opnd.offset(), Condition(0));
+}
+
+// Vector Load With Length: loads bytes 0 to min(r3, 15)
+void Assembler::vll(Simd128Register v1, Register r3, const MemOperand& opnd) {
+  DCHECK(opnd.rx().is(r0));
+  vrs_b_form(VLL, v1, r3, opnd.rb(), opnd.offset(), Condition(0));
+}
+
+// Vector Load Register
+void Assembler::vlr(Simd128Register v1, Simd128Register v2) {
+  vrr_a_form(VLR, v1, v2, Condition(0), Condition(0), Condition(0));
+}
+
+// Vector Load And Replicate
+void Assembler::vlrep(Simd128Register v1, const MemOperand& opnd,
+                      Condition m3) {
+  vrx_form(VLREP, v1, opnd.rx(), opnd.rb(), opnd.offset(), m3);
+}
+
+// Vector Store
+void Assembler::vst(Simd128Register v1, const MemOperand& opnd) {
+  vrx_form(VST, v1, opnd.rx(), opnd.rb(), opnd.offset(), Condition(0));
+}
+
+// Vector Store With Length: stores bytes 0 to min(r3, 15)
+void Assembler::vstl(Simd128Register v1, Register r3, const MemOperand& opnd) {
+  DCHECK(opnd.rx().is(r0));
+  vrs_b_form(VSTL, v1, r3, opnd.rb(), opnd.offset(), Condition(0));
+}
+
+// Vector Generate Byte Mask: byte i is 0xFF if bit i of i2 is set
+void Assembler::vgbm(Simd128Register v1, const Operand& i2) {
+  vri_a_form(VGBM, v1, i2, Condition(0));
+}
+
+// Vector Load GR From VR Element: the element index is the second operand
+// address
+void Assembler::vlgv(Register r1, Simd128Register v3, const MemOperand& opnd,
+                     Condition m4) {
+  DCHECK(opnd.rx().is(r0));
+  vrs_c_form(VLGV, r1, v3, opnd.rb(), opnd.offset(), m4);
+}
+
+// Vector Load VR Element From GR: the element index is the second operand
+// address
+void Assembler::vlvg(Simd128Register v1, Register r3, const MemOperand& opnd,
+                     Condition m4) {
+  DCHECK(opnd.rx().is(r0));
+  vrs_b_form(VLVG, v1, r3, opnd.rb(), opnd.offset(), m4);
+}
+
+// Vector Replicate element i2 of v3
+void Assembler::vrep(Simd128Register v1, Simd128Register v3, const Operand& i2,
+                     Condition m4) {
+  vri_c_form(VREP, v1, v3, i2, m4);
+}
+
+// Vector Replicate Immediate
+void Assembler::vrepi(Simd128Register v1, const Operand& i2, Condition m3) {
+  vri_a_form(VREPI, v1, i2, m3);
+}
+
+// Vector Add
+void Assembler::va(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+                   Condition m4) {
+  vrr_c_form(VA, v1, v2, v3, Condition(0), Condition(0), m4);
+}
+
+// Vector Compare Equal
+void Assembler::vceq(Simd128Register v1, Simd128Register v2,
+                     Simd128Register v3, Condition m4, Condition m5) {
+  vrr_b_form(VCEQ, v1, v2, v3, m5, m4);
+}
+
+// Vector And
+void Assembler::vn(Simd128Register v1, Simd128Register v2,
+                   Simd128Register v3) {
+  vrr_c_form(VN, v1, v2, v3, Condition(0), Condition(0), Condition(0));
+}
+
+// Vector Or
+void Assembler::vo(Simd128Register v1, Simd128Register v2,
+                   Simd128Register v3) {
+  vrr_c_form(VO, v1, v2, v3, Condition(0), Condition(0), Condition(0));
+}
+
+// Vector Subtract
+void Assembler::vs(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+                   Condition m4) {
+  vrr_c_form(VS, v1, v2, v3, Condition(0), Condition(0), m4);
+}
+
+// Vector Exclusive Or
+void Assembler::vx(Simd128Register v1, Simd128Register v2,
+                   Simd128Register v3) {
+  vrr_c_form(VX, v1, v2, v3, Condition(0), Condition(0), Condition(0));
+}
+
+// Vector Find Any Element Equal
+void Assembler::vfae(Simd128Register v1, Simd128Register v2,
+                     Simd128Register v3, Condition m4, Condition m5) {
+  vrr_b_form(VFAE, v1, v2, v3, m5, m4);
+}
+
+// Vector Find Element Equal
+void Assembler::vfee(Simd128Register v1, Simd128Register v2,
+                     Simd128Register v3, Condition m4, Condition m5) {
+  vrr_b_form(VFEE, v1, v2, v3, m5, m4);
+}
+
+// Vector Find Element Not Equal
+void Assembler::vfene(Simd128Register v1, Simd128Register v2,
+                      Simd128Register v3, Condition m4, Condition m5) {
+  vrr_b_form(VFENE, v1, v2, v3, m5, m4);
+}
+
+// Vector Isolate String
+void Assembler::vistr(Simd128Register v1, Simd128Register v2, Condition m3,
+                      Condition m5) {
+  vrr_a_form(VISTR, v1, v2, m5, Condition(0), m3);
+}
+
 // end of S390instructions
 
 bool Assembler::IsNop(SixByteInstr instr, int type) {
@@ -93,6 +93,12 @@ namespace internal {
 #define ALLOCATABLE_DOUBLE_REGISTERS(V)                   \
   V(d1)  V(d2)  V(d3)  V(d4)  V(d5)  V(d6)  V(d7)         \
   V(d8)  V(d9)  V(d10) V(d11) V(d12) V(d15) V(d0)
+
+#define VECTOR_REGISTERS(V)                               \
+  V(v0)  V(v1)  V(v2)  V(v3)  V(v4)  V(v5)  V(v6)  V(v7)  \
+  V(v8)  V(v9)  V(v10) V(v11) V(v12) V(v13) V(v14) V(v15) \
+  V(v16) V(v17) V(v18) V(v19) V(v20) V(v21) V(v22) V(v23) \
+  V(v24) V(v25) V(v26) V(v27) V(v28) V(v29) V(v30) V(v31)
 // clang-format on
 
 // CPU Registers.
@@ -273,8 +279,42 @@ const CRegister cr13 = {13};
 const CRegister cr14 = {14};
 const CRegister cr15 = {15};
 
-// TODO(john.yan) Define SIMD registers.
-typedef DoubleRegister Simd128Register;
+// 128-bit vector register of the vector facility. v0-v15 overlay the double
+// registers: the leftmost doubleword of vN is dN.
+struct VectorRegister {
+  enum Code {
+#define REGISTER_CODE(R) kCode_##R,
+    VECTOR_REGISTERS(REGISTER_CODE)
+#undef REGISTER_CODE
+        kAfterLast,
+    kCode_no_reg = -1
+  };
+
+  static const int kNumRegisters = Code::kAfterLast;
+
+  bool is_valid() const { return 0 <= reg_code && reg_code < kNumRegisters; }
+  bool is(VectorRegister reg) const { return reg_code == reg.reg_code; }
+
+  int code() const {
+    DCHECK(is_valid());
+    return reg_code;
+  }
+
+  static VectorRegister from_code(int code) {
+    VectorRegister r = {code};
+    return r;
+  }
+
+  int reg_code;
+};
+
+#define DECLARE_REGISTER(R) \
+  const VectorRegister R = {VectorRegister::kCode_##R};
+VECTOR_REGISTERS(DECLARE_REGISTER)
+#undef DECLARE_REGISTER
+const VectorRegister no_vreg = {VectorRegister::kCode_no_reg};
+
+typedef VectorRegister Simd128Register;
 
 // -----------------------------------------------------------------------------
 // Machine instruction Operands
@@ -774,6 +814,9 @@ class Assembler : public AssemblerBase {
   RXE_FORM(cdb);
   RXE_FORM(ceb);
   RRE_FORM(cefbr);
+  RS1_FORM(cs);
+  RSY1_FORM(csg);
+  RSY1_FORM(csy);
   RXE_FORM(ddb);
   RRE_FORM(ddbr);
   SS1_FORM(ed);
@@ -789,6 +832,10 @@ class Assembler : public AssemblerBase {
   RIL1_FORM(iilf);
   RI1_FORM(iilh);
   RI1_FORM(iill);
+  RSY1_FORM(laa);
+  RSY1_FORM(lan);
+  RSY1_FORM(lao);
+  RSY1_FORM(lax);
   RRE_FORM(lcgr);
   RR_FORM(lcr);
   RX_FORM(le_z);
@@ -822,6 +869,7 @@ class Assembler : public AssemblerBase {
   RXY_FORM(slgf);
   RIL1_FORM(slgfi);
   RS1_FORM(srdl);
+  RRE_FORM(srst);
   RX_FORM(ste);
   RXY_FORM(stey);
   RXY_FORM(strv);
@@ -879,6 +927,12 @@ class Assembler : public AssemblerBase {
   void lmy(Register r1, Register r2, const MemOperand& src);
   void lmg(Register r1, Register r2, const MemOperand& src);
 
+  // Load On Condition Instructions (LOAD_STORE_ON_COND)
+  void locr(Condition m3, Register r1, Register r2);
+  void locgr(Condition m3, Register r1, Register r2);
+  void loc(Condition m3, Register r1, const MemOperand& src);
+  void locg(Condition m3, Register r1, const MemOperand& src);
+
   // Store Instructions
   void st(Register r, const MemOperand& src);
   void stc(Register r, const MemOperand& src);
@@ -888,6 +942,10 @@ class Assembler : public AssemblerBase {
   void sthy(Register r, const MemOperand& src);
   void sty(Register r, const MemOperand& src);
 
+  // Store On Condition Instructions (LOAD_STORE_ON_COND)
+  void stoc(Condition m3, Register r1, const MemOperand& dst);
+  void stocg(Condition m3, Register r1, const MemOperand& dst);
+
   // Store Multiple Instructions
   void stm(Register r1, Register r2, const MemOperand& src);
   void stmy(Register r1, Register r2, const MemOperand& src);
@@ -916,7 +974,7 @@ class Assembler : public AssemblerBase {
   void clgfi(Register r, const Operand& opnd);
   void cli(const MemOperand& mem, const Operand& imm);
   void cliy(const MemOperand& mem, const Operand& imm);
-  void clc(const MemOperand& opnd1, const MemOperand& opnd2, Length length);
+  void clc(const MemOperand& opnd1, const MemOperand& opnd2, uint32_t length);
 
   // Test Under Mask Instructions
   void tm(const MemOperand& mem, const Operand& imm);
@@ -971,6 +1029,9 @@ class Assembler : public AssemblerBase {
   // Move Character (Mem to Mem)
   void mvc(const MemOperand& opnd1, const MemOperand& opnd2, uint32_t length);
 
+  // Translate And Test
+  void trt(const MemOperand& opnd1, const MemOperand& opnd2, uint32_t length);
+
   // Branch Instructions
   void basr(Register r1, Register r2);
   void bcr(Condition m, Register target);
@@ -983,6 +1044,17 @@ class Assembler : public AssemblerBase {
   void brct(Register r1, const Operand& opnd);
   void brctg(Register r1, const Operand& opnd);
 
+  // Compare And Branch Relative Instructions (branch offset in bytes)
+  void crj(Register r1, Register r2, Condition m3, const Operand& opnd);
+  void cgrj(Register r1, Register r2, Condition m3, const Operand& opnd);
+  void clrj(Register r1, Register r2, Condition m3, const Operand& opnd);
+  void clgrj(Register r1, Register r2, Condition m3, const Operand& opnd);
+  void cij(Register r1, const Operand& i2, Condition m3, const Operand& opnd);
+  void cgij(Register r1, const Operand& i2, Condition m3, const Operand& opnd);
+  void clij(Register r1, const Operand& i2, Condition m3, const Operand& opnd);
+  void clgij(Register r1, const Operand& i2, Condition m3,
+             const Operand& opnd);
+
   // 32-bit Add Instructions
   void a(Register r1, const MemOperand& opnd);
   void ay(Register r1, const MemOperand& opnd);
@@ -1191,6 +1263,45 @@ class Assembler : public AssemblerBase {
   void mvhi(const MemOperand& opnd1, const Operand& i2);
   void mvghi(const MemOperand& opnd1, const Operand& i2);
 
+  // Vector Load / Store Instructions (VECTOR_FACILITY)
+  void vl(Simd128Register v1, const MemOperand& opnd);
+  void vll(Simd128Register v1, Register r3, const MemOperand& opnd);
+  void vlr(Simd128Register v1, Simd128Register v2);
+  void vlrep(Simd128Register v1, const MemOperand& opnd, Condition m3);
+  void vst(Simd128Register v1, const MemOperand& opnd);
+  void vstl(Simd128Register v1, Register r3, const MemOperand& opnd);
+
+  // Vector Element Instructions
+  void vgbm(Simd128Register v1, const Operand& i2);
+  void vlgv(Register r1, Simd128Register v3, const MemOperand& opnd,
+            Condition m4);
+  void vlvg(Simd128Register v1, Register r3, const MemOperand& opnd,
+            Condition m4);
+  void vrep(Simd128Register v1, Simd128Register v3, const Operand& i2,
+            Condition m4);
+  void vrepi(Simd128Register v1, const Operand& i2, Condition m3);
+
+  // Vector Integer Instructions
+  void va(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+          Condition m4);
+  void vceq(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+            Condition m4, Condition m5);
+  void vn(Simd128Register v1, Simd128Register v2, Simd128Register v3);
+  void vo(Simd128Register v1, Simd128Register v2, Simd128Register v3);
+  void vs(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+          Condition m4);
+  void vx(Simd128Register v1, Simd128Register v2, Simd128Register v3);
+
+  // Vector String Instructions
+  void vfae(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+            Condition m4, Condition m5);
+  void vfee(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+            Condition m4, Condition m5);
+  void vfene(Simd128Register v1, Simd128Register v2, Simd128Register v3,
+             Condition m4, Condition m5);
+  void vistr(Simd128Register v1, Simd128Register v2, Condition m3,
+             Condition m5);
+
   // Exception-generating instructions and debugging support
   void stop(const char* msg, Condition cond = al,
             int32_t code = kDefaultStopCode, CRegister cr = cr7);
@@ -1291,6 +1402,12 @@ class Assembler : public AssemblerBase {
 
   static bool IsCmpRegister(Instr instr);
   static bool IsCmpImmediate(Instr instr);
+  // Compare and branch relative instructions carry a 16-bit halfword offset.
+  static bool IsCompareAndBranch(Opcode opcode) {
+    return opcode == CRJ || opcode == CGRJ || opcode == CLRJ ||
+           opcode == CLGRJ || opcode == CIJ || opcode == CGIJ ||
+           opcode == CLIJ || opcode == CLGIJ;
+  }
   static bool IsNop(SixByteInstr instr, int type = NON_MARKING_NOP);
 
   // The code currently calls CheckBuffer() too often. This has the side
@@ -1374,6 +1491,10 @@ class Assembler : public AssemblerBase {
   inline void rie_form(Opcode op, Register r1, Register r3, const Operand& i2);
   inline void rie_f_form(Opcode op, Register r1, Register r2, const Operand& i3,
                          const Operand& i4, const Operand& i5);
+  inline void rie_b_form(Opcode op, Register r1, Register r2, Condition m3,
+                         const Operand& i4);
+  inline void rie_c_form(Opcode op, Register r1, const Operand& i2,
+                         Condition m3, const Operand& i4);
 
   inline void ril_form(Opcode op, Register r1, const Operand& i2);
   inline void ril_form(Opcode op, Condition m1, const Operand& i2);
@@ -1436,6 +1557,27 @@ class Assembler : public AssemblerBase {
   inline void ss_form(Opcode op, Register r1, Register r2, Register b1, Disp d1,
                       Register b2, Disp d2);
   inline void sse_form(Opcode op, Register b1, Disp d1, Register b2, Disp d2);
+  inline void vri_a_form(Opcode op, Simd128Register v1, const Operand& i2,
+                         Condition m3);
+  inline void vri_c_form(Opcode op, Simd128Register v1, Simd128Register v3,
+                         const Operand& i2, Condition m4);
+
+  inline void vrr_a_form(Opcode op, Simd128Register v1, Simd128Register v2,
+                         Condition m5, Condition m4, Condition m3);
+  inline void vrr_b_form(Opcode op, Simd128Register v1, Simd128Register v2,
+                         Simd128Register v3, Condition m5, Condition m4);
+  inline void vrr_c_form(Opcode op, Simd128Register v1, Simd128Register v2,
+                         Simd128Register v3, Condition m6, Condition m5,
+                         Condition m4);
+
+  inline void vrs_b_form(Opcode op, Simd128Register v1, Register r3,
+                         Register b2, Disp d2, Condition m4);
+  inline void vrs_c_form(Opcode op, Register r1, Simd128Register v3,
+                         Register b2, Disp d2, Condition m4);
+
+  inline void vrx_form(Opcode op, Simd128Register v1, Register x2, Register b2,
+                       Disp d2, Condition m3);
+
   inline void ssf_form(Opcode op, Register r3, Register b1, Disp d1,
                        Register b2, Disp d2);
 
@@ -2444,14 +2444,7 @@ void StringHelper::GenerateCopyCharacters(MacroAssembler* masm, Register dest,
   }
 
   // Copy count bytes from src to dst.
-  Label byte_loop;
-  // TODO(joransiu): Convert into MVC loop
-  __ bind(&byte_loop);
-  __ LoadlB(scratch, MemOperand(src));
-  __ la(src, MemOperand(src, 1));
-  __ stc(scratch, MemOperand(dest));
-  __ la(dest, MemOperand(dest, 1));
-  __ BranchOnCount(count, &byte_loop);
+  __ CopyBytes(src, dest, count, scratch);
 
   __ bind(&done);
 }
@@ -2886,27 +2879,39 @@ void StringHelper::GenerateCompareFlatOneByteStrings(
 void StringHelper::GenerateOneByteCharsCompareLoop(
     MacroAssembler* masm, Register left, Register right, Register length,
     Register scratch1, Label* chars_not_equal) {
-  // Change index to run from -length to -1 by adding length to string
-  // start. This means that loop ends when index reaches zero, which
-  // doesn't need an additional compare.
+  DCHECK(!length.is(r0) && !scratch1.is(r0));
   __ SmiUntag(length);
-  __ AddP(scratch1, length,
-          Operand(SeqOneByteString::kHeaderSize - kHeapObjectTag));
-  __ AddP(left, scratch1);
-  __ AddP(right, scratch1);
-  __ LoadComplementRR(length, length);
-  Register index = length;  // index = -length;
+  __ AddP(left, Operand(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+  __ AddP(right, Operand(SeqOneByteString::kHeaderSize - kHeapObjectTag));
 
-  // Compare loop.
-  Label loop;
+  // CLC compares the characters as unsigned bytes and stops at the first
+  // difference, leaving CC1 (lt) if left is lower and CC2 (gt) if higher.
+  Label loop, left_bytes, clc_template, done;
   __ bind(&loop);
-  __ LoadlB(scratch1, MemOperand(left, index));
-  __ LoadlB(r0, MemOperand(right, index));
-  __ CmpP(scratch1, r0);
+  __ CmpP(length, Operand(static_cast<intptr_t>(0x100)));
+  __ blt(&left_bytes);
+  __ clc(MemOperand(left), MemOperand(right), 0x100);
   __ bne(chars_not_equal);
-  __ AddP(index, Operand(1));
-  __ CmpP(index, Operand::Zero());
-  __ bne(&loop);
+  __ AddP(left, Operand(static_cast<intptr_t>(0x100)));
+  __ AddP(right, Operand(static_cast<intptr_t>(0x100)));
+  __ SubP(length, Operand(static_cast<intptr_t>(0x100)));
+  __ b(&loop);
+
+  // Compare the remaining 1 to 255 characters with a single CLC, whose length
+  // is supplied by EX.
+  __ bind(&left_bytes);
+  __ CmpP(length, Operand::Zero());
+  __ beq(&done);
+  __ larl(scratch1, &clc_template);
+  __ SubP(length, Operand(static_cast<intptr_t>(0x1)));
+  __ ex(length, MemOperand(scratch1));
+  __ bne(chars_not_equal);
+  __ b(&done);
+
+  __ bind(&clc_template);
+  __ clc(MemOperand(left), MemOperand(right), 1);
+
+  __ bind(&done);
 }
 
 void StringCompareStub::Generate(MacroAssembler* masm) {
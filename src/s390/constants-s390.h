@@ -26,6 +26,9 @@ const int kNumRegisters = 16;
 // FP support.
 const int kNumDoubleRegisters = 16;
 
+// Vector facility. Vector registers 0-15 overlay the FP registers.
+const int kNumVectorRegisters = 32;
+
 const int kNoRegister = -1;
 
 // sign-extend the least significant 16-bits of value <imm>
@@ -350,14 +353,21 @@ enum Opcode {
   CLGEBR = 0xB3AC,    // Convert To Logical (short BFP to 64)
   CLGF = 0xE331,      // Compare Logical (64<-32)
   CLGFI = 0xC2E,      // Compare Logical Immediate (64<-32)
+  CLGIJ = 0xEC7D,     // Compare Logical Immediate And Branch Relative (64<-8)
   CLGR = 0xB921,      // Compare Logical (64)
+  CLGRJ = 0xEC65,     // Compare Logical And Branch Relative (64)
   CLI = 0x95,         // Compare Logical Immediate (8)
+  CLIJ = 0xEC7F,      // Compare Logical Immediate And Branch Relative (32<-8)
   CLIY = 0xEB55,      // Compare Logical Immediate (8)
   CLR = 0x15,         // Compare Logical (32)
+  CLRJ = 0xEC77,      // Compare Logical And Branch Relative (32)
   CLY = 0xE355,       // Compare Logical (32)
   CD = 0x69,          // Compare (LH)
   CDR = 0x29,         // Compare (LH)
   CR = 0x19,          // Compare (32)
+  CRJ = 0xEC76,       // Compare And Branch Relative (32)
+  CS = 0xBA,          // Compare And Swap (32)
+  CSG = 0xEB30,       // Compare And Swap (64)
   CSST = 0xC82,       // Compare And Swap And Store
   CSXTR = 0xB3EB,     // Convert To Signed Packed (extended DFP to 128)
   CSY = 0xEB14,       // Compare And Swap (32)
@@ -901,6 +911,27 @@ enum Opcode {
   UNPKA = 0xEA,       // Unpack Ascii
   UNPKU = 0xE2,       // Unpack Unicode
   UPT = 0x0102,       // Update Tree
+  VA = 0xE7F3,        // Vector Add
+  VCEQ = 0xE7F8,      // Vector Compare Equal
+  VFAE = 0xE782,      // Vector Find Any Element Equal
+  VFEE = 0xE780,      // Vector Find Element Equal
+  VFENE = 0xE781,     // Vector Find Element Not Equal
+  VGBM = 0xE744,      // Vector Generate Byte Mask
+  VISTR = 0xE75C,     // Vector Isolate String
+  VL = 0xE706,        // Vector Load
+  VLGV = 0xE721,      // Vector Load GR From VR Element
+  VLL = 0xE737,       // Vector Load With Length
+  VLR = 0xE756,       // Vector Load (register)
+  VLREP = 0xE705,     // Vector Load And Replicate
+  VLVG = 0xE722,      // Vector Load VR Element From GR
+  VN = 0xE768,        // Vector And
+  VO = 0xE76A,        // Vector Or
+  VREP = 0xE74D,      // Vector Replicate
+  VREPI = 0xE745,     // Vector Replicate Immediate
+  VS = 0xE7F7,        // Vector Subtract
+  VST = 0xE70E,       // Vector Store
+  VSTL = 0xE73F,      // Vector Store With Length
+  VX = 0xE76D,        // Vector Exclusive Or
   X = 0x57,           // Exclusive Or (32)
   XC = 0xD7,          // Exclusive Or (character)
   XG = 0xE382,        // Exclusive Or (64)
@@ -1052,6 +1083,22 @@ enum FPRoundingMode {
 
 const uint32_t kFPRoundingModeMask = 3;
 
+// Element sizes of vector instructions, as encoded in their M fields.
+enum VectorElementSize {
+  kVectorByte = 0,
+  kVectorHalfword = 1,
+  kVectorWord = 2,
+  kVectorDoubleword = 3
+};
+
+// Flags in the M5 field of the vector string instructions.
+enum VectorStringFlags {
+  kVectorStringCS = 0x1,  // Set the condition code.
+  kVectorStringZS = 0x2,  // Also search for a zero element.
+  kVectorStringRT = 0x4,  // VFAE: Return a mask instead of an index.
+  kVectorStringIN = 0x8   // VFAE: Invert the comparison.
+};
+
 enum CheckForInexactConversion {
   kCheckForInexactConversion,
   kDontCheckForInexactConversion
@@ -1535,6 +1582,41 @@ class RIEInstruction : Instruction {
   inline int size() const { return 6; }
 };
 
+// Vector instructions extend each vector register field by the corresponding
+// RXB bit (bits 36-39), which holds the most significant bit of the register
+// number.
+class VectorInstruction : Instruction {
+ public:
+  inline int RXBValue() const { return Bits<SixByteInstr, int>(11, 8); }
+  // Vector register fields by position: bits 8-11, 12-15, 16-19 and 32-35.
+  inline int V1Value() const {
+    return Bits<SixByteInstr, int>(39, 36) | ((RXBValue() & 0x8) << 1);
+  }
+  inline int V2Value() const {
+    return Bits<SixByteInstr, int>(35, 32) | ((RXBValue() & 0x4) << 2);
+  }
+  inline int V3Value() const {
+    return Bits<SixByteInstr, int>(31, 28) | ((RXBValue() & 0x2) << 3);
+  }
+  inline int V4Value() const {
+    return Bits<SixByteInstr, int>(15, 12) | ((RXBValue() & 0x1) << 4);
+  }
+  // General register fields by position: bits 8-11 and 12-15.
+  inline int R1Value() const { return Bits<SixByteInstr, int>(39, 36); }
+  inline int R2Value() const { return Bits<SixByteInstr, int>(35, 32); }
+  // Base and index registers and displacement of VRX and VRS instructions.
+  inline int X2Value() const { return Bits<SixByteInstr, int>(35, 32); }
+  inline int B2Value() const { return Bits<SixByteInstr, int>(31, 28); }
+  inline int D2Value() const { return Bits<SixByteInstr, int>(27, 16); }
+  // Mask fields by position: bits 24-27, 28-31 and 32-35.
+  inline int M24Value() const { return Bits<SixByteInstr, int>(23, 20); }
+  inline int M28Value() const { return Bits<SixByteInstr, int>(19, 16); }
+  inline int M32Value() const { return Bits<SixByteInstr, int>(15, 12); }
+  // Immediate of VRI instructions, bits 16-31.
+  inline int I2Value() const { return Bits<SixByteInstr, int>(31, 16); }
+  inline int size() const { return 6; }
+};
+
 // Helper functions for converting between register numbers and names.
 class Registers {
  public:
@@ -63,11 +63,13 @@ class Decoder {
   // Printing of common values.
   void PrintRegister(int reg);
   void PrintDRegister(int reg);
+  void PrintVRegister(int reg);
   void PrintSoftwareInterrupt(SoftwareInterruptCodes svc);
 
   // Handle formatting of instructions and their options.
   int FormatRegister(Instruction* instr, const char* option);
   int FormatFloatingRegister(Instruction* instr, const char* option);
+  int FormatVectorRegister(Instruction* instr, const char* option);
   int FormatMask(Instruction* instr, const char* option);
   int FormatDisplacement(Instruction* instr, const char* option);
   int FormatImmediate(Instruction* instr, const char* option);
@@ -114,6 +116,11 @@ void Decoder::PrintDRegister(int reg) {
   Print(DoubleRegister::from_code(reg).ToString());
 }
 
+// Print the vector register name according to the active name converter.
+void Decoder::PrintVRegister(int reg) {
+  Print(converter_.NameOfXMMRegister(reg));
+}
+
 // Print SoftwareInterrupt codes. Factoring this out reduces the complexity of
 // the FormatOption method.
 void Decoder::PrintSoftwareInterrupt(SoftwareInterruptCodes svc) {
@@ -223,6 +230,28 @@ int Decoder::FormatFloatingRegister(Instruction* instr, const char* format) {
   return -1;
 }
 
+// Vector register fields are extended to 5 bits by the RXB field.
+int Decoder::FormatVectorRegister(Instruction* instr, const char* format) {
+  DCHECK(format[0] == 'v');
+  VectorInstruction* vinstr = reinterpret_cast<VectorInstruction*>(instr);
+
+  if (format[1] == '1') {  // 'v1: register resides in bit 8-11
+    PrintVRegister(vinstr->V1Value());
+    return 2;
+  } else if (format[1] == '2') {  // 'v2: register resides in bit 12-15
+    PrintVRegister(vinstr->V2Value());
+    return 2;
+  } else if (format[1] == '3') {  // 'v3: register resides in bit 16-19
+    PrintVRegister(vinstr->V3Value());
+    return 2;
+  } else if (format[1] == '4') {  // 'v4: register resides in bit 32-35
+    PrintVRegister(vinstr->V4Value());
+    return 2;
+  }
+  UNREACHABLE();
+  return -1;
+}
+
 // FormatOption takes a formatting string and interprets it based on
 // the current instructions. The format string points to the first
 // character of the option string (the option escape has already been
@@ -250,6 +279,9 @@ int Decoder::FormatOption(Instruction* instr, const char* format) {
     case 'f': {
       return FormatFloatingRegister(instr, format);
     }
+    case 'v': {
+      return FormatVectorRegister(instr, format);
+    }
     case 'i': {  // int16
       return FormatImmediate(instr, format);
     }
@@ -316,6 +348,26 @@ int Decoder::FormatMask(Instruction* instr, const char* format) {
     value = reinterpret_cast<RXInstruction*>(instr)->B2Value();
     out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "0x%x", value);
     return 2;
+  } else if (format[1] == '3') {  // vector mask in bit 32-35
+    value = reinterpret_cast<VectorInstruction*>(instr)->M32Value();
+    out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "%d", value);
+    return 2;
+  } else if (format[1] == '4') {  // vector mask in bit 28-31
+    value = reinterpret_cast<VectorInstruction*>(instr)->M28Value();
+    out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "%d", value);
+    return 2;
+  } else if (format[1] == '5') {  // vector mask in bit 24-27
+    value = reinterpret_cast<VectorInstruction*>(instr)->M24Value();
+    out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "%d", value);
+    return 2;
+  } else if (format[1] == '6') {  // RIE-b mask in bit 32-35
+    value = reinterpret_cast<RIEInstruction*>(instr)->I5Value() >> 4;
+    out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "0x%x", value);
+    return 2;
+  } else if (format[1] == '7') {  // RIE-c/RSY mask in bit 12-15
+    value = reinterpret_cast<RIEInstruction*>(instr)->R2Value();
+    out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "0x%x", value);
+    return 2;
   }
 
   out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "%d", value);
@@ -447,6 +499,23 @@ int Decoder::FormatImmediate(Instruction* instr, const char* format) {
         out_buffer_ + out_buffer_pos_, "%d -> %s", value,
         converter_.NameOfAddress(reinterpret_cast<byte*>(instr) + value));
     return 2;
+  } else if (format[1] == 'f') {  // RIE immediate in 16-31, outputs as offset
+    RIEInstruction* rie_instr = reinterpret_cast<RIEInstruction*>(instr);
+    int32_t value = rie_instr->I6Value() * 2;
+    if (value >= 0)
+      out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "*+");
+    else
+      out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "*");
+
+    out_buffer_pos_ += SNPrintF(
+        out_buffer_ + out_buffer_pos_, "%d -> %s", value,
+        converter_.NameOfAddress(reinterpret_cast<byte*>(instr) + value));
+    return 2;
+  } else if (format[1] == 'g') {  // signed immediate in 32-39
+    RIEInstruction* rie_instr = reinterpret_cast<RIEInstruction*>(instr);
+    int8_t value = static_cast<int8_t>(rie_instr->I5Value());
+    out_buffer_pos_ += SNPrintF(out_buffer_ + out_buffer_pos_, "%d", value);
+    return 2;
   }
 
   UNREACHABLE();
@@ -631,6 +700,9 @@ bool Decoder::DecodeFourByte(Instruction* instr) {
     case LM:
       Format(instr, "lm\t'r1,'r2,'d1('r3)");
       break;
+    case CS:
+      Format(instr, "cs\t'r1,'r2,'d1('r3)");
+      break;
     case SLL:
       Format(instr, "sll\t'r1,'d1('r3)");
       break;
@@ -709,6 +781,9 @@ bool Decoder::DecodeFourByte(Instruction* instr) {
     case LLGFR:
       Format(instr, "llgfr\t'r5,'r6");
       break;
+    case SRST:
+      Format(instr, "srst\t'r5,'r6");
+      break;
     case LBR:
       Format(instr, "lbr\t'r5,'r6");
       break;
@@ -733,6 +808,12 @@ bool Decoder::DecodeFourByte(Instruction* instr) {
     case LGDR:
       Format(instr, "lgdr\t'r5,'f6");
       break;
+    case LOCR:
+      Format(instr, "locr\t'r5,'r6,'m2");
+      break;
+    case LOCGR:
+      Format(instr, "locgr\t'r5,'r6,'m2");
+      break;
     case LGFR:
       Format(instr, "lgfr\t'r5,'r6");
       break;
@@ -844,6 +925,9 @@ bool Decoder::DecodeFourByte(Instruction* instr) {
     case LA:
       Format(instr, "la\t'r1,'d1('r2d,'r3)");
       break;
+    case EX:
+      Format(instr, "ex\t'r1,'d1('r2d,'r3)");
+      break;
     case CH:
       Format(instr, "ch\t'r1,'d1('r2d,'r3)");
       break;
@@ -1085,6 +1169,30 @@ bool Decoder::DecodeSixByte(Instruction* instr) {
     case RISBG:
       Format(instr, "risbg\t'r1,'r2,'i9,'ia,'ib");
       break;
+    case CRJ:
+      Format(instr, "crj\t'r1,'r2,'m6,'if");
+      break;
+    case CGRJ:
+      Format(instr, "cgrj\t'r1,'r2,'m6,'if");
+      break;
+    case CLRJ:
+      Format(instr, "clrj\t'r1,'r2,'m6,'if");
+      break;
+    case CLGRJ:
+      Format(instr, "clgrj\t'r1,'r2,'m6,'if");
+      break;
+    case CIJ:
+      Format(instr, "cij\t'r1,'ig,'m7,'if");
+      break;
+    case CGIJ:
+      Format(instr, "cgij\t'r1,'ig,'m7,'if");
+      break;
+    case CLIJ:
+      Format(instr, "clij\t'r1,'ib,'m7,'if");
+      break;
+    case CLGIJ:
+      Format(instr, "clgij\t'r1,'ib,'m7,'if");
+      break;
     case RISBGN:
       Format(instr, "risbgn\t'r1,'r2,'i9,'ia,'ib");
       break;
@@ -1094,6 +1202,36 @@ bool Decoder::DecodeSixByte(Instruction* instr) {
     case LMG:
       Format(instr, "lmg\t'r1,'r2,'d2('r3)");
       break;
+    case CSY:
+      Format(instr, "csy\t'r1,'r2,'d2('r3)");
+      break;
+    case CSG:
+      Format(instr, "csg\t'r1,'r2,'d2('r3)");
+      break;
+    case LAA:
+      Format(instr, "laa\t'r1,'r2,'d2('r3)");
+      break;
+    case LAN:
+      Format(instr, "lan\t'r1,'r2,'d2('r3)");
+      break;
+    case LAO:
+      Format(instr, "lao\t'r1,'r2,'d2('r3)");
+      break;
+    case LAX:
+      Format(instr, "lax\t'r1,'r2,'d2('r3)");
+      break;
+    case LOC:
+      Format(instr, "loc\t'r1,'d2('r3),'m7");
+      break;
+    case LOCG:
+      Format(instr, "locg\t'r1,'d2('r3),'m7");
+      break;
+    case STOC:
+      Format(instr, "stoc\t'r1,'d2('r3),'m7");
+      break;
+    case STOCG:
+      Format(instr, "stocg\t'r1,'d2('r3),'m7");
+      break;
     case STMY:
       Format(instr, "stmy\t'r1,'r2,'d2('r3)");
       break;
@@ -1241,6 +1379,12 @@ bool Decoder::DecodeSixByte(Instruction* instr) {
     case MVC:
       Format(instr, "mvc\t'd3('i8,'r3),'d4('r7)");
       break;
+    case CLC:
+      Format(instr, "clc\t'd3('i8,'r3),'d4('r7)");
+      break;
+    case TRT:
+      Format(instr, "trt\t'd3('i8,'r3),'d4('r7)");
+      break;
     case MVHI:
       Format(instr, "mvhi\t'd3('r3),'id");
       break;
@@ -1301,6 +1445,69 @@ bool Decoder::DecodeSixByte(Instruction* instr) {
     case SQDB:
       Format(instr, "sqdb\t'r1,'d1('r2d, 'r3)");
       break;
+    case VL:
+      Format(instr, "vl\t'v1,'d1('r2d,'r3)");
+      break;
+    case VLL:
+      Format(instr, "vll\t'v1,'r2,'d1('r3)");
+      break;
+    case VLR:
+      Format(instr, "vlr\t'v1,'v2");
+      break;
+    case VLREP:
+      Format(instr, "vlrep\t'v1,'d1('r2d,'r3),'m3");
+      break;
+    case VST:
+      Format(instr, "vst\t'v1,'d1('r2d,'r3)");
+      break;
+    case VSTL:
+      Format(instr, "vstl\t'v1,'r2,'d1('r3)");
+      break;
+    case VGBM:
+      Format(instr, "vgbm\t'v1,'i6");
+      break;
+    case VLGV:
+      Format(instr, "vlgv\t'r1,'v2,'d1('r3),'m3");
+      break;
+    case VLVG:
+      Format(instr, "vlvg\t'v1,'r2,'d1('r3),'m3");
+      break;
+    case VREP:
+      Format(instr, "vrep\t'v1,'v2,'i6,'m3");
+      break;
+    case VREPI:
+      Format(instr, "vrepi\t'v1,'i1,'m3");
+      break;
+    case VA:
+      Format(instr, "va\t'v1,'v2,'v3,'m3");
+      break;
+    case VCEQ:
+      Format(instr, "vceq\t'v1,'v2,'v3,'m3,'m5");
+      break;
+    case VN:
+      Format(instr, "vn\t'v1,'v2,'v3");
+      break;
+    case VO:
+      Format(instr, "vo\t'v1,'v2,'v3");
+      break;
+    case VS:
+      Format(instr, "vs\t'v1,'v2,'v3,'m3");
+      break;
+    case VX:
+      Format(instr, "vx\t'v1,'v2,'v3");
+      break;
+    case VFAE:
+      Format(instr, "vfae\t'v1,'v2,'v3,'m3,'m5");
+      break;
+    case VFEE:
+      Format(instr, "vfee\t'v1,'v2,'v3,'m3,'m5");
+      break;
+    case VFENE:
+      Format(instr, "vfene\t'v1,'v2,'v3,'m3,'m5");
+      break;
+    case VISTR:
+      Format(instr, "vistr\t'v1,'v2,'m3,'m5");
+      break;
     default:
       return false;
   }
@@ -1350,10 +1557,16 @@ const char* NameConverter::NameOfByteCPURegister(int reg) const {
 }
 
 const char* NameConverter::NameOfXMMRegister(int reg) const {
-  // S390 does not have XMM register
-  // TODO(joransiu): Consider update this for Vector Regs
-  UNREACHABLE();
-  return "noxmmreg";
+  // S390 does not have XMM register, the closest are the vector registers.
+  static const char* const kVectorRegisterNames[] = {
+      "v0",  "v1",  "v2",  "v3",  "v4",  "v5",  "v6",  "v7",
+      "v8",  "v9",  "v10", "v11", "v12", "v13", "v14", "v15",
+      "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23",
+      "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31"};
+  if (reg < 0 || reg >= v8::internal::kNumVectorRegisters) {
+    return "noxmmreg";
+  }
+  return kVectorRegisterNames[reg];
 }
 
 const char* NameConverter::NameInCode(byte* addr) const {
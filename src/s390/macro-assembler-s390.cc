@@ -2986,9 +2986,12 @@ void MacroAssembler::AllocateJSValue(Register result, Register constructor,
 
 void MacroAssembler::CopyBytes(Register src, Register dst, Register length,
                                Register scratch) {
-  Label big_loop, left_bytes, done, fake_call;
+  Label big_loop, left_bytes, mvc_template, done;
 
   DCHECK(!scratch.is(r0));
+  // EX with r0 does not modify the target instruction, and r0 as an index
+  // register reads as zero.
+  DCHECK(!length.is(r0));
 
   // big loop moves 256 bytes at a time
   bind(&big_loop);
@@ -3006,26 +3009,19 @@ void MacroAssembler::CopyBytes(Register src, Register dst, Register length,
   CmpP(length, Operand::Zero());
   beq(&done);
 
-  // TODO(john.yan): More optimal version is to use MVC
-  // Sequence below has some undiagnosed issue.
-  /*
-  b(scratch, &fake_call);  // use brasl to Save mvc addr to scratch
-  mvc(MemOperand(dst), MemOperand(src), 1);
-  bind(&fake_call);
-  SubP(length, Operand(static_cast<intptr_t>(-1)));
-  ex(length, MemOperand(scratch));  // execute mvc instr above
-  AddP(src, length);
-  AddP(dst, length);
-  AddP(src, Operand(static_cast<intptr_t>(0x1)));
-  AddP(dst, Operand(static_cast<intptr_t>(0x1)));
-  */
+  // Move the remaining 1 to 255 bytes with a single MVC. EX ors the low byte
+  // of length - 1 into the length field of the template, which is 0.
+  larl(scratch, &mvc_template);
+  SubP(length, Operand(static_cast<intptr_t>(0x1)));
+  ex(length, MemOperand(scratch));
+  la(src, MemOperand(src, length, 1));
+  la(dst, MemOperand(dst, length, 1));
+  LoadImmP(length, Operand::Zero());
+  b(&done);
 
+  bind(&mvc_template);
   mvc(MemOperand(dst), MemOperand(src), 1);
-  AddP(src, Operand(static_cast<intptr_t>(0x1)));
-  AddP(dst, Operand(static_cast<intptr_t>(0x1)));
-  SubP(length, Operand(static_cast<intptr_t>(0x1)));
 
-  b(&left_bytes);
   bind(&done);
 }
 
@@ -4536,6 +4532,138 @@ void MacroAssembler::CmpLogicalByte(const MemOperand& mem, const Operand& imm) {
     cliy(mem, imm);
 }
 
+bool MacroAssembler::CanUseCompareAndBranch(Label* l, Label::Distance dist) {
+  if (!CpuFeatures::IsSupported(GENERAL_INSTR_EXT)) return false;
+  // Mirrors branchOnCond: bound labels are checked against the actual offset,
+  // unbound ones are only assumed close when the caller says so.
+  if (l->is_bound()) return is_int16(l->pos() - pc_offset());
+  return dist == Label::kNear;
+}
+
+// Compare and Branch (Reg - Reg)
+void MacroAssembler::CmpAndBranch32(Condition cond, Register src1,
+                                    Register src2, Label* l,
+                                    Label::Distance dist) {
+  DCHECK(is_uint4(cond));
+  if (CanUseCompareAndBranch(l, dist)) {
+    crj(src1, src2, cond, Operand(branch_offset(l)));
+  } else {
+    Cmp32(src1, src2);
+    b(cond, l, dist);
+  }
+}
+
+// Compare Pointer Size and Branch (Reg - Reg)
+void MacroAssembler::CmpAndBranchP(Condition cond, Register src1,
+                                   Register src2, Label* l,
+                                   Label::Distance dist) {
+#if V8_TARGET_ARCH_S390X
+  DCHECK(is_uint4(cond));
+  if (CanUseCompareAndBranch(l, dist)) {
+    cgrj(src1, src2, cond, Operand(branch_offset(l)));
+  } else {
+    CmpP(src1, src2);
+    b(cond, l, dist);
+  }
+#else
+  CmpAndBranch32(cond, src1, src2, l, dist);
+#endif
+}
+
+// Compare and Branch (Reg - Imm)
+void MacroAssembler::CmpAndBranch32(Condition cond, Register src1,
+                                    const Operand& opnd, Label* l,
+                                    Label::Distance dist) {
+  DCHECK(is_uint4(cond));
+  if (opnd.rmode_ == kRelocInfo_NONEPTR && is_int8(opnd.immediate()) &&
+      CanUseCompareAndBranch(l, dist)) {
+    cij(src1, opnd, cond, Operand(branch_offset(l)));
+  } else {
+    Cmp32(src1, opnd);
+    b(cond, l, dist);
+  }
+}
+
+// Compare Pointer Size and Branch (Reg - Imm)
+void MacroAssembler::CmpAndBranchP(Condition cond, Register src1,
+                                   const Operand& opnd, Label* l,
+                                   Label::Distance dist) {
+#if V8_TARGET_ARCH_S390X
+  DCHECK(is_uint4(cond));
+  if (opnd.rmode_ == kRelocInfo_NONEPTR && is_int8(opnd.immediate()) &&
+      CanUseCompareAndBranch(l, dist)) {
+    cgij(src1, opnd, cond, Operand(branch_offset(l)));
+  } else {
+    CmpP(src1, opnd);
+    b(cond, l, dist);
+  }
+#else
+  CmpAndBranch32(cond, src1, opnd, l, dist);
+#endif
+}
+
+// Compare Logical and Branch (Reg - Reg)
+void MacroAssembler::CmpLogicalAndBranch32(Condition cond, Register src1,
+                                           Register src2, Label* l,
+                                           Label::Distance dist) {
+  DCHECK(is_uint4(cond));
+  if (CanUseCompareAndBranch(l, dist)) {
+    clrj(src1, src2, cond, Operand(branch_offset(l)));
+  } else {
+    CmpLogical32(src1, src2);
+    b(cond, l, dist);
+  }
+}
+
+// Compare Logical Pointer Size and Branch (Reg - Reg)
+void MacroAssembler::CmpLogicalAndBranchP(Condition cond, Register src1,
+                                          Register src2, Label* l,
+                                          Label::Distance dist) {
+#if V8_TARGET_ARCH_S390X
+  DCHECK(is_uint4(cond));
+  if (CanUseCompareAndBranch(l, dist)) {
+    clgrj(src1, src2, cond, Operand(branch_offset(l)));
+  } else {
+    CmpLogicalP(src1, src2);
+    b(cond, l, dist);
+  }
+#else
+  CmpLogicalAndBranch32(cond, src1, src2, l, dist);
+#endif
+}
+
+// Compare Logical and Branch (Reg - Imm)
+void MacroAssembler::CmpLogicalAndBranch32(Condition cond, Register src1,
+                                           const Operand& opnd, Label* l,
+                                           Label::Distance dist) {
+  DCHECK(is_uint4(cond));
+  if (opnd.rmode_ == kRelocInfo_NONEPTR && is_uint8(opnd.immediate()) &&
+      CanUseCompareAndBranch(l, dist)) {
+    clij(src1, opnd, cond, Operand(branch_offset(l)));
+  } else {
+    CmpLogical32(src1, opnd);
+    b(cond, l, dist);
+  }
+}
+
+// Compare Logical Pointer Size and Branch (Reg - Imm)
+void MacroAssembler::CmpLogicalAndBranchP(Condition cond, Register src1,
+                                          const Operand& opnd, Label* l,
+                                          Label::Distance dist) {
+#if V8_TARGET_ARCH_S390X
+  DCHECK(is_uint4(cond));
+  if (opnd.rmode_ == kRelocInfo_NONEPTR && is_uint8(opnd.immediate()) &&
+      CanUseCompareAndBranch(l, dist)) {
+    clgij(src1, opnd, cond, Operand(branch_offset(l)));
+  } else {
+    CmpLogicalP(src1, opnd);
+    b(cond, l, dist);
+  }
+#else
+  CmpLogicalAndBranch32(cond, src1, opnd, l, dist);
+#endif
+}
+
 void MacroAssembler::Branch(Condition c, const Operand& opnd) {
   intptr_t value = opnd.immediate();
   if (is_int16(value))
@@ -112,6 +112,7 @@ bool AreAliased(Register reg1, Register reg2, Register reg3 = no_reg,
 #define LoadRR lgr
 #define LoadAndTestRR ltgr
 #define LoadImmP lghi
+#define LoadOnConditionP locgr
 #define LoadLogicalHalfWordP llgh
 
 // Compare
@@ -150,6 +151,7 @@ bool AreAliased(Register reg1, Register reg2, Register reg3 = no_reg,
 #define LoadRR lr
 #define LoadAndTestRR ltr
 #define LoadImmP lhi
+#define LoadOnConditionP locr
 #define LoadLogicalHalfWordP llh
 
 // Compare
@@ -325,6 +327,28 @@ class MacroAssembler : public Assembler {
   // Compare Logical Byte (CLI/CLIY)
   void CmpLogicalByte(const MemOperand& mem, const Operand& imm);
 
+  // Compare and branch to |l| if |cond| holds. Targets within reach of the
+  // compare and branch relative instructions (bound labels in range, or
+  // kNear ones) use the fused form, which leaves the condition code
+  // untouched; so callers must not rely on the condition code afterwards.
+  void CmpAndBranch32(Condition cond, Register src1, Register src2, Label* l,
+                      Label::Distance dist = Label::kFar);
+  void CmpAndBranchP(Condition cond, Register src1, Register src2, Label* l,
+                     Label::Distance dist = Label::kFar);
+  void CmpAndBranch32(Condition cond, Register src1, const Operand& opnd,
+                      Label* l, Label::Distance dist = Label::kFar);
+  void CmpAndBranchP(Condition cond, Register src1, const Operand& opnd,
+                     Label* l, Label::Distance dist = Label::kFar);
+  void CmpLogicalAndBranch32(Condition cond, Register src1, Register src2,
+                             Label* l, Label::Distance dist = Label::kFar);
+  void CmpLogicalAndBranchP(Condition cond, Register src1, Register src2,
+                            Label* l, Label::Distance dist = Label::kFar);
+  void CmpLogicalAndBranch32(Condition cond, Register src1,
+                             const Operand& opnd, Label* l,
+                             Label::Distance dist = Label::kFar);
+  void CmpLogicalAndBranchP(Condition cond, Register src1, const Operand& opnd,
+                            Label* l, Label::Distance dist = Label::kFar);
+
   // Load 32bit
   void Load(Register dst, const MemOperand& opnd);
   void Load(Register dst, const Operand& opnd);
@@ -1767,6 +1791,10 @@ class MacroAssembler : public Assembler {
   void CallCFunctionHelper(Register function, int num_reg_arguments,
                            int num_double_arguments);
 
+  // Whether a branch to |l| fits the 16-bit halfword offset of the compare
+  // and branch relative instructions.
+  bool CanUseCompareAndBranch(Label* l, Label::Distance dist);
+
   void Jump(intptr_t target, RelocInfo::Mode rmode, Condition cond = al,
             CRegister cr = cr7);
 
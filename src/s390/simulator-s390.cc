@@ -4,14 +4,22 @@
 
 #include <stdarg.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #if V8_TARGET_ARCH_S390
 
 #include "src/assembler.h"
+#include "src/base/atomicops.h"
 #include "src/base/bits.h"
+#include "src/code-stubs.h"
 #include "src/codegen.h"
 #include "src/disasm.h"
+#include "src/frames.h"
 #include "src/runtime/runtime-utils.h"
 #include "src/s390/constants-s390.h"
 #include "src/s390/frames-s390.h"
@@ -750,6 +758,206 @@ void Simulator::Initialize(Isolate* isolate) {
                                                     &RedirectExternalReference);
 }
 
+// Counts executed instructions by opcode, and executed instructions, branches
+// and memory accesses by code object. Code objects are found by address, and
+// since code only moves during mark-compact the address index is rebuilt
+// after every mark-compact. Counts are kept by code name, so code that did
+// not move keeps its row.
+class Simulator::Profile {
+ public:
+  explicit Profile(Isolate* isolate)
+      : isolate_(isolate),
+        opcodes_(kNumOpcodes),
+        ms_count_(isolate->heap()->ms_count()),
+        current_start_(0),
+        current_end_(0),
+        current_(NULL),
+        instructions_(0) {}
+
+  ~Profile() {
+    for (size_t i = 0; i < codes_.size(); i++) delete codes_[i];
+  }
+
+  void Record(Instruction* instr, Opcode op, bool is_branch, bool taken,
+              uint32_t reads, uint32_t writes) {
+    OpcodeCounts* opcode = &opcodes_[op];
+    if (opcode->count++ == 0) {
+      memcpy(opcode->sample, instr, instr->InstructionLength());
+    }
+    CodeCounts* code = Lookup(reinterpret_cast<intptr_t>(instr));
+    code->instructions++;
+    if (is_branch) {
+      if (taken) {
+        code->taken++;
+      } else {
+        code->not_taken++;
+      }
+    }
+    code->reads += reads;
+    code->writes += writes;
+    instructions_++;
+  }
+
+  void Print(FILE* out);
+
+ private:
+  static const size_t kMaxPrintedCodes = 100;
+
+  struct OpcodeCounts {
+    OpcodeCounts() : count(0) { memset(sample, 0, sizeof(sample)); }
+    uint64_t count;
+    byte sample[sizeof(SixByteInstr)];  // First executed instance.
+  };
+
+  struct CodeCounts {
+    explicit CodeCounts(const std::string& name)
+        : name(name),
+          instructions(0),
+          taken(0),
+          not_taken(0),
+          reads(0),
+          writes(0) {}
+    std::string name;
+    uint64_t instructions;
+    uint64_t taken;
+    uint64_t not_taken;
+    uint64_t reads;
+    uint64_t writes;
+  };
+
+  struct CodeRange {
+    intptr_t end;
+    CodeCounts* counts;
+  };
+
+  CodeCounts* Lookup(intptr_t pc);
+  std::string CodeName(Code* code);
+  static bool MoreInstructions(const CodeCounts* a, const CodeCounts* b) {
+    return a->instructions > b->instructions;
+  }
+
+  Isolate* isolate_;
+  std::vector<OpcodeCounts> opcodes_;
+  std::vector<CodeCounts*> codes_;
+  std::map<std::string, CodeCounts*> counts_by_name_;
+  // Address ranges by start address, valid until the next mark-compact.
+  std::map<intptr_t, CodeRange> ranges_;
+  int ms_count_;
+  intptr_t current_start_;
+  intptr_t current_end_;
+  CodeCounts* current_;
+  uint64_t instructions_;
+};
+
+Simulator::Profile::CodeCounts* Simulator::Profile::Lookup(intptr_t pc) {
+  Heap* heap = isolate_->heap();
+  if (heap->ms_count() != ms_count_) {
+    ms_count_ = heap->ms_count();
+    ranges_.clear();
+    current_ = NULL;
+  }
+  if (current_ != NULL && current_start_ <= pc && pc < current_end_) {
+    return current_;
+  }
+  std::map<intptr_t, CodeRange>::iterator it = ranges_.upper_bound(pc);
+  if (it != ranges_.begin() && pc < (--it)->second.end) {
+    current_start_ = it->first;
+    current_end_ = it->second.end;
+    current_ = it->second.counts;
+    return current_;
+  }
+
+  // Redirected calls into the runtime execute outside the heap.
+  Address address = reinterpret_cast<Address>(pc);
+  Code* code = NULL;
+  if (heap->code_space()->ContainsSlow(address) ||
+      heap->lo_space()->FindPage(address) != NULL) {
+    code = isolate_->inner_pointer_to_code_cache()
+               ->GcSafeFindCodeForInnerPointer(address);
+  }
+  CodeRange range;
+  std::string name;
+  if (code != NULL) {
+    current_start_ = reinterpret_cast<intptr_t>(code->instruction_start());
+    range.end = reinterpret_cast<intptr_t>(code->instruction_end());
+    name = CodeName(code);
+  } else {
+    current_start_ = pc;
+    range.end = pc + sizeof(FourByteInstr);
+    name = "(external)";
+  }
+  CodeCounts*& counts = counts_by_name_[name];
+  if (counts == NULL) {
+    counts = new CodeCounts(name);
+    codes_.push_back(counts);
+  }
+  range.counts = counts;
+  ranges_[current_start_] = range;
+  current_end_ = range.end;
+  current_ = range.counts;
+  return current_;
+}
+
+std::string Simulator::Profile::CodeName(Code* code) {
+  std::ostringstream os;
+  os << Code::Kind2String(code->kind());
+  const char* builtin = isolate_->builtins()->Lookup(code->instruction_start());
+  if (builtin != NULL) {
+    os << " " << builtin;
+  } else if (code->kind() == Code::STUB) {
+    os << " " << CodeStub::MajorName(CodeStub::GetMajorKey(code));
+  } else if (code->kind() == Code::OPTIMIZED_FUNCTION) {
+    DeoptimizationInputData* data =
+        DeoptimizationInputData::cast(code->deoptimization_data());
+    if (data->length() > 0) {
+      SharedFunctionInfo* shared =
+          SharedFunctionInfo::cast(data->SharedFunctionInfo());
+      os << " " << shared->DebugName()->ToCString().get();
+    }
+  }
+  os << " " << static_cast<void*>(code->instruction_start());
+  return os.str();
+}
+
+void Simulator::Profile::Print(FILE* out) {
+  if (instructions_ == 0) return;
+  PrintF(out, "=== S390 simulator profile: %" PRIu64 " instructions\n",
+         instructions_);
+
+  std::vector<std::pair<uint64_t, int> > opcodes;
+  for (int i = 0; i < kNumOpcodes; i++) {
+    if (opcodes_[i].count > 0) {
+      opcodes.push_back(std::make_pair(opcodes_[i].count, i));
+    }
+  }
+  std::sort(opcodes.rbegin(), opcodes.rend());
+  disasm::NameConverter converter;
+  disasm::Disassembler dasm(converter);
+  EmbeddedVector<char, 256> buffer;
+  PrintF(out, "%-10s %14s %7s\n", "opcode", "count", "%");
+  for (size_t i = 0; i < opcodes.size(); i++) {
+    OpcodeCounts* counts = &opcodes_[opcodes[i].second];
+    dasm.InstructionDecode(buffer, counts->sample);
+    // Keep the mnemonic only.
+    buffer[static_cast<int>(strcspn(buffer.start(), " \t"))] = '\0';
+    PrintF(out, "%-10s %14" PRIu64 " %6.2f%%\n", buffer.start(),
+           counts->count, 100.0 * counts->count / instructions_);
+  }
+
+  std::vector<CodeCounts*> codes(codes_);
+  std::sort(codes.begin(), codes.end(), MoreInstructions);
+  if (codes.size() > kMaxPrintedCodes) codes.resize(kMaxPrintedCodes);
+  PrintF(out, "%14s %12s %12s %12s %12s  %s\n", "instructions", "taken",
+         "not taken", "reads", "writes", "code");
+  for (size_t i = 0; i < codes.size(); i++) {
+    CodeCounts* counts = codes[i];
+    PrintF(out, "%14" PRIu64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64
+           " %12" PRIu64 "  %s\n",
+           counts->instructions, counts->taken, counts->not_taken,
+           counts->reads, counts->writes, counts->name.c_str());
+  }
+}
+
 Simulator::Simulator(Isolate* isolate) : isolate_(isolate) {
   i_cache_ = isolate_->simulator_i_cache();
   if (i_cache_ == NULL) {
@@ -768,6 +976,10 @@ Simulator::Simulator(Isolate* isolate) : isolate_(isolate) {
   stack_ = reinterpret_cast<char*>(malloc(stack_size));
   pc_modified_ = false;
   icount_ = 0;
+  profile_ = FLAG_sim_profile ? new Profile(isolate) : NULL;
+  memory_reads_ = 0;
+  memory_writes_ = 0;
+  decode_handler_ = kNotDecoded;
   break_pc_ = NULL;
   break_instr_ = 0;
 
@@ -785,9 +997,10 @@ Simulator::Simulator(Isolate* isolate) : isolate_(isolate) {
   condition_reg_ = 0;
   special_reg_pc_ = 0;
 
-  // Initializing FP registers.
-  for (int i = 0; i < kNumFPRs; i++) {
-    fp_registers_[i] = 0.0;
+  // Initializing FP and vector registers.
+  for (int i = 0; i < kNumVRs; i++) {
+    vector_registers_[i].g[0] = 0;
+    vector_registers_[i].g[1] = 0;
   }
 
   // The sp is initialized to point to the bottom (high address) of the
@@ -800,7 +1013,17 @@ Simulator::Simulator(Isolate* isolate) : isolate_(isolate) {
   last_debugger_input_ = NULL;
 }
 
-Simulator::~Simulator() { free(stack_); }
+Simulator::~Simulator() {
+  if (profile_ != NULL) {
+    profile_->Print(stdout);
+    delete profile_;
+  }
+  free(stack_);
+}
+
+void Simulator::PrintProfile(FILE* out) {
+  if (profile_ != NULL) profile_->Print(out);
+}
 
 // When the generated code calls an external reference we need to catch that in
 // the simulator.  The external reference will be a function compiled for the
@@ -984,7 +1207,7 @@ double Simulator::get_double_from_register_pair(int reg) {
 #if 0 && !V8_TARGET_ARCH_S390X  // doesn't make sense in 64bit mode
   // Read the bits from the unsigned integer register_[] array
   // into the double precision floating point value and return it.
-  char buffer[sizeof(fp_registers_[0])];
+  char buffer[sizeof(vector_registers_[0].g[0])];
   memcpy(buffer, &registers_[reg], 2 * sizeof(registers_[0]));
   memcpy(&dm_val, buffer, 2 * sizeof(registers_[0]));
 #endif
@@ -1030,84 +1253,137 @@ void Simulator::TrashCallerSaveRegisters() {
 
 uint32_t Simulator::ReadWU(intptr_t addr, Instruction* instr) {
   uint32_t* ptr = reinterpret_cast<uint32_t*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
 int32_t Simulator::ReadW(intptr_t addr, Instruction* instr) {
   int32_t* ptr = reinterpret_cast<int32_t*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
 void Simulator::WriteW(intptr_t addr, uint32_t value, Instruction* instr) {
   uint32_t* ptr = reinterpret_cast<uint32_t*>(addr);
+  CountMemoryWrite();
   *ptr = value;
   return;
 }
 
 void Simulator::WriteW(intptr_t addr, int32_t value, Instruction* instr) {
   int32_t* ptr = reinterpret_cast<int32_t*>(addr);
+  CountMemoryWrite();
   *ptr = value;
   return;
 }
 
 uint16_t Simulator::ReadHU(intptr_t addr, Instruction* instr) {
   uint16_t* ptr = reinterpret_cast<uint16_t*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
 int16_t Simulator::ReadH(intptr_t addr, Instruction* instr) {
   int16_t* ptr = reinterpret_cast<int16_t*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
 void Simulator::WriteH(intptr_t addr, uint16_t value, Instruction* instr) {
   uint16_t* ptr = reinterpret_cast<uint16_t*>(addr);
+  CountMemoryWrite();
   *ptr = value;
   return;
 }
 
 void Simulator::WriteH(intptr_t addr, int16_t value, Instruction* instr) {
   int16_t* ptr = reinterpret_cast<int16_t*>(addr);
+  CountMemoryWrite();
   *ptr = value;
   return;
 }
 
 uint8_t Simulator::ReadBU(intptr_t addr) {
   uint8_t* ptr = reinterpret_cast<uint8_t*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
 int8_t Simulator::ReadB(intptr_t addr) {
   int8_t* ptr = reinterpret_cast<int8_t*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
 void Simulator::WriteB(intptr_t addr, uint8_t value) {
   uint8_t* ptr = reinterpret_cast<uint8_t*>(addr);
+  CountMemoryWrite();
   *ptr = value;
 }
 
 void Simulator::WriteB(intptr_t addr, int8_t value) {
   int8_t* ptr = reinterpret_cast<int8_t*>(addr);
+  CountMemoryWrite();
   *ptr = value;
 }
 
 int64_t Simulator::ReadDW(intptr_t addr) {
   int64_t* ptr = reinterpret_cast<int64_t*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
 void Simulator::WriteDW(intptr_t addr, int64_t value) {
   int64_t* ptr = reinterpret_cast<int64_t*>(addr);
+  CountMemoryWrite();
   *ptr = value;
   return;
 }
 
+void Simulator::CompareAndSwapWord(int r1, int r3, intptr_t addr) {
+  CountMemoryRead();
+  CountMemoryWrite();
+  int32_t expected = get_low_register<int32_t>(r1);
+  base::MemoryBarrier();
+  int32_t actual = base::NoBarrier_CompareAndSwap(
+      reinterpret_cast<volatile base::Atomic32*>(addr), expected,
+      get_low_register<int32_t>(r3));
+  base::MemoryBarrier();
+  if (actual == expected) {
+    condition_reg_ = CC_EQ;
+  } else {
+    set_low_register(r1, actual);
+    condition_reg_ = CC_LT;
+  }
+}
+
+void Simulator::CompareAndSwapDoubleWord(int r1, int r3, intptr_t addr) {
+#if V8_TARGET_ARCH_S390X
+  CountMemoryRead();
+  CountMemoryWrite();
+  int64_t expected = get_register(r1);
+  base::MemoryBarrier();
+  int64_t actual = base::NoBarrier_CompareAndSwap(
+      reinterpret_cast<volatile base::Atomic64*>(addr), expected,
+      get_register(r3));
+  base::MemoryBarrier();
+  if (actual == expected) {
+    condition_reg_ = CC_EQ;
+  } else {
+    set_register(r1, actual);
+    condition_reg_ = CC_LT;
+  }
+#else
+  UNIMPLEMENTED();
+#endif
+}
+
 /**
  * Reads a double value from memory at given address.
  */
 double Simulator::ReadDouble(intptr_t addr) {
   double* ptr = reinterpret_cast<double*>(addr);
+  CountMemoryRead();
   return *ptr;
 }
 
@@ -1667,6 +1943,7 @@ void Simulator::PrintStopInfo(uint32_t code) {
 
 // S390 Decode and simulate helpers
 bool Simulator::DecodeTwoByte(Instruction* instr) {
+  decode_handler_ = kDecodeTwoByte;
   Opcode op = instr->S390OpcodeValue();
 
   switch (op) {
@@ -1782,7 +2059,8 @@ bool Simulator::DecodeTwoByte(Instruction* instr) {
       RRInstruction* rrinst = reinterpret_cast<RRInstruction*>(instr);
       int r1 = rrinst->R1Value();
       int r2 = rrinst->R2Value();
-      if (TestConditionCode(Condition(r1))) {
+      // With r2 == 0 nothing is branched to; bcr 15,0 serializes.
+      if (r2 != 0 && TestConditionCode(Condition(r1))) {
         intptr_t r2_val = get_register(r2);
 #if (!V8_TARGET_ARCH_S390X && V8_HOST_ARCH_S390)
         // On 31-bit, the top most bit may be 0 or 1, but is ignored by the
@@ -1892,6 +2170,7 @@ bool Simulator::DecodeTwoByte(Instruction* instr) {
 
 // Decode routine for four-byte instructions
 bool Simulator::DecodeFourByte(Instruction* instr) {
+  decode_handler_ = kDecodeFourByte;
   Opcode op = instr->S390OpcodeValue();
 
   // Pre-cast instruction to various types
@@ -1919,6 +2198,26 @@ bool Simulator::DecodeFourByte(Instruction* instr) {
       set_register(r1, static_cast<uint64_t>(r1_val));
       break;
     }
+    case SRST: {
+      // Search String. Searches for the character in the low byte of r0
+      // from the address in r2 up to, but not including, the address in r1.
+      // Always runs to completion, so CC3 is never set.
+      int r1 = rreInst->R1Value();
+      int r2 = rreInst->R2Value();
+      uint8_t character = static_cast<uint8_t>(get_register(0));
+      intptr_t end = get_register(r1);
+      intptr_t addr = get_register(r2);
+      for (; addr != end; ++addr) {
+        if (ReadBU(addr) == character) break;
+      }
+      if (addr != end) {
+        set_register(r1, addr);
+        condition_reg_ = CC_LT;  // CC1: found.
+      } else {
+        condition_reg_ = CC_GT;  // CC2: not found.
+      }
+      break;
+    }
     case LLGFR: {
       int r1 = rreInst->R1Value();
       int r2 = rreInst->R2Value();
@@ -1973,6 +2272,22 @@ bool Simulator::DecodeFourByte(Instruction* instr) {
       set_register(rreInst->R1Value(), double_val);
       break;
     }
+    case LOCR:
+    case LOCGR: {
+      // Load On Condition (32/64). The condition code is left unchanged.
+      RRFInstruction* rrfInst = reinterpret_cast<RRFInstruction*>(instr);
+      int r1 = rrfInst->R1Value();
+      int r2 = rrfInst->R2Value();
+      int m3 = rrfInst->M3Value();
+      if (TestConditionCode(static_cast<Condition>(m3))) {
+        if (op == LOCR) {
+          set_low_register(r1, get_low_register<uint32_t>(r2));
+        } else {
+          set_register(r1, get_register(r2));
+        }
+      }
+      break;
+    }
     case LTGR: {
       // Load Register (64)
       int r1 = rreInst->R1Value();
@@ -2142,6 +2457,18 @@ bool Simulator::DecodeFourByte(Instruction* instr) {
       UNIMPLEMENTED();
       break;
     }
+    case CS: {
+      // Compare And Swap (32). Simulated threads share memory, so the
+      // access has to be atomic on the host as well.
+      RSInstruction* rsinstr = reinterpret_cast<RSInstruction*>(instr);
+      int r1 = rsinstr->R1Value();
+      int r3 = rsinstr->R3Value();
+      int b2 = rsinstr->B2Value();
+      intptr_t d2 = rsinstr->D2Value();
+      intptr_t b2_val = (b2 == 0) ? 0 : get_register(b2);
+      CompareAndSwapWord(r1, r3, b2_val + d2);
+      break;
+    }
     case STM:
     case LM: {
       // Store Multiple 32-bits.
@@ -2241,9 +2568,11 @@ bool Simulator::DecodeFourByte(Instruction* instr) {
         set_register(r1, addr);
       } else if (op == LD) {
         int64_t dbl_val = *reinterpret_cast<int64_t*>(addr);
+        CountMemoryRead();
         set_d_register(r1, dbl_val);
       } else if (op == LE) {
         float float_val = *reinterpret_cast<float*>(addr);
+        CountMemoryRead();
         set_d_register_from_float32(r1, float_val);
       }
       break;
@@ -2442,6 +2771,7 @@ bool Simulator::DecodeFourByte(Instruction* instr) {
  * Decodes and simulates four byte arithmetic instructions
  */
 bool Simulator::DecodeFourByteArithmetic(Instruction* instr) {
+  decode_handler_ = kDecodeFourByteArithmetic;
   Opcode op = instr->S390OpcodeValue();
 
   // Pre-cast instruction to various types
@@ -3325,6 +3655,7 @@ void Simulator::DecodeFourByteFloatingPointRound(Instruction* instr) {
  * Decodes and simulates four byte floating point instructions
  */
 bool Simulator::DecodeFourByteFloatingPoint(Instruction* instr) {
+  decode_handler_ = kDecodeFourByteFloatingPoint;
   Opcode op = instr->S390OpcodeValue();
 
   switch (op) {
@@ -3631,6 +3962,7 @@ bool Simulator::DecodeFourByteFloatingPoint(Instruction* instr) {
 
 // Decode routine for six-byte instructions
 bool Simulator::DecodeSixByte(Instruction* instr) {
+  decode_handler_ = kDecodeSixByte;
   Opcode op = instr->S390OpcodeValue();
 
   // Pre-cast instruction to various types
@@ -3686,6 +4018,7 @@ bool Simulator::DecodeSixByte(Instruction* instr) {
       int64_t rx_val = (rx == 0) ? 0 : get_register(rx);
       double ret = static_cast<double>(
           *reinterpret_cast<float*>(rx_val + rb_val + offset));
+      CountMemoryRead();
       set_d_register_from_double(r1, ret);
       break;
     }
@@ -4049,12 +4382,14 @@ bool Simulator::DecodeSixByte(Instruction* instr) {
         set_register(r1, mem_val);
       } else if (op == LDY) {
         uint64_t dbl_val = *reinterpret_cast<uint64_t*>(addr);
+        CountMemoryRead();
         set_d_register(r1, dbl_val);
       } else if (op == STEY) {
         int64_t frs_val = get_d_register(r1) >> 32;
         WriteW(addr, static_cast<int32_t>(frs_val), instr);
       } else if (op == LEY) {
         float float_val = *reinterpret_cast<float*>(addr);
+        CountMemoryRead();
         set_d_register_from_float32(r1, float_val);
       } else if (op == STY) {
         uint32_t value = get_low_register<uint32_t>(r1);
@@ -4094,6 +4429,58 @@ bool Simulator::DecodeSixByte(Instruction* instr) {
       }
       break;
     }
+    case CLC: {
+      // Compare Logical (character)
+      int b1 = ssInstr->B1Value();
+      intptr_t d1 = ssInstr->D1Value();
+      int b2 = ssInstr->B2Value();
+      intptr_t d2 = ssInstr->D2Value();
+      int length = ssInstr->Length();
+      int64_t b1_val = (b1 == 0) ? 0 : get_register(b1);
+      int64_t b2_val = (b2 == 0) ? 0 : get_register(b2);
+      intptr_t addr1 = b1_val + d1;
+      intptr_t addr2 = b2_val + d2;
+      // The operands are compared left to right as unsigned bytes, and the
+      // first difference decides. Length is the actual length - 1.
+      SetS390ConditionCode<uint8_t>(0, 0);
+      for (int i = 0; i < length + 1; ++i) {
+        uint8_t byte1 = ReadBU(addr1 + i);
+        uint8_t byte2 = ReadBU(addr2 + i);
+        if (byte1 != byte2) {
+          SetS390ConditionCode<uint8_t>(byte1, byte2);
+          break;
+        }
+      }
+      break;
+    }
+    case TRT: {
+      // Translate And Test: the bytes of the first operand index the 256
+      // byte function table at the second operand, stopping at the first
+      // nonzero function byte. Its address goes to r1 and the function byte
+      // to the low byte of r2.
+      int b1 = ssInstr->B1Value();
+      intptr_t d1 = ssInstr->D1Value();
+      int b2 = ssInstr->B2Value();
+      intptr_t d2 = ssInstr->D2Value();
+      int length = ssInstr->Length();
+      int64_t b1_val = (b1 == 0) ? 0 : get_register(b1);
+      int64_t b2_val = (b2 == 0) ? 0 : get_register(b2);
+      intptr_t addr1 = b1_val + d1;
+      intptr_t addr2 = b2_val + d2;
+      // CC0: All function bytes zero
+      condition_reg_ = CC_EQ;
+      for (int i = 0; i < length + 1; ++i) {
+        uint8_t function_byte = ReadBU(addr2 + ReadBU(addr1 + i));
+        if (function_byte != 0) {
+          set_register(r1, addr1 + i);
+          set_register(r2, (get_register(r2) & ~0xff) | function_byte);
+          // CC1: Nonzero found before the last byte, CC2: at the last byte
+          condition_reg_ = (i < length) ? CC_LT : CC_GT;
+          break;
+        }
+      }
+      break;
+    }
     case MVHI: {
       // Move Integer (32)
       int b1 = silInstr->B1Value();
@@ -4171,6 +4558,146 @@ bool Simulator::DecodeSixByte(Instruction* instr) {
       SetS390BitWiseConditionCode<uint32_t>(alu_out);
       break;
     }
+    case CRJ:
+    case CGRJ:
+    case CLRJ:
+    case CLGRJ:
+    case CIJ:
+    case CGIJ:
+    case CLIJ:
+    case CLGIJ: {
+      // Compare And Branch Relative. The condition code is left unchanged.
+      int r1 = rieInstr->R1Value();
+      int m3;
+      int64_t lhs, rhs;
+      bool is_logical = (op == CLRJ || op == CLGRJ || op == CLIJ ||
+                         op == CLGIJ);
+      bool is_64 = (op == CGRJ || op == CLGRJ || op == CGIJ || op == CLGIJ);
+      if (op == CRJ || op == CGRJ || op == CLRJ || op == CLGRJ) {
+        // RIE-b: M3 is in bits 32-35, R2 in bits 12-15.
+        int r2 = rieInstr->R2Value();
+        m3 = rieInstr->I5Value() >> 4;
+        rhs = is_64 ? get_register(r2)
+                    : (is_logical ? get_low_register<uint32_t>(r2)
+                                  : get_low_register<int32_t>(r2));
+      } else {
+        // RIE-c: M3 is in bits 12-15, I2 in bits 32-39.
+        m3 = rieInstr->R2Value();
+        uint8_t i2 = static_cast<uint8_t>(rieInstr->I5Value());
+        rhs = is_logical ? static_cast<int64_t>(i2)
+                         : static_cast<int64_t>(static_cast<int8_t>(i2));
+      }
+      if (is_64) {
+        lhs = get_register(r1);
+      } else {
+        lhs = is_logical ? get_low_register<uint32_t>(r1)
+                         : get_low_register<int32_t>(r1);
+      }
+      int cc;
+      if (is_logical && is_64) {
+        uint64_t ulhs = static_cast<uint64_t>(lhs);
+        uint64_t urhs = static_cast<uint64_t>(rhs);
+        cc = (ulhs == urhs) ? CC_EQ : (ulhs < urhs) ? CC_LT : CC_GT;
+      } else {
+        // 32-bit operands were zero or sign extended above.
+        cc = (lhs == rhs) ? CC_EQ : (lhs < rhs) ? CC_LT : CC_GT;
+      }
+      if ((cc & m3) != 0) {
+        intptr_t offset = rieInstr->I6Value() * 2;
+        set_pc(get_pc() + offset);
+      }
+      break;
+    }
+    case CSY:
+    case CSG: {
+      // Compare And Swap (32/64).
+      int r1 = rsyInstr->R1Value();
+      int r3 = rsyInstr->R3Value();
+      int b2 = rsyInstr->B2Value();
+      intptr_t d2 = rsyInstr->D2Value();
+      intptr_t b2_val = (b2 == 0) ? 0 : get_register(b2);
+      if (op == CSY) {
+        CompareAndSwapWord(r1, r3, b2_val + d2);
+      } else {
+        CompareAndSwapDoubleWord(r1, r3, b2_val + d2);
+      }
+      break;
+    }
+    case LAA:
+    case LAN:
+    case LAO:
+    case LAX: {
+      // Load And Add/And/Or/Exclusive Or (32). r1 receives the previous
+      // value of the memory location, which is updated with the result of
+      // combining it with r3.
+      int r1 = rsyInstr->R1Value();
+      int r3 = rsyInstr->R3Value();
+      int b2 = rsyInstr->B2Value();
+      intptr_t d2 = rsyInstr->D2Value();
+      intptr_t b2_val = (b2 == 0) ? 0 : get_register(b2);
+      volatile base::Atomic32* addr =
+          reinterpret_cast<volatile base::Atomic32*>(b2_val + d2);
+      int32_t r3_val = get_low_register<int32_t>(r3);
+      int32_t old_val;
+      int32_t new_val;
+      CountMemoryRead();
+      CountMemoryWrite();
+      do {
+        old_val = base::NoBarrier_Load(addr);
+        switch (op) {
+          case LAA:
+            new_val = static_cast<int32_t>(static_cast<uint32_t>(old_val) +
+                                           static_cast<uint32_t>(r3_val));
+            break;
+          case LAN:
+            new_val = old_val & r3_val;
+            break;
+          case LAO:
+            new_val = old_val | r3_val;
+            break;
+          default:
+            new_val = old_val ^ r3_val;
+            break;
+        }
+        base::MemoryBarrier();
+      } while (base::NoBarrier_CompareAndSwap(addr, old_val, new_val) !=
+               old_val);
+      base::MemoryBarrier();
+      set_low_register(r1, old_val);
+      if (op == LAA) {
+        bool isOF = CheckOverflowForIntAdd(old_val, r3_val);
+        SetS390ConditionCode<int32_t>(new_val, 0);
+        SetS390OverflowCode(isOF);
+      } else {
+        SetS390BitWiseConditionCode<uint32_t>(new_val);
+      }
+      break;
+    }
+    case LOC:
+    case LOCG:
+    case STOC:
+    case STOCG: {
+      // Load/Store On Condition (32/64). The condition code is left
+      // unchanged, and memory is only accessed if the condition holds.
+      int r1 = rsyInstr->R1Value();
+      int m3 = rsyInstr->R3Value();
+      int b2 = rsyInstr->B2Value();
+      intptr_t d2 = rsyInstr->D2Value();
+      if (TestConditionCode(static_cast<Condition>(m3))) {
+        intptr_t b2_val = (b2 == 0) ? 0 : get_register(b2);
+        intptr_t addr = b2_val + d2;
+        if (op == LOC) {
+          set_low_register(r1, ReadW(addr, instr));
+        } else if (op == LOCG) {
+          set_register(r1, ReadDW(addr));
+        } else if (op == STOC) {
+          WriteW(addr, get_low_register<uint32_t>(r1), instr);
+        } else {
+          WriteDW(addr, get_register(r1));
+        }
+      }
+      break;
+    }
     case RISBG: {
       // Rotate then insert selected bits
       int r1 = rieInstr->R1Value();
@@ -4211,6 +4738,28 @@ bool Simulator::DecodeSixByte(Instruction* instr) {
       set_register(r1, selected_val);
       break;
     }
+    case VA:
+    case VCEQ:
+    case VFAE:
+    case VFEE:
+    case VFENE:
+    case VGBM:
+    case VISTR:
+    case VL:
+    case VLGV:
+    case VLL:
+    case VLR:
+    case VLREP:
+    case VLVG:
+    case VN:
+    case VO:
+    case VREP:
+    case VREPI:
+    case VS:
+    case VST:
+    case VSTL:
+    case VX:
+      return DecodeSixByteVector(instr);
     default:
       return DecodeSixByteArithmetic(instr);
   }
@@ -4221,6 +4770,7 @@ bool Simulator::DecodeSixByte(Instruction* instr) {
  * Decodes and simulates six byte arithmetic instructions
  */
 bool Simulator::DecodeSixByteArithmetic(Instruction* instr) {
+  decode_handler_ = kDecodeSixByteArithmetic;
   Opcode op = instr->S390OpcodeValue();
 
   // Pre-cast instruction to various types
@@ -4674,6 +5224,321 @@ bool Simulator::DecodeSixByteArithmetic(Instruction* instr) {
   return true;
 }
 
+uint64_t Simulator::get_vector_element(const VectorRegisterValue& vr, int size,
+                                       int index) {
+  switch (size) {
+    case kVectorByte:
+      DCHECK(index >= 0 && index < 16);
+      return vr.b[index];
+    case kVectorHalfword:
+      DCHECK(index >= 0 && index < 8);
+      return vr.h[index];
+    case kVectorWord:
+      DCHECK(index >= 0 && index < 4);
+      return vr.f[index];
+    case kVectorDoubleword:
+      DCHECK(index >= 0 && index < 2);
+      return vr.g[index];
+    default:
+      UNIMPLEMENTED();
+      return 0;
+  }
+}
+
+void Simulator::set_vector_element(VectorRegisterValue* vr, int size,
+                                   int index, uint64_t value) {
+  switch (size) {
+    case kVectorByte:
+      DCHECK(index >= 0 && index < 16);
+      vr->b[index] = static_cast<uint8_t>(value);
+      break;
+    case kVectorHalfword:
+      DCHECK(index >= 0 && index < 8);
+      vr->h[index] = static_cast<uint16_t>(value);
+      break;
+    case kVectorWord:
+      DCHECK(index >= 0 && index < 4);
+      vr->f[index] = static_cast<uint32_t>(value);
+      break;
+    case kVectorDoubleword:
+      DCHECK(index >= 0 && index < 2);
+      vr->g[index] = value;
+      break;
+    default:
+      UNIMPLEMENTED();
+      break;
+  }
+}
+
+/**
+ * Decodes and simulates six byte vector instructions
+ */
+bool Simulator::DecodeSixByteVector(Instruction* instr) {
+  decode_handler_ = kDecodeSixByteVector;
+  Opcode op = instr->S390OpcodeValue();
+  VectorInstruction* vInstr = reinterpret_cast<VectorInstruction*>(instr);
+
+  // Operand fields, by position. Their meaning depends on the format.
+  int v1 = vInstr->V1Value();
+  int v2 = vInstr->V2Value();
+  int v3 = vInstr->V3Value();
+  int x2 = vInstr->X2Value();
+  int b2 = vInstr->B2Value();
+  int d2 = vInstr->D2Value();
+  int64_t b2_val = (b2 == 0) ? 0 : get_register(b2);
+
+  VectorRegisterValue result = {{0}};
+
+  switch (op) {
+    case VL:
+    case VST: {
+      // VRX format: V1,D2(X2,B2)
+      int64_t x2_val = (x2 == 0) ? 0 : get_register(x2);
+      void* addr = reinterpret_cast<void*>(b2_val + x2_val + d2);
+      if (op == VL) {
+        memcpy(&vector_registers_[v1], addr, kSimd128Size);
+        CountMemoryRead();
+      } else {
+        memcpy(addr, &vector_registers_[v1], kSimd128Size);
+        CountMemoryWrite();
+      }
+      return true;
+    }
+    case VLL:
+    case VSTL: {
+      // VRS-b format: V1,R3,D2(B2). Bytes 0 to min(R3, 15) are accessed, the
+      // remaining bytes are zeroed by VLL.
+      int r3 = vInstr->R2Value();
+      uint32_t r3_val = get_low_register<uint32_t>(r3);
+      size_t length = (r3_val >= 15) ? 16 : r3_val + 1;
+      void* addr = reinterpret_cast<void*>(b2_val + d2);
+      if (op == VLL) {
+        memcpy(&result, addr, length);
+        CountMemoryRead();
+        vector_registers_[v1] = result;
+      } else {
+        memcpy(addr, &vector_registers_[v1], length);
+        CountMemoryWrite();
+      }
+      return true;
+    }
+    case VLREP: {
+      // VRX format: V1,D2(X2,B2),M3
+      int size = vInstr->M32Value();
+      int64_t x2_val = (x2 == 0) ? 0 : get_register(x2);
+      intptr_t addr = b2_val + x2_val + d2;
+      uint64_t value;
+      switch (size) {
+        case kVectorByte:
+          value = ReadBU(addr);
+          break;
+        case kVectorHalfword:
+          value = ReadHU(addr, instr);
+          break;
+        case kVectorWord:
+          value = ReadWU(addr, instr);
+          break;
+        default:
+          value = ReadDW(addr);
+          break;
+      }
+      for (int i = 0; i < (kSimd128Size >> size); i++) {
+        set_vector_element(&result, size, i, value);
+      }
+      vector_registers_[v1] = result;
+      return true;
+    }
+    case VLR:
+      // VRR-a format: V1,V2
+      vector_registers_[v1] = vector_registers_[v2];
+      return true;
+    case VGBM: {
+      // VRI-a format: V1,I2. Byte i is all ones if bit i of I2 is one.
+      uint16_t i2 = vInstr->I2Value();
+      for (int i = 0; i < kSimd128Size; i++) {
+        result.b[i] = (i2 & (0x8000 >> i)) ? 0xFF : 0;
+      }
+      vector_registers_[v1] = result;
+      return true;
+    }
+    case VLGV: {
+      // VRS-c format: R1,V3,D2(B2),M4. The element index is the address.
+      int r1 = vInstr->R1Value();
+      int size = vInstr->M32Value();
+      int index = static_cast<int>(b2_val + d2);
+      set_register(r1, get_vector_element(vector_registers_[v2], size, index));
+      return true;
+    }
+    case VLVG: {
+      // VRS-b format: V1,R3,D2(B2),M4. The element index is the address.
+      int r3 = vInstr->R2Value();
+      int size = vInstr->M32Value();
+      int index = static_cast<int>(b2_val + d2);
+      set_vector_element(&vector_registers_[v1], size, index,
+                         get_register(r3));
+      return true;
+    }
+    case VREP:
+    case VREPI: {
+      // VREP is VRI-c format: V1,V3,I2,M4 and VREPI is VRI-a format: V1,I2,M3.
+      int size = vInstr->M32Value();
+      uint64_t value;
+      if (op == VREP) {
+        value = get_vector_element(vector_registers_[v2], size,
+                                   vInstr->I2Value());
+      } else {
+        value = static_cast<int16_t>(vInstr->I2Value());
+      }
+      for (int i = 0; i < (kSimd128Size >> size); i++) {
+        set_vector_element(&result, size, i, value);
+      }
+      vector_registers_[v1] = result;
+      return true;
+    }
+    case VA:
+    case VS:
+    case VCEQ: {
+      // VA and VS are VRR-c format: V1,V2,V3,M4. VCEQ is VRR-b format:
+      // V1,V2,V3,M4,M5.
+      int size = vInstr->M32Value();
+      int count = kSimd128Size >> size;
+      int equal = 0;
+      for (int i = 0; i < count; i++) {
+        uint64_t lhs = get_vector_element(vector_registers_[v2], size, i);
+        uint64_t rhs = get_vector_element(vector_registers_[v3], size, i);
+        uint64_t value;
+        if (op == VA) {
+          value = lhs + rhs;
+        } else if (op == VS) {
+          value = lhs - rhs;
+        } else if (lhs == rhs) {
+          value = static_cast<uint64_t>(-1);
+          equal++;
+        } else {
+          value = 0;
+        }
+        set_vector_element(&result, size, i, value);
+      }
+      vector_registers_[v1] = result;
+      if (op == VCEQ && (vInstr->M24Value() & kVectorStringCS)) {
+        // CC0: All elements equal
+        // CC1: Some elements equal
+        // CC3: No element equal
+        if (equal == count) {
+          condition_reg_ = CC_EQ;
+        } else if (equal > 0) {
+          condition_reg_ = 0x4;
+        } else {
+          condition_reg_ = 0x1;
+        }
+      }
+      return true;
+    }
+    case VN:
+    case VO:
+    case VX: {
+      // VRR-c format: V1,V2,V3
+      for (int i = 0; i < 2; i++) {
+        uint64_t lhs = vector_registers_[v2].g[i];
+        uint64_t rhs = vector_registers_[v3].g[i];
+        if (op == VN) {
+          result.g[i] = lhs & rhs;
+        } else if (op == VO) {
+          result.g[i] = lhs | rhs;
+        } else {
+          result.g[i] = lhs ^ rhs;
+        }
+      }
+      vector_registers_[v1] = result;
+      return true;
+    }
+    case VFAE:
+    case VFEE:
+    case VFENE: {
+      // VRR-b format: V1,V2,V3,M4,M5
+      int size = vInstr->M32Value();
+      int flags = vInstr->M24Value();
+      int count = kSimd128Size >> size;
+      int match = count;
+      int zero = count;
+      uint64_t mismatch_lhs = 0;
+      uint64_t mismatch_rhs = 0;
+      for (int i = 0; i < count; i++) {
+        uint64_t lhs = get_vector_element(vector_registers_[v2], size, i);
+        bool matched;
+        if (op == VFAE) {
+          matched = false;
+          for (int j = 0; j < count; j++) {
+            if (lhs == get_vector_element(vector_registers_[v3], size, j)) {
+              matched = true;
+              break;
+            }
+          }
+          if (flags & kVectorStringIN) matched = !matched;
+          if (flags & kVectorStringRT) {
+            set_vector_element(&result, size, i,
+                               matched ? static_cast<uint64_t>(-1) : 0);
+          }
+        } else {
+          uint64_t rhs = get_vector_element(vector_registers_[v3], size, i);
+          matched = (op == VFEE) ? (lhs == rhs) : (lhs != rhs);
+          if (matched && match == count) {
+            mismatch_lhs = lhs;
+            mismatch_rhs = rhs;
+          }
+        }
+        if (matched && match == count) match = i;
+        if (lhs == 0 && zero == count) zero = i;
+      }
+      if (!(flags & kVectorStringZS)) zero = count;
+      if (op != VFAE || !(flags & kVectorStringRT)) {
+        // The byte index of the first match, or 16 if there is none, is
+        // stored in byte element 7.
+        result.b[7] = std::min(match, zero) << size;
+      }
+      vector_registers_[v1] = result;
+      if (flags & kVectorStringCS) {
+        // CC0: A zero element precedes any match
+        // CC1: Match found (VFENE: the element of V2 is lower)
+        // CC2: VFENE: Mismatch found and the element of V2 is higher
+        // CC3: No match
+        if (zero < match) {
+          condition_reg_ = CC_EQ;
+        } else if (match == count) {
+          condition_reg_ = 0x1;
+        } else if (op == VFENE && mismatch_lhs > mismatch_rhs) {
+          condition_reg_ = 0x2;
+        } else {
+          condition_reg_ = 0x4;
+        }
+      }
+      return true;
+    }
+    case VISTR: {
+      // VRR-a format: V1,V2,M3,M5. Elements following the first zero element
+      // are zeroed.
+      int size = vInstr->M32Value();
+      int count = kSimd128Size >> size;
+      bool zero_found = false;
+      for (int i = 0; i < count && !zero_found; i++) {
+        uint64_t value = get_vector_element(vector_registers_[v2], size, i);
+        zero_found = (value == 0);
+        set_vector_element(&result, size, i, value);
+      }
+      vector_registers_[v1] = result;
+      if (vInstr->M24Value() & kVectorStringCS) {
+        // CC0: Zero element found
+        // CC3: No zero element
+        condition_reg_ = zero_found ? CC_EQ : 0x1;
+      }
+      return true;
+    }
+    default:
+      UNREACHABLE();
+      return false;
+  }
+}
+
 int16_t Simulator::ByteReverse(int16_t hword) {
   return (hword << 8) | ((hword >> 8) & 0x00ff);
 }
@@ -4686,6 +5551,56 @@ int32_t Simulator::ByteReverse(int32_t word) {
   return result;
 }
 
+const Simulator::DecodeFunction
+    Simulator::kDecodeFunctions[kNumDecodeHandlers] = {
+        NULL,
+        &Simulator::DecodeTwoByte,
+        &Simulator::DecodeFourByte,
+        &Simulator::DecodeFourByteArithmetic,
+        &Simulator::DecodeFourByteFloatingPoint,
+        &Simulator::DecodeSixByte,
+        &Simulator::DecodeSixByteArithmetic,
+        &Simulator::DecodeSixByteVector,
+};
+
+base::Atomic8 Simulator::decode_handlers_[kNumOpcodes];
+
+void Simulator::RecordProfile(Instruction* instr) {
+  Opcode op = instr->S390OpcodeValue();
+  bool is_branch;
+  switch (op) {
+    case BASR:
+    case BRAS:
+    case BRASL:
+    case BRC:
+    case BRCL:
+    case BRCT:
+    case BRCTG:
+    case BXH:
+    case CGIJ:
+    case CGRJ:
+    case CIJ:
+    case CLGIJ:
+    case CLGRJ:
+    case CLIJ:
+    case CLRJ:
+    case CRJ:
+      is_branch = true;
+      break;
+    case BCR:
+      // BCR with R2 = 0 only serializes.
+      is_branch = reinterpret_cast<RRInstruction*>(instr)->R2Value() != 0;
+      break;
+    default:
+      is_branch = false;
+      break;
+  }
+  profile_->Record(instr, op, is_branch, pc_modified_, memory_reads_,
+                   memory_writes_);
+  memory_reads_ = 0;
+  memory_writes_ = 0;
+}
+
 // Executes the current instruction.
 void Simulator::ExecuteInstruction(Instruction* instr, bool auto_incr_pc) {
   if (v8::internal::FLAG_check_icache) {
@@ -4714,14 +5629,32 @@ void Simulator::ExecuteInstruction(Instruction* instr, bool auto_incr_pc) {
   bool processed = true;
 
   int instrLength = instr->InstructionLength();
-  if (instrLength == 2)
-    processed = DecodeTwoByte(instr);
-  else if (instrLength == 4)
-    processed = DecodeFourByte(instr);
-  else if (instrLength == 6)
-    processed = DecodeSixByte(instr);
+  // EXECUTE and calls into the runtime run nested instructions, which must
+  // not clobber the decoder recorded for this one.
+  DecodeHandler outer_handler = decode_handler_;
+  Opcode op = instr->S390OpcodeValue();
+  base::Atomic8 handler = base::NoBarrier_Load(&decode_handlers_[op]);
+  if (handler != kNotDecoded) {
+    processed = (this->*kDecodeFunctions[static_cast<int>(handler)])(instr);
+  } else {
+    decode_handler_ = kNotDecoded;
+    if (instrLength == 2)
+      processed = DecodeTwoByte(instr);
+    else if (instrLength == 4)
+      processed = DecodeFourByte(instr);
+    else if (instrLength == 6)
+      processed = DecodeSixByte(instr);
+
+    // The runtime may have patched the instruction while it executed.
+    if (processed && instr->S390OpcodeValue() == op) {
+      base::NoBarrier_Store(&decode_handlers_[op],
+                            static_cast<base::Atomic8>(decode_handler_));
+    }
+  }
+  decode_handler_ = outer_handler;
 
   if (processed) {
+    if (profile_ != NULL && auto_incr_pc) RecordProfile(instr);
     if (!pc_modified_ && auto_incr_pc) {
       set_pc(reinterpret_cast<intptr_t>(instr) + instrLength);
     }
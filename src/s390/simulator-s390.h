@@ -64,6 +64,7 @@ class SimulatorStack : public v8::internal::AllStatic {
 // Running with a simulator.
 
 #include "src/assembler.h"
+#include "src/base/atomicops.h"
 #include "src/hashmap.h"
 #include "src/s390/constants-s390.h"
 
@@ -139,7 +140,8 @@ class Simulator {
     d13,
     d14,
     d15,
-    kNumFPRs = 16
+    kNumFPRs = 16,
+    kNumVRs = 32
   };
 
   explicit Simulator(Isolate* isolate);
@@ -162,20 +164,20 @@ class Simulator {
   double get_double_from_register_pair(int reg);
   void set_d_register_from_double(int dreg, const double dbl) {
     DCHECK(dreg >= 0 && dreg < kNumFPRs);
-    *bit_cast<double*>(&fp_registers_[dreg]) = dbl;
+    *bit_cast<double*>(&vector_registers_[dreg].g[0]) = dbl;
   }
 
   double get_double_from_d_register(int dreg) {
     DCHECK(dreg >= 0 && dreg < kNumFPRs);
-    return *bit_cast<double*>(&fp_registers_[dreg]);
+    return *bit_cast<double*>(&vector_registers_[dreg].g[0]);
   }
   void set_d_register(int dreg, int64_t value) {
     DCHECK(dreg >= 0 && dreg < kNumFPRs);
-    fp_registers_[dreg] = value;
+    vector_registers_[dreg].g[0] = value;
   }
   int64_t get_d_register(int dreg) {
     DCHECK(dreg >= 0 && dreg < kNumFPRs);
-    return fp_registers_[dreg];
+    return vector_registers_[dreg].g[0];
   }
 
   void set_d_register_from_float32(int dreg, const float f) {
@@ -202,6 +204,12 @@ class Simulator {
     return reinterpret_cast<Address>(static_cast<intptr_t>(get_register(sp)));
   }
 
+  // Number of instructions executed so far.
+  int64_t icount() const { return icount_; }
+
+  // Prints the --sim-profile execution profile gathered so far.
+  void PrintProfile(FILE* out);
+
   // Accessor to the internal simulator stack area.
   uintptr_t StackLimit(uintptr_t c_limit) const;
 
@@ -304,6 +312,11 @@ class Simulator {
   inline double ReadDouble(intptr_t addr);
   inline void WriteDW(intptr_t addr, int64_t value);
 
+  // Compare And Swap: atomically replaces the value at addr with r3 if it
+  // equals r1 (CC0), otherwise loads it into r1 (CC1).
+  void CompareAndSwapWord(int r1, int r3, intptr_t addr);
+  void CompareAndSwapDoubleWord(int r1, int r3, intptr_t addr);
+
   // S390
   void Trace(Instruction* instr);
   bool DecodeTwoByte(Instruction* instr);
@@ -315,8 +328,31 @@ class Simulator {
 
   bool DecodeSixByte(Instruction* instr);
   bool DecodeSixByteArithmetic(Instruction* instr);
+  bool DecodeSixByteVector(Instruction* instr);
   bool S390InstructionDecode(Instruction* instr);
 
+  // Decoders that can be cached for an opcode. Each one records itself in
+  // decode_handler_ on entry, so after decoding, decode_handler_ holds the
+  // innermost decoder that simulated the instruction.
+  enum DecodeHandler {
+    kNotDecoded = 0,
+    kDecodeTwoByte,
+    kDecodeFourByte,
+    kDecodeFourByteArithmetic,
+    kDecodeFourByteFloatingPoint,
+    kDecodeSixByte,
+    kDecodeSixByteArithmetic,
+    kDecodeSixByteVector,
+    kNumDecodeHandlers
+  };
+  typedef bool (Simulator::*DecodeFunction)(Instruction* instr);
+  static const DecodeFunction kDecodeFunctions[kNumDecodeHandlers];
+  // The DecodeHandler of every opcode executed so far, or kNotDecoded. The
+  // decoder only depends on the opcode, so the table is shared by all
+  // simulators; they may fill it concurrently, always with the same value.
+  static const int kNumOpcodes = 1 << 16;
+  static base::Atomic8 decode_handlers_[kNumOpcodes];
+
   template <typename T>
   void SetS390ConditionCode(T lhs, T rhs) {
     condition_reg_ = 0;
@@ -364,6 +400,17 @@ class Simulator {
   // Executes one instruction.
   void ExecuteInstruction(Instruction* instr, bool auto_incr_pc = true);
 
+  // Execution profile, gathered with --sim-profile.
+  class Profile;
+  void RecordProfile(Instruction* instr);
+  // Memory accesses are only counted for the profile.
+  void CountMemoryRead() {
+    if (profile_ != NULL) memory_reads_++;
+  }
+  void CountMemoryWrite() {
+    if (profile_ != NULL) memory_writes_++;
+  }
+
   // ICache.
   static void CheckICache(v8::internal::HashMap* i_cache, Instruction* instr);
   static void FlushOnePage(v8::internal::HashMap* i_cache, intptr_t start,
@@ -386,7 +433,23 @@ class Simulator {
   // On z9 and higher and supported Linux on z Systems platforms, all registers
   // are 64-bit, even in 31-bit mode.
   uint64_t registers_[kNumGPRs];
-  int64_t fp_registers_[kNumFPRs];
+
+  // Vector registers of the vector facility. The FP registers are the leftmost
+  // doublewords of v0-v15. Elements are indexed from the left and, like all
+  // data the simulator keeps in memory, held in host byte order.
+  union VectorRegisterValue {
+    uint8_t b[16];
+    uint16_t h[8];
+    uint32_t f[4];
+    uint64_t g[2];
+  };
+  VectorRegisterValue vector_registers_[kNumVRs];
+
+  // Element access for the VectorElementSize |size|.
+  uint64_t get_vector_element(const VectorRegisterValue& vr, int size,
+                              int index);
+  void set_vector_element(VectorRegisterValue* vr, int size, int index,
+                          uint64_t value);
 
   // Condition Code register. In S390, the last 4 bits are used.
   int32_t condition_reg_;
@@ -399,12 +462,20 @@ class Simulator {
   bool pc_modified_;
   int64_t icount_;
 
+  // Execution profile, and the memory accesses made by the instruction being
+  // executed.
+  Profile* profile_;
+  uint32_t memory_reads_;
+  uint32_t memory_writes_;
+
   // Debugger input.
   char* last_debugger_input_;
 
   // Icache simulation
   v8::internal::HashMap* i_cache_;
 
+  DecodeHandler decode_handler_;
+
   // Registered breakpoints.
   Instruction* break_pc_;
   Instr break_instr_;
@@ -437,6 +508,9 @@ class Simulator {
       FUNCTION_ADDR(entry), 5, (intptr_t)p0, (intptr_t)p1, (intptr_t)p2, \
       (intptr_t)p3, (intptr_t)p4))
 
+#define CALL_GENERATED_FP_INT(isolate, entry, p0, p1) \
+  Simulator::current(isolate)->CallFPReturnsInt(FUNCTION_ADDR(entry), p0, p1)
+
 #define CALL_GENERATED_REGEXP_CODE(isolate, entry, p0, p1, p2, p3, p4, p5, p6, \
                                    p7, p8)                                     \
   Simulator::current(isolate)->Call(entry, 10, (intptr_t)p0, (intptr_t)p1,     \
@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/base/atomicops.h"
+#include "src/base/platform/semaphore.h"
+#include "src/cancelable-task.h"
 #include "src/macro-assembler.h"
 #include "src/objects.h"
 #include "src/v8.h"
@@ -267,6 +270,142 @@ bool AllocateGlobals(ErrorThrower* thrower, Isolate* isolate,
   }
   return true;
 }
+
+
+// Executes the compilation units that have not been claimed by another thread
+// yet.
+void ExecuteCompilationUnits(
+    std::vector<compiler::WasmCompilationUnit*>* units,
+    base::Atomic32* next_unit) {
+  const int count = static_cast<int>(units->size());
+  while (true) {
+    int index = base::NoBarrier_AtomicIncrement(next_unit, 1) - 1;
+    if (index >= count) break;
+    units->at(index)->ExecuteCompilation();
+  }
+}
+
+
+// A background task that takes part in executing compilation units.
+class WasmCompilationTask : public CancelableTask {
+ public:
+  WasmCompilationTask(Isolate* isolate,
+                      std::vector<compiler::WasmCompilationUnit*>* units,
+                      base::Atomic32* next_unit, base::Semaphore* on_finish)
+      : CancelableTask(isolate),
+        units_(units),
+        next_unit_(next_unit),
+        on_finish_(on_finish) {}
+
+  virtual ~WasmCompilationTask() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    ExecuteCompilationUnits(units_, next_unit_);
+    on_finish_->Signal();
+  }
+
+  std::vector<compiler::WasmCompilationUnit*>* units_;
+  base::Atomic32* next_unit_;
+  base::Semaphore* on_finish_;
+
+  DISALLOW_COPY_AND_ASSIGN(WasmCompilationTask);
+};
+
+
+// Number of background tasks to execute {units} compilation units with. The
+// main thread takes part as well.
+int NumberOfCompilationTasks(int units) {
+#ifdef USE_SIMULATOR
+  // The simulator redirects external references through a list that is not
+  // thread-safe.
+  return 0;
+#else
+  // Tracing and profiling of the pipeline is not thread-safe.
+  if (FLAG_trace_turbo || FLAG_trace_turbo_graph || FLAG_turbo_stats ||
+      FLAG_turbo_profiling) {
+    return 0;
+  }
+  int available_threads = static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  int tasks = Min(FLAG_wasm_num_compilation_tasks, units - 1);
+  return Max(0, Min(tasks, available_threads));
+#endif
+}
+
+
+// Compiles all functions of the module that are not external and installs
+// their code in the {linker}. Functions are compiled in batches: the main
+// thread sets up the compilation units of a batch, executes them together
+// with background tasks and then generates the code objects. The main thread
+// does not touch the heap while the units are executed.
+bool CompileFunctions(ErrorThrower* thrower, Isolate* isolate,
+                      ModuleEnv* module_env, WasmLinker* linker) {
+  static const size_t kBatchSize = 64;
+  std::vector<WasmFunction>* functions = module_env->module->functions;
+
+  // Direct calls to functions that are not compiled yet go to placeholder
+  // code objects. These cannot be allocated on background threads, so
+  // allocate all of them upfront.
+  for (uint32_t index = 0; index < functions->size(); index++) {
+    linker->GetFunctionCode(index);
+  }
+
+  std::vector<compiler::WasmCompilationUnit*> units;
+  units.reserve(kBatchSize);
+  size_t next_function = 0;
+  while (next_function < functions->size()) {
+    for (; next_function < functions->size() && units.size() < kBatchSize;
+         next_function++) {
+      const WasmFunction* func = &functions->at(next_function);
+      if (func->external) continue;
+      units.push_back(new compiler::WasmCompilationUnit(thrower, isolate,
+                                                        module_env, func));
+    }
+
+    // Execute the units on the main thread and on background tasks.
+    base::Atomic32 next_unit = 0;
+    const int num_tasks =
+        NumberOfCompilationTasks(static_cast<int>(units.size()));
+    base::Semaphore pending_tasks(0);
+    std::vector<uint32_t> task_ids;
+    for (int i = 0; i < num_tasks; i++) {
+      WasmCompilationTask* task =
+          new WasmCompilationTask(isolate, &units, &next_unit, &pending_tasks);
+      task_ids.push_back(task->id());
+      V8::GetCurrentPlatform()->CallOnBackgroundThread(
+          task, v8::Platform::kShortRunningTask);
+    }
+    ExecuteCompilationUnits(&units, &next_unit);
+    // Tasks that have not started yet are not needed anymore.
+    for (uint32_t id : task_ids) {
+      if (!isolate->cancelable_task_manager()->TryAbort(id)) {
+        pending_tasks.Wait();
+      }
+    }
+
+    // Generate the code objects on the main thread.
+    bool failed = false;
+    for (compiler::WasmCompilationUnit* unit : units) {
+      if (!failed) {
+        const WasmFunction* func = unit->function();
+        Handle<Code> code = unit->FinishCompilation();
+        if (code.is_null()) {
+          thrower->Error("Compilation of #%d:%s failed.", func->func_index,
+                         module_env->module->GetName(func->name_offset));
+          failed = true;
+        } else {
+          linker->Finish(func->func_index, code);
+        }
+      }
+      delete unit;
+    }
+    units.clear();
+    if (failed) return false;
+  }
+  return true;
+}
 }  // namespace
 
 WasmModule::WasmModule()
@@ -409,48 +548,51 @@ MaybeHandle<JSObject> WasmModule::Instantiate(Isolate* isolate,
   // Compile all functions in the module.
   //-------------------------------------------------------------------------
 
-  // First pass: compile each function and initialize the code table.
+  // First pass: compile wrappers for external functions.
   index = 0;
   for (const WasmFunction& func : *functions) {
-    if (thrower.error()) break;
     DCHECK_EQ(index, func.func_index);
-
-    const char* cstr = GetName(func.name_offset);
-    Handle<String> name = factory->InternalizeUtf8String(cstr);
-    Handle<Code> code = Handle<Code>::null();
-    Handle<JSFunction> function = Handle<JSFunction>::null();
     if (func.external) {
       // Lookup external function in FFI object.
+      const char* cstr = GetName(func.name_offset);
+      Handle<String> name = factory->InternalizeUtf8String(cstr);
       MaybeHandle<JSFunction> function =
           LookupFunction(thrower, ffi, index, name, cstr);
       if (function.is_null()) return MaybeHandle<JSObject>();
-      code = compiler::CompileWasmToJSWrapper(
+      Handle<Code> code = compiler::CompileWasmToJSWrapper(
           isolate, &module_env, function.ToHandleChecked(), func.sig, cstr);
-    } else {
-      // Compile the function.
-      code = compiler::CompileWasmFunction(thrower, isolate, &module_env, func);
-      if (code.is_null()) {
-        thrower.Error("Compilation of #%d:%s failed.", index, cstr);
-        return MaybeHandle<JSObject>();
-      }
-      if (func.exported) {
-        function = compiler::CompileJSToWasmWrapper(
-            isolate, &module_env, name, code, instance.js_object, index);
-      }
-    }
-    if (!code.is_null()) {
       // Install the code into the linker table.
       linker.Finish(index, code);
       code_table->set(index, *code);
     }
-    if (func.exported) {
-      // Exported functions are installed as read-only properties on the module.
-      JSObject::AddProperty(instance.js_object, name, function, READ_ONLY);
+    index++;
+  }
+
+  // Second pass: compile the remaining functions, in parallel if possible.
+  if (!CompileFunctions(&thrower, isolate, &module_env, &linker)) {
+    return MaybeHandle<JSObject>();
+  }
+
+  // Third pass: initialize the code table and export functions.
+  index = 0;
+  for (const WasmFunction& func : *functions) {
+    if (!func.external) {
+      Handle<Code> code = linker.GetFunctionCode(index);
+      code_table->set(index, *code);
+      if (func.exported) {
+        // Exported functions are installed as read-only properties on the
+        // module.
+        const char* cstr = GetName(func.name_offset);
+        Handle<String> name = factory->InternalizeUtf8String(cstr);
+        Handle<JSFunction> function = compiler::CompileJSToWasmWrapper(
+            isolate, &module_env, name, code, instance.js_object, index);
+        JSObject::AddProperty(instance.js_object, name, function, READ_ONLY);
+      }
     }
     index++;
   }
 
-  // Second pass: patch all direct call sites.
+  // Patch all direct call sites.
   linker.Link(instance.function_table, this->function_table);
   instance.js_object->SetInternalField(kWasmModuleFunctionTable,
                                        Smi::FromInt(0));
@@ -554,23 +696,17 @@ int32_t CompileAndRunWasmModule(Isolate* isolate, WasmModule* module) {
   module_env.asm_js = false;
 
   // Compile all functions.
-  Handle<Code> main_code = Handle<Code>::null();  // record last code.
+  if (!CompileFunctions(&thrower, isolate, &module_env, &linker)) return -1;
+
+  // Record the code of the last exported function.
+  Handle<Code> main_code = Handle<Code>::null();
   uint32_t index = 0;
   int main_index = 0;
   for (const WasmFunction& func : *module->functions) {
     DCHECK_EQ(index, func.func_index);
-    if (!func.external) {
-      // Compile the function and install it in the code table.
-      Handle<Code> code =
-          compiler::CompileWasmFunction(thrower, isolate, &module_env, func);
-      if (!code.is_null()) {
-        if (func.exported) {
-          main_code = code;
-          main_index = index;
-        }
-        linker.Finish(index, code);
-      }
-      if (thrower.error()) return -1;
+    if (!func.external && func.exported) {
+      main_code = linker.GetFunctionCode(index);
+      main_index = index;
     }
     index++;
   }
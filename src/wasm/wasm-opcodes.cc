@@ -25,6 +25,20 @@ const char* WasmOpcodes::OpcodeName(WasmOpcode opcode) {
 }
 
 
+const char* WasmOpcodes::TrapReasonMessage(TrapReason reason) {
+  switch (reason) {
+#define TRAPREASON_MESSAGE(name, message) \
+  case k##name:                           \
+    return message;
+    FOREACH_WASM_TRAPREASON(TRAPREASON_MESSAGE)
+#undef TRAPREASON_MESSAGE
+    default:
+      UNREACHABLE();
+      return nullptr;
+  }
+}
+
+
 std::ostream& operator<<(std::ostream& os, const FunctionSig& sig) {
   if (sig.return_count() == 0) os << "v";
   for (size_t i = 0; i < sig.return_count(); i++) {
@@ -300,12 +300,31 @@ enum WasmOpcode {
 #undef DECLARE_NAMED_ENUM
 };
 
+// The reasons for trapping at runtime, with their messages.
+#define FOREACH_WASM_TRAPREASON(V)                              \
+  V(TrapUnreachable, "unreachable")                             \
+  V(TrapMemOutOfBounds, "memory access out of bounds")          \
+  V(TrapDivByZero, "divide by zero")                            \
+  V(TrapDivUnrepresentable, "divide result unrepresentable")    \
+  V(TrapRemByZero, "remainder by zero")                         \
+  V(TrapFloatUnrepresentable, "integer result unrepresentable") \
+  V(TrapFuncInvalid, "invalid function")                        \
+  V(TrapFuncSigMismatch, "function signature mismatch")
+
+enum TrapReason {
+#define DECLARE_ENUM(name, message) k##name,
+  FOREACH_WASM_TRAPREASON(DECLARE_ENUM)
+#undef DECLARE_ENUM
+      kTrapCount
+};
+
 // A collection of opcode-related static methods.
 class WasmOpcodes {
  public:
   static bool IsSupported(WasmOpcode opcode);
   static const char* OpcodeName(WasmOpcode opcode);
   static FunctionSig* Signature(WasmOpcode opcode);
+  static const char* TrapReasonMessage(TrapReason reason);
 
   static byte MemSize(MachineType type) {
     return 1 << ElementSizeLog2Of(type.representation());
@@ -691,6 +691,19 @@ class Assembler : public AssemblerBase {
   void movw(const Operand& dst, Register src);
   void movw(const Operand& dst, Immediate imm);
 
+  // Atomic read-modify-write instructions. cmpxchg and xadd only act
+  // atomically when preceded by lock(); xchg with a memory operand is always
+  // locked.
+  void lock();
+  void xchgb(Register reg, const Operand& op);
+  void xchgw(Register reg, const Operand& op);
+  void cmpxchgb(const Operand& dst, Register src);
+  void cmpxchgw(const Operand& dst, Register src);
+  void cmpxchgl(const Operand& dst, Register src);
+  void xaddb(const Operand& dst, Register src);
+  void xaddw(const Operand& dst, Register src);
+  void xaddl(const Operand& dst, Register src);
+
   // Move the offset of the label location relative to the current
   // position (after the move) to the destination.
   void movl(const Operand& dst, Label* src);
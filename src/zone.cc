@@ -6,6 +6,8 @@
 
 #include <cstring>
 
+#include "src/base/bits.h"
+#include "src/flags.h"
 #include "src/v8.h"
 
 #ifdef V8_USE_ADDRESS_SANITIZER
@@ -45,8 +47,8 @@ const size_t kASanRedzoneBytes = 0;
 // Segments represent chunks of memory: They have starting address
 // (encoded in the this pointer) and a size in bytes. Segments are
 // chained together forming a LIFO structure with the newest segment
-// available as segment_head_. Segments are allocated using malloc()
-// and de-allocated using free().
+// available as segment_head_. Segments are allocated from and returned to
+// the ZoneSegmentPool.
 
 class Segment {
  public:
@@ -73,6 +75,103 @@ class Segment {
 };
 
 
+base::LazyMutex ZoneSegmentPool::mutex_ = LAZY_MUTEX_INITIALIZER;
+ZoneSegmentPool::FreeSegment*
+    ZoneSegmentPool::free_lists_[ZoneSegmentPool::kNumberOfSizeClasses];
+size_t ZoneSegmentPool::pooled_bytes_ = 0;
+size_t ZoneSegmentPool::pooled_allocations_ = 0;
+size_t ZoneSegmentPool::fresh_allocations_ = 0;
+
+
+size_t ZoneSegmentPool::SizeFor(size_t size) {
+  if (size <= kMinimumSize) return kMinimumSize;
+  if (size > kMaximumSize) return size;
+  return base::bits::RoundUpToPowerOfTwo32(static_cast<uint32_t>(size));
+}
+
+
+int ZoneSegmentPool::SizeClass(size_t size) {
+  DCHECK_EQ(SizeFor(size), size);
+  DCHECK_LE(size, kMaximumSize);
+  return WhichPowerOf2(static_cast<uint32_t>(size / kMinimumSize));
+}
+
+
+void* ZoneSegmentPool::Allocate(size_t size) {
+  size = SizeFor(size);
+  {
+    base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+    if (size <= kMaximumSize) {
+      int size_class = SizeClass(size);
+      FreeSegment* segment = free_lists_[size_class];
+      if (segment != nullptr) {
+        ASAN_UNPOISON_MEMORY_REGION(segment, size);
+        free_lists_[size_class] = segment->next;
+        pooled_bytes_ -= size;
+        pooled_allocations_++;
+        return segment;
+      }
+    }
+    fresh_allocations_++;
+  }
+  return Malloced::New(size);
+}
+
+
+void ZoneSegmentPool::Free(void* segment, size_t size) {
+  DCHECK_EQ(SizeFor(size), size);
+  if (size <= kMaximumSize) {
+    base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+    size_t limit = static_cast<size_t>(FLAG_zone_segment_pool_size) * MB;
+    if (pooled_bytes_ + size <= limit) {
+      int size_class = SizeClass(size);
+      FreeSegment* free_segment = reinterpret_cast<FreeSegment*>(segment);
+      free_segment->next = free_lists_[size_class];
+      free_lists_[size_class] = free_segment;
+      pooled_bytes_ += size;
+      ASAN_POISON_MEMORY_REGION(segment, size);
+      return;
+    }
+  }
+  Malloced::Delete(segment);
+}
+
+
+void ZoneSegmentPool::Trim() {
+  base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+  for (int i = 0; i < kNumberOfSizeClasses; i++) {
+    size_t size = kMinimumSize << i;
+    FreeSegment* segment = free_lists_[i];
+    while (segment != nullptr) {
+      ASAN_UNPOISON_MEMORY_REGION(segment, size);
+      FreeSegment* next = segment->next;
+      Malloced::Delete(segment);
+      segment = next;
+    }
+    free_lists_[i] = nullptr;
+  }
+  pooled_bytes_ = 0;
+}
+
+
+size_t ZoneSegmentPool::pooled_bytes() {
+  base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+  return pooled_bytes_;
+}
+
+
+size_t ZoneSegmentPool::pooled_allocations() {
+  base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+  return pooled_allocations_;
+}
+
+
+size_t ZoneSegmentPool::fresh_allocations() {
+  base::LockGuard<base::Mutex> guard(mutex_.Pointer());
+  return fresh_allocations_;
+}
+
+
 Zone::Zone()
     : allocation_size_(0),
       segment_bytes_allocated_(0),
@@ -201,7 +300,8 @@ void Zone::DeleteKeptSegment() {
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(size_t size) {
-  Segment* result = reinterpret_cast<Segment*>(Malloced::New(size));
+  Segment* result =
+      reinterpret_cast<Segment*>(ZoneSegmentPool::Allocate(size));
   segment_bytes_allocated_ += size;
   if (result != nullptr) {
     result->Initialize(segment_head_, size);
@@ -214,7 +314,7 @@ Segment* Zone::NewSegment(size_t size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, size_t size) {
   segment_bytes_allocated_ -= size;
-  Malloced::Delete(segment);
+  ZoneSegmentPool::Free(segment, size);
 }
 
 
@@ -248,6 +348,9 @@ Address Zone::NewExpand(size_t size) {
     // requested size.
     new_size = Max(min_new_size, kMaximumSegmentSize);
   }
+  // Use the whole block handed out by the segment pool.
+  STATIC_ASSERT(kMaximumSegmentSize == ZoneSegmentPool::kMaximumSize);
+  new_size = ZoneSegmentPool::SizeFor(new_size);
   if (new_size > INT_MAX) {
     V8::FatalProcessOutOfMemory("Zone");
     return nullptr;
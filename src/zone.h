@@ -9,6 +9,7 @@
 
 #include "src/allocation.h"
 #include "src/base/logging.h"
+#include "src/base/platform/mutex.h"
 #include "src/globals.h"
 #include "src/hashmap.h"
 #include "src/list.h"
@@ -21,6 +22,57 @@ namespace internal {
 class Segment;
 
 
+// A process-wide pool of zone segments, shared by all zones on all threads.
+// Segment sizes up to kMaximumSize are rounded up to a power of two, and
+// released segments are kept on a free list per size class so that parsing
+// and compilation do not go to malloc() for every segment. The pool retains
+// at most FLAG_zone_segment_pool_size MB and is emptied when the heap reduces
+// its memory footprint.
+class ZoneSegmentPool final : public AllStatic {
+ public:
+  // Smallest and largest pooled segment sizes in bytes.
+  static const size_t kMinimumSize = 8 * KB;
+  static const size_t kMaximumSize = 1 * MB;
+
+  // Returns the number of bytes Allocate() hands out for a request of |size|
+  // bytes.
+  static size_t SizeFor(size_t size);
+
+  // Returns a block of SizeFor(size) bytes, reusing a pooled one if possible.
+  static void* Allocate(size_t size);
+
+  // Returns a block obtained from Allocate() to the pool, or to the system if
+  // it is not poolable or the pool is full.
+  static void Free(void* segment, size_t size);
+
+  // Releases all pooled segments to the system.
+  static void Trim();
+
+  // Number of bytes currently held by the pool.
+  static size_t pooled_bytes();
+
+  // Number of allocations served from the pool and by malloc() respectively.
+  static size_t pooled_allocations();
+  static size_t fresh_allocations();
+
+ private:
+  static const int kNumberOfSizeClasses = 8;
+  STATIC_ASSERT(kMinimumSize << (kNumberOfSizeClasses - 1) == kMaximumSize);
+
+  struct FreeSegment {
+    FreeSegment* next;
+  };
+
+  static int SizeClass(size_t size);
+
+  static base::LazyMutex mutex_;
+  static FreeSegment* free_lists_[kNumberOfSizeClasses];
+  static size_t pooled_bytes_;
+  static size_t pooled_allocations_;
+  static size_t fresh_allocations_;
+};
+
+
 // The Zone supports very fast allocation of small chunks of
 // memory. The chunks cannot be deallocated individually, but instead
 // the Zone supports deallocating all chunks in one fast
@@ -240,14 +240,18 @@
           'sources': [  ### gcmole(arch:s390) ###
             'test-assembler-s390.cc',
             'test-code-stubs.cc',
-            'test-disasm-s390.cc'
+            'test-code-stubs-s390.cc',
+            'test-disasm-s390.cc',
+            'test-macro-assembler-s390.cc'
           ],
         }],
         ['v8_target_arch=="s390x"', {
           'sources': [  ### gcmole(arch:s390x) ###
             'test-assembler-s390.cc',
             'test-code-stubs.cc',
-            'test-disasm-s390.cc'
+            'test-code-stubs-s390.cc',
+            'test-disasm-s390.cc',
+            'test-macro-assembler-s390.cc'
           ],
         }],
         ['v8_target_arch=="ppc"', {
@@ -6531,5 +6531,87 @@ HEAP_TEST(Regress587004) {
   heap->CollectGarbage(NEW_SPACE);
 }
 
+
+// Builds new space arrays that are each reachable from an old space array,
+// from a second old space array and from their neighbour, so that parallel
+// scavenging tasks race for them.
+static void AllocateParallelScavengeGraph(Factory* factory, int count,
+                                          Handle<FixedArray> roots,
+                                          Handle<FixedArray> reversed) {
+  const int kLength = 8;
+  for (int i = 0; i < count; i++) {
+    Handle<FixedArray> array = factory->NewFixedArray(kLength);
+    array->set(0, Smi::FromInt(i));
+    if (i > 0) array->set(1, roots->get(i - 1));
+    roots->set(i, *array);
+    reversed->set(count - 1 - i, *array);
+  }
+}
+
+
+static void CheckParallelScavengeGraph(Heap* heap, int count,
+                                       Handle<FixedArray> roots,
+                                       Handle<FixedArray> reversed) {
+  for (int i = 0; i < count; i++) {
+    FixedArray* array = FixedArray::cast(roots->get(i));
+    CHECK(!heap->InFromSpace(array));
+    CHECK_EQ(Smi::FromInt(i), array->get(0));
+    CHECK_EQ(array, reversed->get(count - 1 - i));
+    if (i > 0) CHECK_EQ(roots->get(i - 1), array->get(1));
+  }
+}
+
+
+TEST(ParallelScavenge) {
+  FLAG_parallel_scavenge = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // Enough surviving objects for several tasks.
+  const int kCount = 4096;
+  Handle<FixedArray> roots = factory->NewFixedArray(kCount, TENURED);
+  Handle<FixedArray> reversed = factory->NewFixedArray(kCount, TENURED);
+  AllocateParallelScavengeGraph(factory, kCount, roots, reversed);
+
+  // The first scavenge copies the objects within new space, the second one
+  // promotes them.
+  heap->CollectGarbage(NEW_SPACE);
+  CheckParallelScavengeGraph(heap, kCount, roots, reversed);
+  heap->CollectGarbage(NEW_SPACE);
+  CheckParallelScavengeGraph(heap, kCount, roots, reversed);
+  for (int i = 0; i < kCount; i++) {
+    CHECK(heap->old_space()->Contains(HeapObject::cast(roots->get(i))));
+  }
+}
+
+
+HEAP_TEST(ParallelScavengePromotionFailure) {
+  FLAG_parallel_scavenge = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  const int kCount = 4096;
+  Handle<FixedArray> roots = factory->NewFixedArray(kCount, TENURED);
+  Handle<FixedArray> reversed = factory->NewFixedArray(kCount, TENURED);
+  AllocateParallelScavengeGraph(factory, kCount, roots, reversed);
+  heap->CollectGarbage(NEW_SPACE);
+
+  // Objects that cannot be promoted stay in new space.
+  SimulateFullSpace(heap->old_space());
+  heap->set_force_oom(true);
+  heap->CollectGarbage(NEW_SPACE);
+  heap->set_force_oom(false);
+  CheckParallelScavengeGraph(heap, kCount, roots, reversed);
+
+  heap->CollectGarbage(NEW_SPACE);
+  CheckParallelScavengeGraph(heap, kCount, roots, reversed);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -194,5 +194,51 @@ TEST(IncrementalMarkingUsingDelayedTasks) {
   i::V8::SetPlatformForTesting(old_platform);
 }
 
+
+TEST(ConcurrentMarkingOfFixedArrays) {
+  if (!i::FLAG_incremental_marking) return;
+  i::FLAG_concurrent_marking = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  heap->CollectAllGarbage();
+
+  // A long chain of old space arrays that is only reachable from its head.
+  const int kChainLength = 2000;
+  const int kArrayLength = 16;
+  Handle<FixedArray> head = factory->NewFixedArray(kArrayLength, TENURED);
+  {
+    HandleScope inner_scope(isolate);
+    Handle<FixedArray> current = head;
+    for (int i = 1; i < kChainLength; i++) {
+      Handle<FixedArray> next = factory->NewFixedArray(kArrayLength, TENURED);
+      current->set(0, *next);
+      current->set(1, *factory->NewHeapNumber(i, IMMUTABLE, TENURED));
+      current = next;
+    }
+  }
+
+  i::IncrementalMarking* marking = heap->incremental_marking();
+  marking->Stop();
+  SimulateIncrementalMarking(heap, false);
+  // Stores into arrays that may have been visited in the background already.
+  Handle<FixedArray> late = factory->NewFixedArray(kArrayLength, TENURED);
+  late->set(0, Smi::FromInt(42));
+  head->set(2, *late);
+  SimulateIncrementalMarking(heap, true);
+  heap->CollectAllGarbage();
+
+  CHECK_EQ(42, Smi::cast(FixedArray::cast(head->get(2))->get(0))->value());
+  FixedArray* current = *head;
+  int length = 1;
+  while (current->get(0)->IsFixedArray()) {
+    current = FixedArray::cast(current->get(0));
+    length++;
+  }
+  CHECK_EQ(kChainLength, length);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -200,6 +200,91 @@ HEAP_TEST(MarkCompactCollector) {
 }
 
 
+TEST(ParallelMarking) {
+  FLAG_parallel_marking = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // A wide tree of arrays, JSObjects and heap numbers, which gives the
+  // background tasks enough work to share.
+  const int kWidth = 64;
+  const int kLeafLength = 2;
+  Handle<FixedArray> root = factory->NewFixedArray(kWidth);
+  {
+    HandleScope inner_scope(isolate);
+    for (int i = 0; i < kWidth; i++) {
+      Handle<FixedArray> level = factory->NewFixedArray(kWidth);
+      root->set(i, *level);
+      for (int j = 0; j < kWidth; j++) {
+        Handle<JSObject> object =
+            factory->NewJSObject(isolate->object_function());
+        Handle<FixedArray> leaf = factory->NewFixedArray(kLeafLength);
+        leaf->set(0, *factory->NewHeapNumber(i * kWidth + j));
+        leaf->set(1, *object);
+        level->set(j, *leaf);
+      }
+    }
+  }
+
+  heap->CollectAllGarbage();
+  heap->CollectAllGarbage(Heap::kReduceMemoryFootprintMask);
+
+  for (int i = 0; i < kWidth; i++) {
+    FixedArray* level = FixedArray::cast(root->get(i));
+    for (int j = 0; j < kWidth; j++) {
+      FixedArray* leaf = FixedArray::cast(level->get(j));
+      CHECK_EQ(i * kWidth + j, HeapNumber::cast(leaf->get(0))->value());
+      CHECK(leaf->get(1)->IsJSObject());
+    }
+  }
+}
+
+
+TEST(ParallelPointerUpdate) {
+  FLAG_parallel_pointer_update = true;
+  FLAG_manual_evacuation_candidates_selection = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // Old-space objects on a forced evacuation candidate are referenced from
+  // old space and from to-space, and old space also references new-space
+  // objects. This gives the tasks recorded slots, old-to-new slots and
+  // to-space pages to update.
+  const int kLength = 256;
+  Handle<FixedArray> targets = factory->NewFixedArray(kLength, TENURED);
+  for (int i = 0; i < kLength; i++) {
+    targets->set(i, *factory->NewHeapNumber(i, IMMUTABLE, TENURED));
+  }
+  Handle<FixedArray> old_holder = factory->NewFixedArray(kLength, TENURED);
+  Handle<FixedArray> young_holder = factory->NewFixedArray(kLength);
+  Handle<FixedArray> old_to_new_holder = factory->NewFixedArray(kLength, TENURED);
+  for (int i = 0; i < kLength; i++) {
+    old_holder->set(i, targets->get(i));
+    young_holder->set(i, targets->get(i));
+    old_to_new_holder->set(i, *factory->NewHeapNumber(kLength + i));
+  }
+  CHECK(heap->InNewSpace(*young_holder));
+  CHECK(heap->InNewSpace(old_to_new_holder->get(0)));
+
+  Page* evac_page = Page::FromAddress(targets->address());
+  evac_page->SetFlag(MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+  heap->CollectAllGarbage();
+
+  for (int i = 0; i < kLength; i++) {
+    CHECK_EQ(i, HeapNumber::cast(targets->get(i))->value());
+    CHECK_EQ(targets->get(i), old_holder->get(i));
+    CHECK_EQ(targets->get(i), young_holder->get(i));
+    CHECK_EQ(kLength + i, HeapNumber::cast(old_to_new_holder->get(i))->value());
+  }
+}
+
+
 // TODO(1600): compaction of map space is temporary removed from GC.
 #if 0
 static Handle<Map> CreateMap(Isolate* isolate) {
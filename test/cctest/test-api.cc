@@ -21815,6 +21815,197 @@ THREADED_TEST(JSONParseNumber) {
 }
 
 
+static v8::MaybeLocal<Value> ParseJSONInBackground(v8::Isolate* isolate,
+                                                   Local<String> json) {
+  v8::JSON::BackgroundSource source;
+  v8::JSON::ParsingTask* task = v8::JSON::StartParsing(isolate, json, &source);
+  task->Run();
+  delete task;
+  return v8::JSON::FinishParsing(isolate, &source);
+}
+
+
+static void CheckBackgroundJSONParse(LocalContext* context, const char* json) {
+  v8::Isolate* isolate = (*context)->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<Value> obj =
+      ParseJSONInBackground(isolate, v8_str(json)).ToLocalChecked();
+  Local<Value> expected =
+      v8::JSON::Parse(isolate, v8_str(json)).ToLocalChecked();
+  Local<Object> global = (*context)->Global();
+  global->Set(context->local(), v8_str("obj"), obj).FromJust();
+  global->Set(context->local(), v8_str("expected"), expected).FromJust();
+  CHECK(CompileRun("JSON.stringify(obj) === JSON.stringify(expected)")
+            ->BooleanValue(context->local())
+            .FromJust());
+}
+
+
+THREADED_TEST(JSONParseInBackground) {
+  LocalContext context;
+  CheckBackgroundJSONParse(&context, "42");
+  CheckBackgroundJSONParse(&context, " -0.5e-3 ");
+  CheckBackgroundJSONParse(&context,
+                           "[1, 2.5, 1e400, true, false, null, \"\"]");
+  CheckBackgroundJSONParse(
+      &context, "{\"a\": {\"b\": [1, {\"c\": null}]}, \"0\": 1, \"a\": 2}");
+  CheckBackgroundJSONParse(
+      &context, "[{\"x\": 1, \"y\": 2}, {\"x\": 3, \"y\": 4}]");
+  CheckBackgroundJSONParse(&context,
+                           "\"\\u00e9\\n\\\"\\ud83d\\ude00\"");
+  CheckBackgroundJSONParse(
+      &context, "{\"\\u0061\": \"\\t\", \"4294967295\": 0}");
+}
+
+
+THREADED_TEST(JSONParseInBackgroundTwoByte) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  // A two-byte source, with a two-byte value that also contains an escape.
+  Local<Value> obj =
+      ParseJSONInBackground(
+          isolate, v8_str("{\"\xce\xb1\": [\"\xce\xb2\\u03b3\"]}"))
+          .ToLocalChecked();
+  Local<Object> global = context->Global();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("obj['\\u03b1'][0]", "\xce\xb2\xce\xb3");
+}
+
+
+THREADED_TEST(JSONParseInBackgroundRepeated) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::JSON::BackgroundSource source;
+  v8::JSON::ParsingTask* task =
+      v8::JSON::StartParsing(isolate, v8_str("{\"x\": [42]}"), &source);
+  task->Run();
+  delete task;
+  Local<Value> first =
+      v8::JSON::FinishParsing(isolate, &source).ToLocalChecked();
+  Local<Value> second =
+      v8::JSON::FinishParsing(isolate, &source).ToLocalChecked();
+  CHECK(!first->StrictEquals(second));
+  Local<Object> global = context->Global();
+  global->Set(context.local(), v8_str("first"), first).FromJust();
+  global->Set(context.local(), v8_str("second"), second).FromJust();
+  ExpectString("JSON.stringify(first)", "{\"x\":[42]}");
+  ExpectString("JSON.stringify(second)", "{\"x\":[42]}");
+  ExpectFalse("first.x === second.x");
+}
+
+
+THREADED_TEST(JSONParseInBackgroundError) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  const char* inputs[] = {"", "[1,]", "{\"a\" 1}", "\"abc", "01", "[1] 2"};
+  for (size_t i = 0; i < arraysize(inputs); i++) {
+    v8::TryCatch expected_catch(isolate);
+    CHECK(v8::JSON::Parse(isolate, v8_str(inputs[i])).IsEmpty());
+    CHECK(expected_catch.HasCaught());
+    v8::TryCatch try_catch(isolate);
+    CHECK(ParseJSONInBackground(isolate, v8_str(inputs[i])).IsEmpty());
+    CHECK(try_catch.HasCaught());
+    v8::String::Utf8Value expected(expected_catch.Exception());
+    v8::String::Utf8Value actual(try_catch.Exception());
+    CHECK_EQ(0, strcmp(*expected, *actual));
+  }
+}
+
+
+THREADED_TEST(JSONParseInBackgroundDeepNesting) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<String> deep =
+      CompileRun("Array(100001).join('[') + Array(100001).join(']')")
+          .As<String>();
+  v8::TryCatch try_catch(isolate);
+  CHECK(ParseJSONInBackground(isolate, deep).IsEmpty());
+  CHECK(try_catch.HasCaught());
+  CHECK(try_catch.Exception()->IsObject());
+}
+
+
+// Parses |length| bytes at |utf8| directly and from a string, and checks that
+// both give the same value or throw the same exception.
+static void CheckUtf8JSONParse(LocalContext* context, const char* utf8,
+                               int length) {
+  v8::Isolate* isolate = (*context)->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<String> string =
+      v8::String::NewFromUtf8(isolate, utf8, v8::NewStringType::kNormal,
+                              length)
+          .ToLocalChecked();
+  v8::TryCatch expected_catch(isolate);
+  v8::MaybeLocal<Value> expected = v8::JSON::Parse(isolate, string);
+  v8::TryCatch try_catch(isolate);
+  v8::MaybeLocal<Value> actual = v8::JSON::Parse(isolate, utf8, length);
+  CHECK_EQ(expected.IsEmpty(), actual.IsEmpty());
+  CHECK_EQ(expected_catch.HasCaught(), try_catch.HasCaught());
+  Local<Value> expected_value = expected.IsEmpty()
+                                    ? expected_catch.Exception()
+                                    : expected.ToLocalChecked();
+  Local<Value> actual_value =
+      actual.IsEmpty() ? try_catch.Exception() : actual.ToLocalChecked();
+  Local<Object> global = (*context)->Global();
+  global->Set(context->local(), v8_str("expected"), expected_value).FromJust();
+  global->Set(context->local(), v8_str("actual"), actual_value).FromJust();
+  CHECK(CompileRun(
+            "expected instanceof Error"
+            "    ? actual instanceof SyntaxError &&"
+            "      actual.message === expected.message"
+            "    : JSON.stringify(actual) === JSON.stringify(expected)")
+            ->BooleanValue(context->local())
+            .FromJust());
+}
+
+
+static void CheckUtf8JSONParse(LocalContext* context, const char* utf8) {
+  CheckUtf8JSONParse(context, utf8, static_cast<int>(strlen(utf8)));
+}
+
+
+THREADED_TEST(JSONParseUtf8) {
+  LocalContext context;
+  CheckUtf8JSONParse(&context, "42");
+  CheckUtf8JSONParse(&context, "");
+  CheckUtf8JSONParse(&context, " [1, 2.5, true, false, null, \"\", {}] ");
+  CheckUtf8JSONParse(&context,
+                     "{\"a\": {\"b\": [1, {\"c\": null}]}, \"0\": 1}");
+  // Two, three and four byte sequences in keys and values.
+  CheckUtf8JSONParse(
+      &context,
+      "{\"caf\xc3\xa9\": [\"\xce\xb1\xce\xb2\", \"\xe2\x82\xac\", "
+      "\"\xf0\x9f\x98\x80\"], \"caf\\u00e9\": 1}");
+  // Escapes mixed with multi-byte sequences.
+  CheckUtf8JSONParse(&context,
+                     "[\"\xc3\xa9\\n\xce\xb1\\u0041\xf0\x9f\x98\x80\\\"\"]");
+  CheckUtf8JSONParse(&context,
+                     "{\"\xce\xb1\\t\": \"\\u00e9\xc3\xa9\"}");
+  // Invalid UTF-8 is replaced the way String::NewFromUtf8 replaces it.
+  CheckUtf8JSONParse(&context, "[\"\xff\xfe\", \"a\xc3\", \"\xc3\\n\"]");
+  CheckUtf8JSONParse(&context, "{\"\xe2\x82\": \"\xed\xa0\x80\"}");
+  // The length is respected.
+  CheckUtf8JSONParse(&context, "[1, 2] junk", 6);
+}
+
+
+THREADED_TEST(JSONParseUtf8Error) {
+  LocalContext context;
+  CheckUtf8JSONParse(&context, "[1,");
+  CheckUtf8JSONParse(&context, "\xc3\xa9");
+  CheckUtf8JSONParse(&context, "\xf0\x9f\x98\x80");
+  CheckUtf8JSONParse(&context, "[\"\xce\xb1\xce\xb2\", tru]");
+  CheckUtf8JSONParse(&context, "{\"\xc3\xa9\" 1}");
+  CheckUtf8JSONParse(&context, "[\"\xf0\x9f\x98\x80\", \xe2\x82\xac]");
+  CheckUtf8JSONParse(&context, "\"\xc3\xa9\n\"");
+  CheckUtf8JSONParse(&context, "[1, 2] junk");
+}
+
+
 #if V8_OS_POSIX && !V8_OS_NACL
 class ThreadInterruptTest {
  public:
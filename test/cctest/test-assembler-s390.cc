@@ -223,6 +223,378 @@ TEST(3) {
 }
 
 
+// Vector facility: strlen, 16 bytes at a time.
+TEST(10) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  if (!CpuFeatures::IsSupported(VECTOR_FACILITY)) return;
+
+  Assembler assm(isolate, NULL, 0);
+  Label loop;
+
+  // r2: String padded with zeros to a multiple of 16 bytes.
+  __ lgr(r3, r2);
+  __ vgbm(v17, Operand(0, kRelocInfo_NONEPTR));
+  __ bind(&loop);
+  __ vl(v16, MemOperand(r3, 0));
+  __ vfee(v16, v16, v17, Condition(kVectorByte), Condition(kVectorStringCS));
+  __ vlgv(r4, v16, MemOperand(r0, 7), Condition(kVectorByte));
+  __ la(r3, MemOperand(r3, r4, 0));
+  __ b(overflow, &loop);  // CC3: No zero byte found.
+  __ sgr(r3, r2);
+  __ lgr(r2, r3);
+  __ b(r14);
+
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+#ifdef DEBUG
+  code->Print();
+#endif
+  F3 f = FUNCTION_CAST<F3>(code->entry());
+  const char* strings[] = {"", "z13", "0123456789abcdef",
+                           "the quick brown fox jumps over the lazy dog"};
+  for (size_t i = 0; i < arraysize(strings); i++) {
+    char buffer[64] = {0};
+    strncpy(buffer, strings[i], sizeof(buffer) - 1);
+    intptr_t res = reinterpret_cast<intptr_t>(
+        CALL_GENERATED_CODE(isolate, f, buffer, 0, 0, 0, 0));
+    ::printf("f(\"%s\") = %" V8PRIdPTR "\n", strings[i], res);
+    CHECK_EQ(static_cast<intptr_t>(strlen(strings[i])), res);
+  }
+}
+
+// Compare and branch relative: sum 1..n with a fused loop back edge.
+TEST(11) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  if (!CpuFeatures::IsSupported(GENERAL_INSTR_EXT)) return;
+
+  MacroAssembler assm(isolate, NULL, 0,
+                      v8::internal::CodeObjectRequired::kYes);
+  Label loop, done, fail;
+
+  __ lr(r3, r2);
+  __ lhi(r2, Operand(0, kRelocInfo_NONEPTR));
+  __ lhi(r4, Operand(0, kRelocInfo_NONEPTR));
+  // Forward near branch, patched when |done| is bound.
+  __ CmpAndBranch32(le, r3, Operand(0, kRelocInfo_NONEPTR), &done,
+                    Label::kNear);
+  __ bind(&loop);
+  __ ar(r2, r3);
+  __ ahi(r3, Operand(-1 & 0xFFFF));
+  __ CmpAndBranch32(gt, r3, r4, &loop);
+  // 0xffffffff is never below 1 when compared logically.
+  __ lhi(r5, Operand(-1 & 0xFFFF));
+  __ CmpLogicalAndBranch32(lt, r5, Operand(1, kRelocInfo_NONEPTR), &fail,
+                           Label::kNear);
+  __ CmpLogicalAndBranch32(lt, r5, r4, &fail, Label::kNear);
+  __ bind(&done);
+  __ b(r14);
+  __ bind(&fail);
+  __ lhi(r2, Operand(-1 & 0xFFFF));
+  __ b(r14);
+
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+#ifdef DEBUG
+  code->Print();
+#endif
+  F1 f = FUNCTION_CAST<F1>(code->entry());
+  intptr_t res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, 100, 0, 0, 0, 0));
+  ::printf("f(100) = %" V8PRIdPTR "\n", res);
+  CHECK_EQ(5050, static_cast<int>(res));
+  res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, 0, 0, 0, 0, 0));
+  CHECK_EQ(0, static_cast<int>(res));
+}
+
+// Load on condition: branch-free max of two integers.
+TEST(12) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  if (!CpuFeatures::IsSupported(LOAD_STORE_ON_COND)) return;
+
+  Assembler assm(isolate, NULL, 0);
+
+  __ cr_z(r2, r3);
+  __ locr(lt, r2, r3);
+  __ b(r14);
+
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+#ifdef DEBUG
+  code->Print();
+#endif
+  F2 f = FUNCTION_CAST<F2>(code->entry());
+  intptr_t res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, 3, 7, 0, 0, 0));
+  ::printf("f(3, 7) = %" V8PRIdPTR "\n", res);
+  CHECK_EQ(7, static_cast<int>(res));
+  res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, 9, -2, 0, 0, 0));
+  CHECK_EQ(9, static_cast<int>(res));
+}
+
+// Search string: index of the first 'o' in a buffer, or -1.
+TEST(13) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  Assembler assm(isolate, NULL, 0);
+  Label loop, found;
+
+  // r2: start of the buffer, r3: length.
+  __ la(r3, MemOperand(r2, r3, 0));
+  __ lghi(r0, Operand('o'));
+  __ bind(&loop);
+  __ srst(r3, r2);
+  __ b(overflow, &loop);  // CC3: Search interrupted, resume.
+  __ b(lt, &found);       // CC1: Character found at r3.
+  __ lghi(r2, Operand(-1));
+  __ b(r14);
+  __ bind(&found);
+  __ sgr(r3, r2);
+  __ lgr(r2, r3);
+  __ b(r14);
+
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+#ifdef DEBUG
+  code->Print();
+#endif
+  F3 f = FUNCTION_CAST<F3>(code->entry());
+  const char* strings[] = {"", "o", "xyz", "hello world",
+                           "the quick brown fox jumps over the lazy dog"};
+  for (size_t i = 0; i < arraysize(strings); i++) {
+    char buffer[64] = {0};
+    strncpy(buffer, strings[i], sizeof(buffer) - 1);
+    intptr_t res = reinterpret_cast<intptr_t>(CALL_GENERATED_CODE(
+        isolate, f, buffer, static_cast<int>(strlen(strings[i])), 0, 0, 0));
+    ::printf("f(\"%s\") = %" V8PRIdPTR "\n", strings[i], res);
+    const char* expected = strchr(strings[i], 'o');
+    CHECK_EQ(expected == NULL ? -1 : expected - strings[i], res);
+  }
+}
+
+// Compare logical character with a length supplied by execute: memcmp.
+TEST(14) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  Assembler assm(isolate, NULL, 0);
+  Label clc_template, less, greater;
+
+  // r2, r3: operands, r4: length between 1 and 256.
+  __ larl(r1, &clc_template);
+  __ lay(r4, MemOperand(r4, -1));
+  __ ex(r4, MemOperand(r1));
+  __ b(lt, &less);
+  __ b(gt, &greater);
+  __ lghi(r2, Operand::Zero());
+  __ b(r14);
+  __ bind(&less);
+  __ lghi(r2, Operand(-1));
+  __ b(r14);
+  __ bind(&greater);
+  __ lghi(r2, Operand(1));
+  __ b(r14);
+  __ bind(&clc_template);
+  __ clc(MemOperand(r2), MemOperand(r3), 1);
+
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+#ifdef DEBUG
+  code->Print();
+#endif
+  F4 f = FUNCTION_CAST<F4>(code->entry());
+  char left[256];
+  char right[256];
+  for (int i = 0; i < 256; i++) left[i] = right[i] = static_cast<char>(i);
+  intptr_t res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, left, right, 256, 0, 0));
+  CHECK_EQ(0, static_cast<int>(res));
+  right[200] = 0;
+  res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, left, right, 200, 0, 0));
+  CHECK_EQ(0, static_cast<int>(res));
+  res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, left, right, 201, 0, 0));
+  CHECK_EQ(1, static_cast<int>(res));
+  res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, right, left, 256, 0, 0));
+  CHECK_EQ(-1, static_cast<int>(res));
+}
+
+// Patched instructions must not run with a stale simulator decoding.
+TEST(15) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  Assembler assm(isolate, NULL, 0);
+
+  __ lhi(r2, Operand(5));
+  __ b(r14);
+
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+#ifdef DEBUG
+  code->Print();
+#endif
+  F2 f = FUNCTION_CAST<F2>(code->entry());
+  for (int i = 0; i < 2; i++) {
+    intptr_t res = reinterpret_cast<intptr_t>(
+        CALL_GENERATED_CODE(isolate, f, 1, 2, 0, 0, 0));
+    CHECK_EQ(5, static_cast<int>(res));
+  }
+
+  {
+    CodePatcher patcher(isolate, code->instruction_start(), 4);
+    patcher.masm()->lgr(r2, r3);
+  }
+  intptr_t res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, 1, 2, 0, 0, 0));
+  CHECK_EQ(2, static_cast<int>(res));
+
+  {
+    CodePatcher patcher(isolate, code->instruction_start(), 4);
+    patcher.masm()->ahi(r2, Operand(10));
+  }
+  res = reinterpret_cast<intptr_t>(
+      CALL_GENERATED_CODE(isolate, f, 1, 2, 0, 0, 0));
+  CHECK_EQ(11, static_cast<int>(res));
+}
+
+// Translate and test: index of the first digit, or -1.
+TEST(16) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  Assembler assm(isolate, NULL, 0);
+  Label trt_template, found;
+
+  // r2: start of the buffer, r3: table, r4: length between 1 and 256.
+  __ lgr(r5, r2);
+  __ larl(r1, &trt_template);
+  __ lay(r4, MemOperand(r4, -1));
+  __ ex(r4, MemOperand(r1));
+  __ b(ne, &found);
+  __ lghi(r2, Operand(-1));
+  __ b(r14);
+  __ bind(&found);
+  __ sgr(r1, r5);
+  __ lgr(r2, r1);
+  __ b(r14);
+  __ bind(&trt_template);
+  __ trt(MemOperand(r2), MemOperand(r3), 1);
+
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+#ifdef DEBUG
+  code->Print();
+#endif
+  F4 f = FUNCTION_CAST<F4>(code->entry());
+  char table[256] = {0};
+  for (int c = '0'; c <= '9'; c++) table[c] = 1;
+  const char* strings[] = {"7", "x", "abc1", "no digits here",
+                           "the 2nd of 3"};
+  for (size_t i = 0; i < arraysize(strings); i++) {
+    intptr_t res = reinterpret_cast<intptr_t>(CALL_GENERATED_CODE(
+        isolate, f, const_cast<char*>(strings[i]), table,
+        static_cast<int>(strlen(strings[i])), 0, 0));
+    ::printf("f(\"%s\") = %" V8PRIdPTR "\n", strings[i], res);
+    const char* expected = strpbrk(strings[i], "0123456789");
+    CHECK_EQ(expected == NULL ? -1 : expected - strings[i], res);
+  }
+}
+
+#ifdef USE_SIMULATOR
+// The --sim-profile profile keeps one row per code object across GCs.
+UNINITIALIZED_TEST(SimulatorProfile) {
+  FLAG_sim_profile = true;
+  FLAG_never_compact = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* v8_isolate = v8::Isolate::New(create_params);
+  v8_isolate->Enter();
+  {
+    Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+    HandleScope scope(isolate);
+
+    Assembler assm(isolate, NULL, 0);
+
+    __ lhi(r1, Operand(3));
+    __ llilf(r2, Operand(4));
+    __ lgr(r2, r2);
+    __ ar(r2, r1);
+    __ b(r14);
+    const uint64_t kInstructions = 5;
+
+    CodeDesc desc;
+    assm.GetCode(&desc);
+    Handle<Code> code = isolate->factory()->NewCode(
+        desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+    F2 f = FUNCTION_CAST<F2>(code->entry());
+    // Run once before a mark-compact, once before a scavenge and once after.
+    for (int i = 0; i < 3; i++) {
+      if (i == 1) isolate->heap()->CollectAllGarbage();
+      if (i == 2) isolate->heap()->CollectGarbage(NEW_SPACE);
+      intptr_t res = reinterpret_cast<intptr_t>(
+          CALL_GENERATED_CODE(isolate, f, 3, 4, 0, 0, 0));
+      CHECK_EQ(7, static_cast<int>(res));
+    }
+
+    FILE* out = tmpfile();
+    CHECK_NOT_NULL(out);
+    Simulator::current(isolate)->PrintProfile(out);
+    rewind(out);
+
+    std::ostringstream os;
+    os << " " << static_cast<void*>(code->instruction_start());
+    std::string address = os.str();
+    int rows = 0;
+    char line[1024];
+    while (fgets(line, sizeof(line), out) != NULL) {
+      std::string row(line);
+      if (row.find(address) == std::string::npos) continue;
+      rows++;
+      uint64_t instructions = 0;
+      CHECK_EQ(1, sscanf(line, "%" SCNu64, &instructions));
+      CHECK_EQ(3 * kInstructions, instructions);
+    }
+    fclose(out);
+    CHECK_EQ(1, rows);
+  }
+  v8_isolate->Exit();
+  v8_isolate->Dispose();
+}
+#endif  // USE_SIMULATOR
+
+
 #if 0
 TEST(4) {
   CcTest::InitializeVM();
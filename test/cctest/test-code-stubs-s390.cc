@@ -0,0 +1,220 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include "src/v8.h"
+
+#include "src/base/platform/platform.h"
+#include "src/code-stubs.h"
+#include "src/factory.h"
+#include "src/macro-assembler.h"
+#include "src/simulator.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/test-code-stubs.h"
+
+using namespace v8::internal;
+
+#define __ masm.
+
+// Upper bounds on the instructions executed by one DoubleToIStub call,
+// including the call and return, when the conversion instruction produces an
+// int32 and when the stub has to take the double apart itself. The counts
+// are only available when running on the simulator.
+static const int64_t kMaxDToIFastPath = 20;
+static const int64_t kMaxDToISlowPath = 72;
+
+ConvertDToIFunc MakeConvertDToIFuncTrampoline(Isolate* isolate,
+                                              Register source_reg,
+                                              Register destination_reg,
+                                              bool inline_fastpath,
+                                              bool call_stub = true) {
+  // Allocate an executable page of memory.
+  size_t actual_size;
+  byte* buffer = static_cast<byte*>(v8::base::OS::Allocate(
+      Assembler::kMinimalBufferSize, &actual_size, true));
+  CHECK(buffer);
+  HandleScope handles(isolate);
+  MacroAssembler masm(isolate, buffer, static_cast<int>(actual_size),
+                      v8::internal::CodeObjectRequired::kYes);
+  DoubleToIStub stub(isolate, source_reg, destination_reg, 0, true,
+                     inline_fastpath);
+
+  byte* start = stub.GetCode()->instruction_start();
+  Label done;
+
+  // Save callee save registers.
+  __ MultiPush(kCalleeSaved | r14.bit());
+
+  // Push the double argument.
+  __ lay(sp, MemOperand(sp, -kDoubleSize));
+  __ StoreDouble(d0, MemOperand(sp));
+  if (!source_reg.is(sp)) {
+    __ LoadRR(source_reg, sp);
+  }
+
+  // Save registers make sure they don't get clobbered.
+  int source_reg_offset = kDoubleSize;
+  int reg_num = 0;
+  for (; reg_num < Register::kNumRegisters; ++reg_num) {
+    Register reg = Register::from_code(reg_num);
+    if (reg.IsAllocatable()) {
+      if (!reg.is(destination_reg)) {
+        __ push(reg);
+        source_reg_offset += kPointerSize;
+      }
+    }
+  }
+
+  // Re-push the double argument.
+  __ lay(sp, MemOperand(sp, -kDoubleSize));
+  __ StoreDouble(d0, MemOperand(sp));
+
+  // Call through to the actual stub
+  if (inline_fastpath) {
+    __ LoadDouble(d0, MemOperand(source_reg));
+    __ TryInlineTruncateDoubleToI(destination_reg, d0, &done);
+    if (destination_reg.is(source_reg) && !source_reg.is(sp)) {
+      // Restore clobbered source_reg.
+      __ lay(source_reg, MemOperand(sp, source_reg_offset));
+    }
+  }
+  if (call_stub) {
+    __ Call(start, RelocInfo::EXTERNAL_REFERENCE);
+  }
+  __ bind(&done);
+
+  __ la(sp, MemOperand(sp, kDoubleSize));
+
+  // Make sure no registers have been unexpectedly clobbered
+  for (--reg_num; reg_num >= 0; --reg_num) {
+    Register reg = Register::from_code(reg_num);
+    if (reg.IsAllocatable()) {
+      if (!reg.is(destination_reg)) {
+        __ LoadP(ip, MemOperand(sp, 0));
+        __ CmpP(reg, ip);
+        __ Assert(eq, kRegisterWasClobbered);
+        __ la(sp, MemOperand(sp, kPointerSize));
+      }
+    }
+  }
+
+  __ la(sp, MemOperand(sp, kDoubleSize));
+
+  if (!destination_reg.is(r2)) __ LoadRR(r2, destination_reg);
+
+  // Restore callee save registers.
+  __ MultiPop(kCalleeSaved | r14.bit());
+
+  __ Ret();
+
+  CodeDesc desc;
+  masm.GetCode(&desc);
+  Assembler::FlushICache(isolate, buffer, actual_size);
+  return (reinterpret_cast<ConvertDToIFunc>(
+      reinterpret_cast<intptr_t>(buffer)));
+}
+
+#undef __
+
+
+static Isolate* GetIsolateFrom(LocalContext* context) {
+  return reinterpret_cast<Isolate*>((*context)->GetIsolate());
+}
+
+
+int32_t RunGeneratedCodeCallWrapper(ConvertDToIFunc func,
+                                    double from) {
+#ifdef USE_SIMULATOR
+  return CALL_GENERATED_FP_INT(CcTest::i_isolate(), func, from, 0);
+#else
+  return (*func)(from);
+#endif
+}
+
+
+#ifdef USE_SIMULATOR
+// Returns the number of instructions the trampoline executes to convert
+// |from|, less the instructions of the same trampoline without the stub call.
+static int64_t CountStubInstructions(Isolate* isolate, ConvertDToIFunc func,
+                                     ConvertDToIFunc baseline, double from) {
+  Simulator* simulator = Simulator::current(isolate);
+  int64_t start = simulator->icount();
+  RunGeneratedCodeCallWrapper(baseline, from);
+  int64_t overhead = simulator->icount() - start;
+  start = simulator->icount();
+  int32_t result = RunGeneratedCodeCallWrapper(func, from);
+  CHECK_EQ(ConvertDToICVersion(from), result);
+  return simulator->icount() - start - overhead;
+}
+#endif
+
+
+TEST(ConvertDToI) {
+  CcTest::InitializeVM();
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  HandleScope scope(isolate);
+
+#if DEBUG
+  // Verify that the tests actually work with the C version. In the release
+  // code, the compiler optimizes it away because it's all constant, but does it
+  // wrong, triggering an assert on gcc.
+  RunAllTruncationTests(&ConvertDToICVersion);
+#endif
+
+  Register source_registers[] = {sp, r2, r3, r4, r5, r6, r7, r8, r9, r13};
+  Register dest_registers[] = {r2, r3, r4, r5, r6, r7, r8, r9, r13};
+
+  for (size_t s = 0; s < sizeof(source_registers) / sizeof(Register); s++) {
+    for (size_t d = 0; d < sizeof(dest_registers) / sizeof(Register); d++) {
+      RunAllTruncationTests(
+          RunGeneratedCodeCallWrapper,
+          MakeConvertDToIFuncTrampoline(isolate,
+                                        source_registers[s],
+                                        dest_registers[d],
+                                        false));
+      RunAllTruncationTests(
+          RunGeneratedCodeCallWrapper,
+          MakeConvertDToIFuncTrampoline(isolate,
+                                        source_registers[s],
+                                        dest_registers[d],
+                                        true));
+    }
+  }
+}
+
+
+#ifdef USE_SIMULATOR
+TEST(ConvertDToIInstructionCount) {
+  CcTest::InitializeVM();
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  HandleScope scope(isolate);
+
+  ConvertDToIFunc func =
+      MakeConvertDToIFuncTrampoline(isolate, r3, r2, false);
+  ConvertDToIFunc baseline =
+      MakeConvertDToIFuncTrampoline(isolate, r3, r2, false, false);
+
+  // Values that fit in an int32 are converted by a single instruction.
+  static const double kFastPathInputs[] = {0.0, -0.0, 1.5, -2147483648.0,
+                                           2147483647.9, -123456.789};
+  for (size_t i = 0; i < arraysize(kFastPathInputs); i++) {
+    CHECK_LE(CountStubInstructions(isolate, func, baseline,
+                                   kFastPathInputs[i]),
+             kMaxDToIFastPath);
+  }
+
+  // Everything else is truncated modulo 2^32 by hand.
+  static const double kSlowPathInputs[] = {
+      4294967296.0 * 3 + 7, -4294967296.0 * 5 - 11, 2147483648.0,
+      9007199254740992.0 * 1024, 1e30, -1e300};
+  for (size_t i = 0; i < arraysize(kSlowPathInputs); i++) {
+    CHECK_LE(CountStubInstructions(isolate, func, baseline,
+                                   kSlowPathInputs[i]),
+             kMaxDToISlowPath);
+  }
+}
+#endif
@@ -208,6 +208,10 @@ TEST(FourBytes) {
           "4b812006       sh\tr8,6(r1,r2)");
   COMPARE(mh(r5, MemOperand(r9, r8, 7)),
           "4c598007       mh\tr5,7(r9,r8)");
+  COMPARE(locr(eq, r1, r2),
+          "b9f28012       locr\tr1,r2,0x8");
+  COMPARE(locgr(ne, r3, r4),
+          "b9e27034       locgr\tr3,r4,0x7");
 
   VERIFY_RUN();
 }
@@ -409,6 +413,85 @@ TEST(SixBytes) {
           "c00b00001f40   nilf\tr0,8000");
   COMPARE(oilf(r9, Operand(1000)),
           "c09d000003e8   oilf\tr9,1000");
+  COMPARE(loc(lt, r2, MemOperand(r3, 100)),
+          "eb24306400f2   loc\tr2,100(r3),0x4");
+  COMPARE(stocg(ge, r5, MemOperand(sp, 8)),
+          "eb5af00800e3   stocg\tr5,8(sp),0xa");
+
+  VERIFY_RUN();
+}
+
+TEST(StringInstructions) {
+  SET_UP();
+
+  COMPARE(clc(MemOperand(r2, 0), MemOperand(r3, 8), 16),
+          "d50f20003008   clc\t0(15,r2),8(r3)");
+  COMPARE(srst(r3, r2), "b25e0032       srst\tr3,r2");
+  COMPARE(ex(r4, MemOperand(r1, 0)), "44401000       ex\tr4,0(r1)");
+  COMPARE(trt(MemOperand(r4, 0), MemOperand(r3, 0), 256),
+          "ddff40003000   trt\t0(255,r4),0(r3)");
+
+  VERIFY_RUN();
+}
+
+TEST(Atomics) {
+  SET_UP();
+
+  COMPARE(cs(r2, r3, MemOperand(r1, 0)), "ba231000       cs\tr2,r3,0(r1)");
+  COMPARE(csy(r2, r3, MemOperand(r4, 8)),
+          "eb2340080014   csy\tr2,r3,8(r4)");
+  COMPARE(csg(r2, r3, MemOperand(r4, 8)),
+          "eb2340080030   csg\tr2,r3,8(r4)");
+  COMPARE(laa(r5, r6, MemOperand(r1, 0)),
+          "eb56100000f8   laa\tr5,r6,0(r1)");
+  COMPARE(lan(r5, r6, MemOperand(r1, 0)),
+          "eb56100000f4   lan\tr5,r6,0(r1)");
+  COMPARE(lao(r5, r6, MemOperand(r1, 0)),
+          "eb56100000f6   lao\tr5,r6,0(r1)");
+  COMPARE(lax(r5, r6, MemOperand(r1, 0)),
+          "eb56100000f7   lax\tr5,r6,0(r1)");
+
+  VERIFY_RUN();
+}
+
+TEST(Vector) {
+  SET_UP();
+
+  COMPARE(vl(v1, MemOperand(r2, 0)), "e71020000006   vl\tv1,0(r2)");
+  COMPARE(vl(v17, MemOperand(r3, r4, 16)),
+          "e71340100806   vl\tv17,16(r3,r4)");
+  COMPARE(vst(v31, MemOperand(sp, 8)), "e7f0f008080e   vst\tv31,8(sp)");
+  COMPARE(vll(v2, r3, MemOperand(r4, 0)), "e72340000037   vll\tv2,r3,0(r4)");
+  COMPARE(vstl(v2, r3, MemOperand(r4, 4)),
+          "e7234004003f   vstl\tv2,r3,4(r4)");
+  COMPARE(vlr(v1, v17), "e71100000456   vlr\tv1,v17");
+  COMPARE(vlrep(v3, MemOperand(r5, 2), Condition(2)),
+          "e73050022005   vlrep\tv3,2(r5),2");
+  COMPARE(vgbm(v4, Operand(0xFFFF)), "e740ffff0044   vgbm\tv4,65535");
+  COMPARE(vlgv(r2, v5, MemOperand(r0, 7), Condition(0)),
+          "e72500070021   vlgv\tr2,v5,7(r0),0");
+  COMPARE(vlvg(v6, r7, MemOperand(r0, 1), Condition(3)),
+          "e76700013022   vlvg\tv6,r7,1(r0),3");
+  COMPARE(vrep(v1, v2, Operand(3), Condition(0)),
+          "e7120003004d   vrep\tv1,v2,3,0");
+  COMPARE(vrepi(v1, Operand(-1), Condition(1)),
+          "e710ffff1045   vrepi\tv1,-1,1");
+  COMPARE(va(v1, v2, v3, Condition(2)), "e712300020f3   va\tv1,v2,v3,2");
+  COMPARE(vs(v16, v17, v18, Condition(3)),
+          "e70120003ef7   vs\tv16,v17,v18,3");
+  COMPARE(vn(v1, v2, v3), "e71230000068   vn\tv1,v2,v3");
+  COMPARE(vo(v1, v2, v3), "e7123000006a   vo\tv1,v2,v3");
+  COMPARE(vx(v1, v2, v3), "e7123000006d   vx\tv1,v2,v3");
+  COMPARE(vceq(v1, v2, v3, Condition(0), Condition(1)),
+          "e712301000f8   vceq\tv1,v2,v3,0,1");
+  COMPARE(vfae(v1, v2, v3, Condition(0), Condition(4)),
+          "e71230400082   vfae\tv1,v2,v3,0,4");
+  COMPARE(vfee(v16, v1, v2, Condition(0), Condition(3)),
+          "e70120300880   vfee\tv16,v1,v2,0,3");
+  COMPARE(vfene(v1, v2, v3, Condition(1), Condition(1)),
+          "e71230101081   vfene\tv1,v2,v3,1,1");
+  COMPARE(vistr(v1, v2, Condition(0), Condition(1)),
+          "e7120010005c   vistr\tv1,v2,0,1");
 
   VERIFY_RUN();
 }
@@ -749,6 +749,24 @@ TEST(DisasmX64) {
     __ xchgq(rax, rbx);
     __ xchgq(rbx, rbx);
     __ xchgq(rbx, Operand(rsp, 12));
+    __ xchgb(rax, Operand(rbx, rcx, times_1, 0));
+    __ xchgw(rax, Operand(rbx, rcx, times_1, 0));
+  }
+
+  // Atomic read-modify-write.
+  {
+    __ lock();
+    __ cmpxchgb(Operand(rbx, rcx, times_1, 0), rdx);
+    __ lock();
+    __ cmpxchgw(Operand(rbx, rcx, times_1, 0), rdx);
+    __ lock();
+    __ cmpxchgl(Operand(rbx, rcx, times_1, 0), rdx);
+    __ lock();
+    __ xaddb(Operand(rbx, rcx, times_1, 0), rdx);
+    __ lock();
+    __ xaddw(Operand(rbx, rcx, times_1, 0), rdx);
+    __ lock();
+    __ xaddl(Operand(rbx, rcx, times_1, 0), rdx);
   }
 
   // Nop instructions
@@ -0,0 +1,221 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include "src/v8.h"
+#include "test/cctest/cctest.h"
+
+#include "src/macro-assembler.h"
+
+#include "src/s390/macro-assembler-s390.h"
+#include "src/s390/simulator-s390.h"
+
+
+using namespace v8::internal;
+
+typedef void* (*F)(void* x, void* y, intptr_t p2, int p3, int p4);
+typedef Object* (*F4)(void* p0, void* p1, int p2, int p3, int p4);
+
+#define __ masm->
+
+
+// Upper bounds on the instructions executed by the sequences under test. The
+// counts are only available when running on the simulator.
+static const int64_t kCopyBytesPerBlock = 7;  // Per 256 byte MVC.
+static const int64_t kCopyBytesTail = 8;      // EX'd MVC of 1 to 255 bytes.
+static const int64_t kWriteBarrierSmi = 4;
+static const int64_t kWriteBarrierOldToOld = 12;
+static const int64_t kWriteBarrierOldToNew = 48;
+
+
+static int64_t ExecutedInstructions(Isolate* isolate) {
+#ifdef USE_SIMULATOR
+  return Simulator::current(isolate)->icount();
+#else
+  return 0;
+#endif
+}
+
+
+static byte to_non_zero(int n) {
+  return static_cast<unsigned>(n) % 255 + 1;
+}
+
+
+static bool all_zeroes(const byte* beg, const byte* end) {
+  CHECK(beg);
+  CHECK(beg <= end);
+  while (beg < end) {
+    if (*beg++ != 0)
+      return false;
+  }
+  return true;
+}
+
+
+TEST(CopyBytes) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope handles(isolate);
+
+  const int data_size = 2 * KB;
+  size_t act_size;
+
+  // Allocate two blocks to copy data between.
+  byte* src_buffer =
+      static_cast<byte*>(v8::base::OS::Allocate(data_size, &act_size, 0));
+  CHECK(src_buffer);
+  CHECK(act_size >= static_cast<size_t>(data_size));
+  byte* dest_buffer =
+      static_cast<byte*>(v8::base::OS::Allocate(data_size, &act_size, 0));
+  CHECK(dest_buffer);
+  CHECK(act_size >= static_cast<size_t>(data_size));
+
+  // Storage for R2 and R3.
+  byte* r2_;
+  byte* r3_;
+
+  MacroAssembler assembler(isolate, NULL, 0,
+                           v8::internal::CodeObjectRequired::kYes);
+  MacroAssembler* masm = &assembler;
+
+  // Code to be generated: The stuff in CopyBytes followed by a store of R2 and
+  // R3, respectively.
+  __ CopyBytes(r2, r3, r4, r5);
+  __ mov(r4, Operand(reinterpret_cast<intptr_t>(&r2_)));
+  __ mov(r5, Operand(reinterpret_cast<intptr_t>(&r3_)));
+  __ StoreP(r2, MemOperand(r4));
+  __ StoreP(r3, MemOperand(r5));
+  __ Ret();
+
+  CodeDesc desc;
+  masm->GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+
+  F f = FUNCTION_CAST<F>(code->entry());
+
+  // Initialise source data with non-zero bytes.
+  for (int i = 0; i < data_size; i++) {
+    src_buffer[i] = to_non_zero(i);
+  }
+
+  // Instructions executed by a copy of zero bytes, i.e. everything but the
+  // MVC loop and the tail.
+  int64_t start = ExecutedInstructions(isolate);
+  (void)CALL_GENERATED_CODE(isolate, f, src_buffer, dest_buffer, 0, 0, 0);
+  int64_t overhead = ExecutedInstructions(isolate) - start;
+
+  const int fuzz = 11;
+
+  for (int size = 0; size < 1200; size++) {
+    int64_t limit = overhead + kCopyBytesPerBlock * (size >> 8);
+    if ((size & 0xff) != 0) limit += kCopyBytesTail;
+    for (const byte* src = src_buffer; src < src_buffer + fuzz; src++) {
+      for (byte* dest = dest_buffer; dest < dest_buffer + fuzz; dest++) {
+        memset(dest_buffer, 0, data_size);
+        CHECK(dest + size < dest_buffer + data_size);
+        start = ExecutedInstructions(isolate);
+        (void)CALL_GENERATED_CODE(isolate, f, const_cast<byte*>(src), dest,
+                                  static_cast<intptr_t>(size), 0, 0);
+        CHECK_LE(ExecutedInstructions(isolate) - start, limit);
+        // R2 and R3 should point at the first byte after the copied data.
+        CHECK_EQ(src + size, r2_);
+        CHECK_EQ(dest + size, r3_);
+        // Check that we haven't written outside the target area.
+        CHECK(all_zeroes(dest_buffer, dest));
+        CHECK(all_zeroes(dest + size, dest_buffer + data_size));
+        // Check the target area.
+        CHECK_EQ(0, memcmp(src, dest, size));
+      }
+    }
+  }
+
+  // Check that the source data hasn't been clobbered.
+  for (int i = 0; i < data_size; i++) {
+    CHECK(src_buffer[i] == to_non_zero(i));
+  }
+}
+
+
+// Stores the value in r3 into the first element of the FixedArray in r2 and
+// records the write.
+static F4 GenerateStoreWithWriteBarrier(Isolate* isolate) {
+  MacroAssembler assembler(isolate, NULL, 0,
+                           v8::internal::CodeObjectRequired::kYes);
+  MacroAssembler* masm = &assembler;
+  // Keep the instruction counts independent of --debug-code.
+  masm->set_emit_debug_code(false);
+
+  __ StoreP(r3, FieldMemOperand(r2, FixedArray::kHeaderSize));
+  __ RecordWriteField(r2, FixedArray::kHeaderSize, r3, r4, kLRHasNotBeenSaved,
+                      kDontSaveFPRegs);
+  __ Ret();
+
+  CodeDesc desc;
+  masm->GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+  return FUNCTION_CAST<F4>(code->entry());
+}
+
+
+static int64_t RunStoreWithWriteBarrier(Isolate* isolate, F4 f,
+                                        Handle<FixedArray> array,
+                                        Handle<Object> value) {
+  int64_t start = ExecutedInstructions(isolate);
+  (void)CALL_GENERATED_CODE(isolate, f, *array, *value, 0, 0, 0);
+  CHECK_EQ(*value, array->get(0));
+  return ExecutedInstructions(isolate) - start;
+}
+
+
+TEST(RecordWriteField) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  HandleScope handles(isolate);
+
+  F4 f = GenerateStoreWithWriteBarrier(isolate);
+
+  Handle<FixedArray> array = factory->NewFixedArray(1, TENURED);
+  CHECK(!heap->InNewSpace(*array));
+
+  // Smis skip the barrier altogether.
+  Handle<Object> smi(Smi::FromInt(42), isolate);
+  int64_t smi_count = RunStoreWithWriteBarrier(isolate, f, array, smi);
+
+  // Old-to-old stores are filtered out by the page flag checks.
+  Handle<HeapNumber> old_value = factory->NewHeapNumber(1.5, MUTABLE, TENURED);
+  CHECK(!heap->InNewSpace(*old_value));
+  int64_t old_count = RunStoreWithWriteBarrier(isolate, f, array, old_value);
+
+  // Old-to-new stores call the RecordWriteStub, which adds the slot to the
+  // store buffer.
+  Handle<HeapNumber> new_value = factory->NewHeapNumber(2.5);
+  CHECK(heap->InNewSpace(*new_value));
+  int64_t new_count = RunStoreWithWriteBarrier(isolate, f, array, new_value);
+
+  // The scavenger has to find the slot through the store buffer to update it.
+  heap->CollectGarbage(NEW_SPACE);
+  CHECK_EQ(*new_value, array->get(0));
+  CHECK_EQ(2.5, HeapNumber::cast(array->get(0))->value());
+
+#ifdef USE_SIMULATOR
+  CHECK_LT(smi_count, old_count);
+  CHECK_LT(old_count, new_count);
+  // The generated code adds the StoreP and the return to each count.
+  CHECK_LE(smi_count, kWriteBarrierSmi + 2);
+  CHECK_LE(old_count, kWriteBarrierOldToOld + 2);
+  CHECK_LE(new_count, kWriteBarrierOldToNew + 2);
+#else
+  USE(smi_count);
+  USE(old_count);
+  USE(new_count);
+#endif
+}
+
+#undef __
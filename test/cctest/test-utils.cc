@@ -32,6 +32,7 @@
 #include "src/v8.h"
 
 #include "src/base/platform/platform.h"
+#include "src/json-chars.h"
 #include "test/cctest/cctest.h"
 
 using namespace v8::internal;
@@ -189,6 +190,70 @@ TEST(MemMove) {
 }
 
 
+template <typename Char>
+static void TestJsonSpecialCharStart(Char filler) {
+  static const int kMaxLength = 80;
+  static const Char kSpecials[] = {'"', '\\', 0, '\n', 0x1f};
+  Char chars[kMaxLength + sizeof(uintptr_t)];
+  for (int offset = 0; offset < static_cast<int>(sizeof(uintptr_t));
+       offset++) {
+    for (int length = 0; length <= kMaxLength; length++) {
+      Char* start = chars + offset;
+      for (int i = 0; i < length; i++) start[i] = filler;
+      CHECK_EQ(length, JsonSpecialCharStart(start, length));
+      for (size_t s = 0; s < arraysize(kSpecials); s++) {
+        for (int i = 0; i < length; i++) {
+          start[i] = kSpecials[s];
+          CHECK_EQ(i, JsonSpecialCharStart(start, length));
+          // A second special character further on does not matter.
+          if (i + 1 < length) {
+            start[length - 1] = '"';
+            CHECK_EQ(i, JsonSpecialCharStart(start, length));
+            start[length - 1] = filler;
+          }
+          start[i] = filler;
+        }
+      }
+    }
+  }
+}
+
+
+template <typename Char>
+static uintptr_t RepeatChar(Char c) {
+  uintptr_t word = 0;
+  for (size_t i = 0; i < sizeof(uintptr_t) / sizeof(Char); i++) {
+    word = (word << (8 * sizeof(Char))) | c;
+  }
+  return word;
+}
+
+
+TEST(JsonSpecialCharStart) {
+  TestJsonSpecialCharStart<uint8_t>('a');
+  TestJsonSpecialCharStart<uint8_t>(' ');
+  TestJsonSpecialCharStart<uint8_t>(0xff);
+  TestJsonSpecialCharStart<uc16>('a');
+  TestJsonSpecialCharStart<uc16>(0x2022);
+  TestJsonSpecialCharStart<uc16>(0xffff);
+
+  // The word at a time check, which the vector check replaces on some hosts.
+  for (int c = 0; c <= 0xff; c++) {
+    bool special = c < 0x20 || c == '"' || c == '\\';
+    CHECK_EQ(special, JsonSpecialCharLanes<uint8_t>(RepeatChar<uint8_t>(c)) !=
+                          0);
+    CHECK_EQ(special, JsonSpecialCharLanes<uint8_t>(
+                          (RepeatChar<uint8_t>('a') << 8) | c) != 0);
+  }
+  for (int c = 0; c <= 0xffff; c++) {
+    bool special = c < 0x20 || c == '"' || c == '\\';
+    CHECK_EQ(special, JsonSpecialCharLanes<uc16>(RepeatChar<uc16>(c)) != 0);
+    CHECK_EQ(special, JsonSpecialCharLanes<uc16>(
+                          (RepeatChar<uc16>(0x2022) << 16) | c) != 0);
+  }
+}
+
+
 TEST(Collector) {
   Collector<int> collector(8);
   const int kLoops = 5;
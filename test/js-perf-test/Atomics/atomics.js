@@ -0,0 +1,84 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Single-threaded throughput of the Atomics operations on shared typed arrays
+// that are global constants, which lets optimized code access the shared
+// memory directly instead of calling into the runtime.
+
+new BenchmarkSuite('LoadStore', [1000], [
+  new Benchmark('LoadStore', false, false, 0,
+                LoadStore, Setup, TearDown)
+]);
+
+new BenchmarkSuite('AddInt32', [1000], [
+  new Benchmark('AddInt32', false, false, 0,
+                AddInt32, Setup, TearDown)
+]);
+
+new BenchmarkSuite('AddUint8', [1000], [
+  new Benchmark('AddUint8', false, false, 0,
+                AddUint8, Setup, TearDown)
+]);
+
+new BenchmarkSuite('CompareExchange', [1000], [
+  new Benchmark('CompareExchange', false, false, 0,
+                CompareExchange, Setup, TearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+var N = 1024;
+var sab = new SharedArrayBuffer(N * 4);
+var i32 = new Int32Array(sab);
+var u8 = new Uint8Array(sab);
+var result;
+var expected;
+
+function Setup() {
+  for (var i = 0; i < N; ++i) i32[i] = 0;
+  result = undefined;
+  expected = undefined;
+}
+
+function TearDown() {
+  if (result !== expected) {
+    throw new Error('Unexpected result: ' + result + ' != ' + expected);
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+function LoadStore() {
+  var sum = 0;
+  for (var i = 0; i < N; ++i) Atomics.store(i32, i, i);
+  for (var i = 0; i < N; ++i) sum += Atomics.load(i32, i);
+  result = sum;
+  expected = N * (N - 1) / 2;
+}
+
+function AddInt32() {
+  var sum = 0;
+  for (var i = 0; i < N; ++i) sum += Atomics.add(i32, i, 1);
+  for (var i = 0; i < N; ++i) Atomics.sub(i32, i, 1);
+  result = sum;
+  expected = 0;
+}
+
+function AddUint8() {
+  var sum = 0;
+  for (var i = 0; i < N; ++i) sum += Atomics.add(u8, i, 1);
+  for (var i = 0; i < N; ++i) Atomics.sub(u8, i, 1);
+  result = sum;
+  expected = 0;
+}
+
+function CompareExchange() {
+  var swapped = 0;
+  for (var i = 0; i < N; ++i) {
+    if (Atomics.compareExchange(i32, i, 0, 1) === 0) ++swapped;
+  }
+  for (var i = 0; i < N; ++i) Atomics.compareExchange(i32, i, 1, 0);
+  result = swapped;
+  expected = N;
+}
@@ -0,0 +1,139 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Loops whose bodies mix independent loads with long latency arithmetic, so
+// that their speed depends on how well the instruction scheduler interleaves
+// them. Compare the scores with and without --turbo-instruction-scheduling.
+
+new BenchmarkSuite('DotProduct', [1000], [
+  new Benchmark('DotProduct', false, false, 0,
+                DotProduct, DotProductSetup, DotProductTearDown)
+]);
+
+new BenchmarkSuite('IntDivide', [1000], [
+  new Benchmark('IntDivide', false, false, 0,
+                IntDivide, IntDivideSetup, IntDivideTearDown)
+]);
+
+new BenchmarkSuite('Normalize', [1000], [
+  new Benchmark('Normalize', false, false, 0,
+                Normalize, NormalizeSetup, NormalizeTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+var N = 1024;
+var result;
+var expected;
+
+// ----------------------------------------------------------------------------
+
+var xs;
+var ys;
+
+function dot(a, b) {
+  var s0 = 0;
+  var s1 = 0;
+  for (var i = 0; i < a.length; i += 2) {
+    s0 += a[i] * b[i];
+    s1 += a[i + 1] * b[i + 1];
+  }
+  return s0 + s1;
+}
+
+function DotProductSetup() {
+  xs = new Float64Array(N);
+  ys = new Float64Array(N);
+  expected = 0;
+  for (var i = 0; i < N; i++) {
+    xs[i] = i * 0.5;
+    ys[i] = (N - i) * 0.25;
+    // All products and sums are exact, so the order does not matter.
+    expected += xs[i] * ys[i];
+  }
+}
+
+function DotProduct() {
+  result = dot(xs, ys);
+}
+
+function DotProductTearDown() {
+  return result === expected;
+}
+
+// ----------------------------------------------------------------------------
+
+var dividends;
+var divisors;
+
+function divide(a, b) {
+  var q = 0;
+  var r = 0;
+  for (var i = 0; i < a.length; i++) {
+    var x = a[i] | 0;
+    var y = b[i] | 0;
+    q = (q + ((x / y) | 0)) | 0;
+    r = (r + (x % y)) | 0;
+  }
+  return q ^ r;
+}
+
+function IntDivideSetup() {
+  dividends = new Int32Array(N);
+  divisors = new Int32Array(N);
+  var q = 0;
+  var r = 0;
+  for (var i = 0; i < N; i++) {
+    dividends[i] = i * 7919 + 13;
+    divisors[i] = (i % 13) + 1;
+    q = (q + Math.floor(dividends[i] / divisors[i])) | 0;
+    r = (r + dividends[i] % divisors[i]) | 0;
+  }
+  expected = q ^ r;
+}
+
+function IntDivide() {
+  result = divide(dividends, divisors);
+}
+
+function IntDivideTearDown() {
+  return result === expected;
+}
+
+// ----------------------------------------------------------------------------
+
+var us;
+var vs;
+var out;
+
+function normalize(x, y, o) {
+  for (var i = 0; i < x.length; i++) {
+    var a = x[i];
+    var b = y[i];
+    var length = Math.sqrt(a * a + b * b);
+    o[i] = a / length + b / length;
+  }
+}
+
+function NormalizeSetup() {
+  us = new Float64Array(N);
+  vs = new Float64Array(N);
+  out = new Float64Array(N);
+  for (var i = 0; i < N; i++) {
+    us[i] = i + 1;
+    vs[i] = N - i;
+  }
+}
+
+function Normalize() {
+  normalize(us, vs, out);
+}
+
+function NormalizeTearDown() {
+  for (var i = 0; i < N; i++) {
+    var length = Math.sqrt(us[i] * us[i] + vs[i] * vs[i]);
+    if (out[i] !== us[i] / length + vs[i] / length) return false;
+  }
+  return true;
+}
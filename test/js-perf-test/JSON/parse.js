@@ -0,0 +1,72 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compares the time the main thread spends on a large JSON text with
+// JSON.parse against the time it spends in BackgroundJSON.finish() once the
+// text has been tokenized on a background thread.
+
+new BenchmarkSuite('Parse', [1000], [
+  new Benchmark('JSONParse', false, false, 0,
+                JSONParse, JSONParseSetup, JSONParseTearDown),
+  new Benchmark('BackgroundJSONFinish', false, false, 0,
+                BackgroundJSONFinish, BackgroundJSONFinishSetup,
+                BackgroundJSONFinishTearDown),
+]);
+
+var text;
+var job;
+var result;
+
+// ----------------------------------------------------------------------------
+
+function MakeText() {
+  var records = [];
+  for (var i = 0; i < 2000; i++) {
+    records.push({
+      id: i,
+      name: 'record ' + i,
+      score: i / 7,
+      active: (i % 3) == 0,
+      tags: ['a' + (i % 10), 'b' + (i % 5)],
+      parent: i > 0 ? { id: i - 1, note: 'line\nbreak' } : null
+    });
+  }
+  return JSON.stringify({ records: records });
+}
+
+function CheckResult() {
+  return result.records.length == 2000 &&
+         result.records[1999].name === 'record 1999' &&
+         result.records[1].parent.note === 'line\nbreak';
+}
+
+// ----------------------------------------------------------------------------
+
+function JSONParseSetup() {
+  text = MakeText();
+}
+
+function JSONParse() {
+  result = JSON.parse(text);
+}
+
+function JSONParseTearDown() {
+  return CheckResult();
+}
+
+// ----------------------------------------------------------------------------
+
+function BackgroundJSONFinishSetup() {
+  text = MakeText();
+  job = BackgroundJSON.start(text);
+}
+
+function BackgroundJSONFinish() {
+  result = BackgroundJSON.finish(job);
+}
+
+function BackgroundJSONFinishTearDown() {
+  job = undefined;
+  return CheckResult();
+}
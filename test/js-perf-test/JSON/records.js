@@ -0,0 +1,72 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// API responses: long lists of records with the same keys, with nested
+// objects of a few other shapes in between.
+
+new BenchmarkSuite('Records', [1000], [
+  new Benchmark('ParseUniformRecords', false, false, 0,
+                ParseRecords, UniformRecordsSetup, RecordsTearDown),
+  new Benchmark('ParseMixedRecords', false, false, 0,
+                ParseRecords, MixedRecordsSetup, RecordsTearDown),
+]);
+
+var recordsText;
+var recordsResult;
+
+// ----------------------------------------------------------------------------
+
+function MakeUser(i) {
+  return {
+    login: 'user' + i,
+    id: i,
+    avatar_url: 'https://avatars.example.com/u/' + i,
+    site_admin: false
+  };
+}
+
+function MakeIssue(i, mixed) {
+  var issue = {
+    id: 100000 + i,
+    number: i,
+    title: 'Issue number ' + i,
+    state: i % 4 == 0 ? 'closed' : 'open',
+    user: MakeUser(i % 50),
+    labels: [{ id: i % 7, name: 'label' + (i % 7), color: 'fc2929' }],
+    comments: i % 13,
+    created_at: '2016-04-01T12:00:00Z',
+    score: i / 3
+  };
+  if (mixed && i % 3 == 0) issue.assignee = MakeUser(i % 20);
+  if (mixed && i % 5 == 0) {
+    issue.milestone = { id: i % 4, title: 'v' + (i % 4), open_issues: i };
+  }
+  return issue;
+}
+
+function MakeRecordsText(mixed) {
+  var issues = [];
+  for (var i = 0; i < 1000; i++) issues.push(MakeIssue(i, mixed));
+  return JSON.stringify({ total_count: issues.length, items: issues });
+}
+
+function UniformRecordsSetup() {
+  recordsText = MakeRecordsText(false);
+}
+
+function MixedRecordsSetup() {
+  recordsText = MakeRecordsText(true);
+}
+
+function RecordsTearDown() {
+  return recordsResult.items.length == 1000 &&
+         recordsResult.items[999].user.login === 'user49' &&
+         recordsResult.items[999].labels[0].name === 'label5';
+}
+
+// ----------------------------------------------------------------------------
+
+function ParseRecords() {
+  recordsResult = JSON.parse(recordsText);
+}
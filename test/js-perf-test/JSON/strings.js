@@ -0,0 +1,99 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large documents made up mostly of string values, with few or no characters
+// that need escaping, and a few with many.
+
+new BenchmarkSuite('Strings', [1000], [
+  new Benchmark('ParseOneByte', false, false, 0,
+                ParseOneByte, OneByteSetup, ParseTearDown),
+  new Benchmark('ParseTwoByte', false, false, 0,
+                ParseTwoByte, TwoByteSetup, ParseTearDown),
+  new Benchmark('ParseEscaped', false, false, 0,
+                ParseEscaped, EscapedSetup, ParseTearDown),
+  new Benchmark('StringifyOneByte', false, false, 0,
+                StringifyOneByte, OneByteSetup, StringifyTearDown),
+  new Benchmark('StringifyTwoByte', false, false, 0,
+                StringifyTwoByte, TwoByteSetup, StringifyTearDown),
+  new Benchmark('StringifyEscaped', false, false, 0,
+                StringifyEscaped, EscapedSetup, StringifyTearDown),
+]);
+
+var document;
+var documentText;
+var result;
+
+// ----------------------------------------------------------------------------
+
+function MakeDocument(words) {
+  var entries = [];
+  for (var i = 0; i < 500; i++) {
+    var body = [];
+    for (var j = 0; j < 40; j++) {
+      body.push(words[(i + j) % words.length]);
+    }
+    entries.push({
+      title: words[i % words.length] + ' ' + i,
+      url: 'http://www.example.com/articles/' + i + '/index.html',
+      body: body.join(' '),
+      summary: body.slice(0, 10).join(' ')
+    });
+  }
+  return { entries: entries };
+}
+
+function SetupDocument(words) {
+  document = MakeDocument(words);
+  documentText = JSON.stringify(document);
+}
+
+function OneByteSetup() {
+  SetupDocument(['lorem', 'ipsum', 'dolor', 'sit', 'amet', 'consectetur',
+                 'adipiscing', 'elit', 'sed', 'do', 'eiusmod', 'tempor']);
+}
+
+function TwoByteSetup() {
+  SetupDocument(['\u03b1\u03b2\u03b3', '\u0434\u0435\u0436', 'caf\u00e9',
+                 '\u65e5\u672c\u8a9e', 'na\u00efve', '\u00fcber', 'plain']);
+}
+
+function EscapedSetup() {
+  SetupDocument(['"quoted"', 'back\\slash', 'line\nbreak', 'tab\there',
+                 'C:\\path\\to\\file', '\u0001control', 'plain']);
+}
+
+function ParseTearDown() {
+  return result.entries.length == 500 &&
+         result.entries[499].body === document.entries[499].body;
+}
+
+function StringifyTearDown() {
+  return result === documentText;
+}
+
+// ----------------------------------------------------------------------------
+
+function ParseOneByte() {
+  result = JSON.parse(documentText);
+}
+
+function ParseTwoByte() {
+  result = JSON.parse(documentText);
+}
+
+function ParseEscaped() {
+  result = JSON.parse(documentText);
+}
+
+function StringifyOneByte() {
+  result = JSON.stringify(document);
+}
+
+function StringifyTwoByte() {
+  result = JSON.stringify(document);
+}
+
+function StringifyEscaped() {
+  result = JSON.stringify(document);
+}
@@ -0,0 +1,65 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Operations that copy, compare or scan long flat strings and so spend most
+// of their time in the string stubs' inner loops.
+
+new BenchmarkSuite('StringBlockOps', [1000], [
+  new Benchmark('StringSubstring', false, false, 0,
+                Substring, BlockSetup, BlockTearDown),
+  new Benchmark('StringCompare', false, false, 0,
+                Compare, BlockSetup, BlockTearDown),
+  new Benchmark('StringIndexOfChar', false, false, 0,
+                IndexOfChar, BlockSetup, BlockTearDown),
+]);
+
+
+var blockLeft;
+var blockRight;
+var blockTwoByte;
+
+function BlockSetup() {
+  var s = "";
+  for (var i = 0; i < 4096; i++) {
+    s += String.fromCharCode(97 + i % 26);
+  }
+  // Flatten the strings, and make the two differ only near the end.
+  blockLeft = s.substring(1) + "!";
+  blockRight = s.substring(1) + "#";
+  blockTwoByte = (s + "\u03bb").substring(1);
+  result = undefined;
+}
+
+function Substring() {
+  var length = 0;
+  for (var i = 0; i < 64; i++) {
+    length += blockLeft.substring(i, 4000 + i).length;
+    length += blockTwoByte.substring(i, 4000 + i).length;
+  }
+  result = length;
+}
+
+function Compare() {
+  var less = 0;
+  for (var i = 0; i < 64; i++) {
+    if (blockLeft < blockRight) less++;
+    if (blockRight < blockLeft) less--;
+  }
+  result = less;
+}
+
+function IndexOfChar() {
+  var sum = 0;
+  for (var i = 0; i < 64; i++) {
+    sum += blockLeft.indexOf("!");
+  }
+  result = sum;
+}
+
+function BlockTearDown() {
+  var expected = [128 * 4000, 64, 64 * 4095];
+  if (expected.indexOf(result) < 0) {
+    throw new Error("Unexpected result: " + result);
+  }
+}
@@ -0,0 +1,49 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// %TypedArray%.prototype.sort in the default order, from 100 to 10M
+// elements. Every run sorts a fresh copy of the same random elements.
+
+var sortSource;
+var sortArray;
+
+function SortSetup(constructor, length) {
+  return function() {
+    sortSource = new constructor(length);
+    var seed = 49734321;
+    for (var i = 0; i < length; i++) {
+      seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+      sortSource[i] = seed - 0x40000000 + (seed & 0xff) / 256;
+    }
+    sortArray = new constructor(length);
+  };
+}
+
+function Sort() {
+  sortArray.set(sortSource);
+  sortArray.sort();
+}
+
+function SortTearDown() {
+  for (var i = 1; i < sortArray.length; i++) {
+    if (sortArray[i - 1] > sortArray[i]) throw new Error('Not sorted');
+  }
+  sortSource = undefined;
+  sortArray = undefined;
+}
+
+function SortSuite(name, length) {
+  var constructors = [Uint8Array, Uint16Array, Int32Array, Float32Array,
+                      Float64Array];
+  var benchmarks = constructors.map(function(constructor) {
+    return new Benchmark(constructor.name, false, false, 0, Sort,
+                         SortSetup(constructor, length), SortTearDown);
+  });
+  return new BenchmarkSuite(name, [1000], benchmarks);
+}
+
+SortSuite('Sort-100', 100);
+SortSuite('Sort-10K', 10000);
+SortSuite('Sort-1M', 1000000);
+SortSuite('Sort-10M', 10000000);
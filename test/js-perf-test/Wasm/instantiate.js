@@ -0,0 +1,120 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the startup time of a large synthetic module, which is dominated
+// by the compilation of its functions.
+
+new BenchmarkSuite('Instantiate', [100], [
+  new Benchmark('LargeModule', false, false, 0,
+                InstantiateLargeModule, InstantiateLargeModuleSetup,
+                InstantiateLargeModuleTearDown)
+]);
+
+var kNumFunctions = 500;
+var kExpressionsPerFunction = 40;
+
+// Section declaration constants
+var kDeclMemory = 0x00;
+var kDeclSignatures = 0x01;
+var kDeclFunctions = 0x02;
+var kDeclEnd = 0x06;
+
+// Function declaration flags
+var kDeclFunctionName   = 0x01;
+var kDeclFunctionExport = 0x08;
+
+// Local types
+var kAstI32 = 1;
+
+// Opcodes
+var kExprI8Const = 0x09;
+var kExprGetLocal = 0x0e;
+var kExprI32Add = 0x40;
+var kExprI32Mul = 0x42;
+var kExprI32DivS = 0x43;
+var kExprI32Xor = 0x49;
+
+var module_bytes;
+var module;
+
+function EmitU32V(bytes, value) {
+  while (value >= 0x80) {
+    bytes.push((value & 0x7f) | 0x80);
+    value = value >>> 7;
+  }
+  bytes.push(value);
+}
+
+function EmitU16(bytes, value) {
+  bytes.push(value & 0xff, (value >> 8) & 0xff);
+}
+
+// Emits an expression tree of (a + b) * (a ^ k) / (b + 1) terms folded with
+// additions, so that every function gets arithmetic, constants and traps.
+function EmitBody(bytes, index) {
+  for (var i = 1; i < kExpressionsPerFunction; i++) {
+    bytes.push(kExprI32Add);
+  }
+  for (var i = 0; i < kExpressionsPerFunction; i++) {
+    bytes.push(kExprI32DivS,
+               kExprI32Mul,
+               kExprI32Add, kExprGetLocal, 0, kExprGetLocal, 1,
+               kExprI32Xor, kExprGetLocal, 0, kExprI8Const, (index + i) & 0x7f,
+               kExprI32Add, kExprGetLocal, 1, kExprI8Const, 1);
+  }
+}
+
+function BuildLargeModule() {
+  var bytes = [];
+  // Memory of 4KB, not exported.
+  bytes.push(kDeclMemory, 12, 12, 0);
+  // A single (i32, i32) -> i32 signature.
+  bytes.push(kDeclSignatures, 1, 2, kAstI32, kAstI32, kAstI32);
+
+  bytes.push(kDeclFunctions);
+  EmitU32V(bytes, kNumFunctions);
+  var name_offset_position = -1;
+  for (var i = 0; i < kNumFunctions; i++) {
+    var exported = i == kNumFunctions - 1;
+    bytes.push(exported ? kDeclFunctionName | kDeclFunctionExport : 0);
+    EmitU16(bytes, 0);  // signature index
+    if (exported) {
+      name_offset_position = bytes.length;
+      bytes.push(0, 0, 0, 0);  // name offset, patched below
+    }
+    var body = [];
+    EmitBody(body, i);
+    EmitU16(bytes, body.length);
+    bytes.push.apply(bytes, body);
+  }
+  bytes.push(kDeclEnd);
+
+  // The name of the exported function.
+  var name_offset = bytes.length;
+  bytes[name_offset_position] = name_offset & 0xff;
+  bytes[name_offset_position + 1] = (name_offset >> 8) & 0xff;
+  bytes[name_offset_position + 2] = (name_offset >> 16) & 0xff;
+  bytes[name_offset_position + 3] = (name_offset >> 24) & 0xff;
+  bytes.push('m'.charCodeAt(0), 'a'.charCodeAt(0), 'i'.charCodeAt(0),
+             'n'.charCodeAt(0), 0);
+
+  var buffer = new ArrayBuffer(bytes.length);
+  var view = new Uint8Array(buffer);
+  for (var i = 0; i < bytes.length; i++) view[i] = bytes[i];
+  return buffer;
+}
+
+// ----------------------------------------------------------------------------
+
+function InstantiateLargeModuleSetup() {
+  module_bytes = BuildLargeModule();
+}
+
+function InstantiateLargeModule() {
+  module = _WASMEXP_.instantiateModule(module_bytes);
+}
+
+function InstantiateLargeModuleTearDown() {
+  return typeof module.main === 'function' && module.main(3, 4) !== undefined;
+}
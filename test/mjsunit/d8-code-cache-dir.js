@@ -0,0 +1,60 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --code-cache-dir=/tmp/d8-code-cache-dir-test
+
+// Scripts loaded from files write a code cache to --code-cache-dir and
+// consume it when they are loaded again. Like d8-os, this only does work on
+// Unix, where os.system is available.
+
+var CACHE_DIR = "/tmp/d8-code-cache-dir-test";
+var SCRIPT = CACHE_DIR + "/script.js";
+
+function CacheFiles() {
+  return os.system("ls", [CACHE_DIR]).split("\n").filter(function(file) {
+    return /script_js-[0-9a-f]{8}\.cache$/.test(file);
+  });
+}
+
+function WriteScript(source) {
+  os.system("sh", ["-c", "echo '" + source + "' > " + SCRIPT]);
+}
+
+if (this.os && os.system) {
+  try {
+    os.system("rm", ["-rf", CACHE_DIR]);
+    os.mkdirp(CACHE_DIR);
+
+    // Strings compiled by eval do not go through the cache dir.
+    eval("var fromEval = 1;");
+    assertEquals(0, CacheFiles().length);
+
+    // The first load compiles the script and writes its cache.
+    WriteScript("function f(x) { return x * 2; } var result = f(21);");
+    load(SCRIPT);
+    assertEquals(42, result);
+    var files = CacheFiles();
+    assertEquals(1, files.length);
+
+    // The second load consumes the cache and leaves it alone.
+    result = 0;
+    load(SCRIPT);
+    assertEquals(42, result);
+    assertEquals(files, CacheFiles());
+
+    // An edited script gets a cache of its own.
+    WriteScript("function f(x) { return x * 3; } var result = f(21);");
+    load(SCRIPT);
+    assertEquals(63, result);
+    assertEquals(2, CacheFiles().length);
+
+    // A corrupt cache is rejected and the script is compiled from source.
+    os.system("sh", ["-c", "echo garbage > " + CACHE_DIR + "/" + files[0]]);
+    WriteScript("function f(x) { return x * 2; } var result = f(21);");
+    load(SCRIPT);
+    assertEquals(42, result);
+  } finally {
+    os.system("rm", ["-rf", CACHE_DIR]);
+  }
+}
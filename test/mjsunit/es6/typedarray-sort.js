@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+// Flags: --allow-natives-syntax
+
 var typedArrayConstructors = [
   Uint8Array,
   Int8Array,
@@ -53,3 +55,62 @@ for (var constructor of typedArrayConstructors) {
   // Method doesn't work on other objects
   assertThrows(function() { a.sort.call([]); }, TypeError);
 }
+
+function DefaultCompare(x, y) {
+  if (x === 0 && y === 0) return (1 / x) - (1 / y);
+  if (x < y) return -1;
+  if (x > y) return 1;
+  if (x !== x) return y !== y ? 0 : 1;
+  if (y !== y) return -1;
+  return 0;
+}
+
+function CheckSortedLikeCompare(constructor, length) {
+  var a = new constructor(length);
+  var seed = 17;
+  for (var i = 0; i < length; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    a[i] = (seed % 70001) - 35000 + (seed % 3) / 4;
+    if (seed % 23 == 0) a[i] = -0;
+    if (seed % 29 == 0) a[i] = NaN;
+  }
+  var expected = Array.prototype.slice.call(a).sort(DefaultCompare);
+  assertSame(a, a.sort());
+  assertArrayLikeEquals(a, expected, constructor);
+}
+
+for (var constructor of typedArrayConstructors) {
+  // Both short arrays and arrays long enough to be sorted by counting.
+  [0, 1, 2, 15, 16, 17, 100, 5000].forEach(function(length) {
+    CheckSortedLikeCompare(constructor, length);
+  });
+
+  // Only the elements of a view are sorted.
+  var buffer = new constructor([5, 4, 3, 2, 1, 0]).buffer;
+  var view = new constructor(buffer, constructor.BYTES_PER_ELEMENT, 4);
+  view.sort();
+  assertArrayLikeEquals(new constructor(buffer), [5, 1, 2, 3, 4, 0],
+                        constructor);
+
+  // Sorting an array with a neutered buffer does nothing.
+  var c = new constructor([3, 2, 1]);
+  %ArrayBufferNeuter(c.buffer);
+  assertSame(c, c.sort());
+  assertEquals(0, c.length);
+}
+
+// Extreme values of every element type.
+assertArrayLikeEquals(new Int8Array([127, 0, -128, -1]).sort(),
+                      [-128, -1, 0, 127], Int8Array);
+assertArrayLikeEquals(new Int16Array([32767, 0, -32768, -1]).sort(),
+                      [-32768, -1, 0, 32767], Int16Array);
+assertArrayLikeEquals(new Uint16Array([65535, 0, 1]).sort(),
+                      [0, 1, 65535], Uint16Array);
+assertArrayLikeEquals(new Int32Array([2147483647, 0, -2147483648]).sort(),
+                      [-2147483648, 0, 2147483647], Int32Array);
+assertArrayLikeEquals(new Uint32Array([4294967295, 0, 2147483648]).sort(),
+                      [0, 2147483648, 4294967295], Uint32Array);
+assertArrayLikeEquals(
+    new Float64Array([Infinity, NaN, -Infinity, 0, -0, -Number.MAX_VALUE])
+        .sort(),
+    [-Infinity, -Number.MAX_VALUE, -0, 0, Infinity, NaN], Float64Array);
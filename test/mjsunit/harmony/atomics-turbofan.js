@@ -0,0 +1,116 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-sharedarraybuffer --allow-natives-syntax --turbo
+
+// The typed arrays are global constants, so optimized code can inline the
+// Atomics builtins and access the shared memory directly.
+var sab = new SharedArrayBuffer(16);
+var i8 = new Int8Array(sab);
+var u8 = new Uint8Array(sab);
+var i16 = new Int16Array(sab);
+var u16 = new Uint16Array(sab);
+var i32 = new Int32Array(sab);
+var u32 = new Uint32Array(sab);
+
+function clear() {
+  for (var i = 0; i < i32.length; ++i) i32[i] = 0;
+}
+
+function optimize(f) {
+  f();
+  f();
+  %OptimizeFunctionOnNextCall(f);
+  f();
+}
+
+(function TestLoadStore() {
+  function f() {
+    clear();
+    assertEquals(-5, Atomics.store(i8, 1, -5));
+    assertEquals(-5, Atomics.load(i8, 1));
+    assertEquals(251, Atomics.load(u8, 1));
+    assertEquals(0, Atomics.load(u8, 0));
+    assertEquals(0, Atomics.load(u8, 2));
+    assertEquals(3.5, Atomics.store(u16, 3, 3.5));
+    assertEquals(3, Atomics.load(u16, 3));
+    assertEquals(-1, Atomics.store(u32, 2, -1));
+    assertEquals(0xffffffff, Atomics.load(u32, 2));
+    assertEquals(-1, Atomics.load(i32, 2));
+    assertEquals(undefined, Atomics.load(i32, 4));
+  }
+  optimize(f);
+})();
+
+(function TestExchange() {
+  function f() {
+    clear();
+    assertEquals(0, Atomics.exchange(i8, 2, -2));
+    assertEquals(-2, Atomics.exchange(i8, 2, 7));
+    assertEquals(7, Atomics.load(i8, 2));
+    assertEquals(0, Atomics.load(i8, 1));
+    assertEquals(0, Atomics.load(i8, 3));
+    assertEquals(0, Atomics.exchange(u16, 3, 0x12345));
+    assertEquals(0x2345, Atomics.exchange(u16, 3, 1));
+    assertEquals(0, Atomics.exchange(i32, 3, 0x7fffffff));
+    assertEquals(0x7fffffff, Atomics.exchange(i32, 3, 0));
+  }
+  optimize(f);
+})();
+
+(function TestCompareExchange() {
+  function f() {
+    clear();
+    assertEquals(0, Atomics.compareExchange(u8, 5, 0, 200));
+    assertEquals(200, Atomics.compareExchange(u8, 5, 0, 100));
+    assertEquals(200, Atomics.load(u8, 5));
+    assertEquals(-56, Atomics.compareExchange(i8, 5, -56, 1));
+    assertEquals(1, Atomics.load(i8, 5));
+    assertEquals(0, Atomics.load(i8, 4));
+    assertEquals(0, Atomics.compareExchange(i16, 3, 0, -300));
+    assertEquals(-300, Atomics.compareExchange(i16, 3, -300, 300));
+    assertEquals(300, Atomics.load(i16, 3));
+    assertEquals(0, Atomics.compareExchange(u32, 3, 0, 0x80000000));
+    assertEquals(0x80000000, Atomics.compareExchange(u32, 3, 1, 2));
+    assertEquals(0x80000000, Atomics.load(u32, 3));
+  }
+  optimize(f);
+})();
+
+(function TestArithmetic() {
+  function f() {
+    clear();
+    assertEquals(0, Atomics.add(u8, 6, 255));
+    assertEquals(255, Atomics.add(u8, 6, 2));
+    assertEquals(1, Atomics.load(u8, 6));
+    assertEquals(0, Atomics.load(u8, 5));
+    assertEquals(0, Atomics.load(u8, 7));
+    assertEquals(0, Atomics.sub(i16, 2, 1));
+    assertEquals(-1, Atomics.sub(i16, 2, 0x7fff));
+    assertEquals(-0x8000, Atomics.load(i16, 2));
+    assertEquals(0, Atomics.add(i32, 3, 0x7fffffff));
+    assertEquals(0x7fffffff, Atomics.add(i32, 3, 1));
+    assertEquals(-0x80000000, Atomics.sub(i32, 3, 1));
+    assertEquals(0x7fffffff, Atomics.load(i32, 3));
+  }
+  optimize(f);
+})();
+
+(function TestBitwise() {
+  function f() {
+    clear();
+    Atomics.store(u16, 5, 0xf0f0);
+    assertEquals(0xf0f0, Atomics.and(u16, 5, 0xff00));
+    assertEquals(0xf000, Atomics.or(u16, 5, 0x000f));
+    assertEquals(0xf00f, Atomics.xor(u16, 5, 0xffff));
+    assertEquals(0x0ff0, Atomics.load(u16, 5));
+    assertEquals(0, Atomics.load(u16, 4));
+    Atomics.store(i32, 0, 0x0f0f0f0f);
+    assertEquals(0x0f0f0f0f, Atomics.and(i32, 0, 0x00ffff00));
+    assertEquals(0x000f0f00, Atomics.or(i32, 0, 0xf0000000));
+    assertEquals(-0xff0f100, Atomics.xor(i32, 0, -1));
+    assertEquals(0x0ff0f0ff, Atomics.load(u32, 0));
+  }
+  optimize(f);
+})();
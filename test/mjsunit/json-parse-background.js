@@ -0,0 +1,84 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test the BackgroundJSON API of d8, which tokenizes a JSON text on a
+// background thread and creates its value on the main thread.
+
+if (this.BackgroundJSON) {
+  function ParseInBackground(text) {
+    return BackgroundJSON.finish(BackgroundJSON.start(text));
+  }
+
+  function TestParse(text) {
+    assertEquals(JSON.stringify(JSON.parse(text)),
+                 JSON.stringify(ParseInBackground(text)));
+  }
+
+  TestParse('0');
+  TestParse('-1.5e3');
+  TestParse('1e400');
+  TestParse('"abc"');
+  TestParse('[]');
+  TestParse('{}');
+  TestParse(' [1, "2", true, false, null, {"a": [{}]}] ');
+  TestParse('{"a": 1, "b": 2, "a": 3}');
+  TestParse('{"1": 1, "0": 0, "4294967295": 2, "-1": 3, "01": 4}');
+  TestParse('"\\u00e9\\t\\"\\\\\\/\\b\\f\\n\\r\\ud83d\\ude00"');
+  TestParse('{"\\u0061": "\\u03b1", "β": "γ"}');
+  TestParse('[9007199254740993, -0, 0.1, 1073741823, 1073741824]');
+
+  // -0 is not a Smi.
+  assertEquals(-Infinity, 1 / ParseInBackground('-0'));
+
+  // Keys are shared between objects.
+  var records = ParseInBackground('[{"x": 1, "y": 2}, {"x": 3, "y": 4}]');
+  assertEquals(3, records[1].x);
+  assertEquals(4, records[1].y);
+
+  // A job can be finished more than once, creating a new value every time.
+  var job = BackgroundJSON.start('{"a": [1, 2, 3]}');
+  var first = BackgroundJSON.finish(job);
+  var second = BackgroundJSON.finish(job);
+  assertEquals(first, second);
+  assertFalse(first === second);
+  assertFalse(first.a === second.a);
+
+  // Syntax errors are thrown by finish(), with the message of JSON.parse.
+  function TestError(text) {
+    var expected;
+    try {
+      JSON.parse(text);
+    } catch (e) {
+      expected = e;
+    }
+    assertInstanceof(expected, SyntaxError);
+    var job = BackgroundJSON.start(text);
+    assertThrows(function() { BackgroundJSON.finish(job); }, SyntaxError,
+                 expected.message);
+  }
+
+  TestError('');
+  TestError('[1,]');
+  TestError('{"a" 1}');
+  TestError('{"a": 1,}');
+  TestError('"abc');
+  TestError('"\\x"');
+  TestError('01');
+  TestError('1.');
+  TestError('tru');
+  TestError('[1] 2');
+
+  // Nesting deeper than the background thread takes is finished on the main
+  // thread.
+  var nested = Array(1001).join('[{"a":') + '1' + Array(1001).join('}]');
+  TestParse(nested);
+  TestError(Array(1001).join('[') + '1,' + Array(1001).join(']'));
+
+  // Nesting too deep for the stack throws a RangeError.
+  var deep = Array(100001).join('[') + Array(100001).join(']');
+  assertThrows(function() { ParseInBackground(deep); }, RangeError);
+
+  assertThrows(function() { BackgroundJSON.start(42); });
+  assertThrows(function() { BackgroundJSON.finish({}); });
+}
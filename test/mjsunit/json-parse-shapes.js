@@ -0,0 +1,101 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// JSON.parse remembers the maps of recently parsed objects and follows them
+// for objects with the same keys. Check that this gives the same objects as
+// parsing them one by one.
+
+function Check(json) {
+  var parsed = JSON.parse(json);
+  assertEquals(json, JSON.stringify(parsed));
+  return parsed;
+}
+
+function CheckSameMaps(json) {
+  var records = Check(json);
+  for (var i = 1; i < records.length; i++) {
+    assertTrue(%HaveSameMap(records[0], records[i]));
+  }
+  return records;
+}
+
+// Identical records.
+CheckSameMaps('[' + new Array(101).join('{"id":1,"name":"x","ok":true},')
+              .slice(0, -1) + ']');
+
+// Records whose shapes alternate between more shapes than are cached.
+var shapes = [
+  '{"a":1,"b":2}', '{"b":1,"a":2}', '{"a":1,"b":2,"c":3}', '{"a":1}',
+  '{"c":1,"a":2}', '{"d":1,"e":2}'
+];
+var json = [];
+for (var i = 0; i < 60; i++) json.push(shapes[i % shapes.length]);
+var records = Check('[' + json.join(',') + ']');
+for (var i = shapes.length; i < records.length; i++) {
+  assertTrue(%HaveSameMap(records[i], records[i - shapes.length]));
+  assertEquals(shapes[i % shapes.length], JSON.stringify(records[i]));
+}
+
+// A shape that is a prefix of a cached one, and the other way around.
+records = Check('[{"p":1,"q":2,"r":3},{"p":1,"q":2},' +
+                '{"p":1,"q":2,"r":3,"s":4},{"p":1}]');
+assertEquals(3, Object.keys(records[0]).length);
+assertEquals(2, Object.keys(records[1]).length);
+assertEquals(4, Object.keys(records[2]).length);
+assertEquals(1, Object.keys(records[3]).length);
+
+// Keys written with escapes are the same keys.
+records = JSON.parse('[{"key":1,"other":2},{"k\\u0065y":3,"other":4}]');
+assertTrue(%HaveSameMap(records[0], records[1]));
+assertEquals(3, records[1].key);
+
+// Index keys are elements, wherever they appear.
+records = JSON.parse('[{"u":1,"v":2},{"0":0,"u":1,"v":2},{"u":1,"1":1,"v":2}]');
+assertEquals(0, records[1][0]);
+assertEquals(1, records[2][1]);
+assertEquals(['u', 'v'], Object.keys(records[0]));
+assertEquals(['0', 'u', 'v'], Object.keys(records[1]));
+assertEquals(['1', 'u', 'v'], Object.keys(records[2]));
+
+// Fields whose representation changes from one record to the next.
+records = JSON.parse('[{"f":1,"g":"s"},{"f":1.5,"g":"t"},{"f":{},"g":2},' +
+                     '{"f":null,"g":[1]},{"f":2,"g":"u"}]');
+assertEquals(1, records[0].f);
+assertEquals(1.5, records[1].f);
+assertEquals({}, records[2].f);
+assertEquals(null, records[3].f);
+assertEquals(2, records[4].f);
+assertEquals("s", records[0].g);
+assertEquals(2, records[2].g);
+assertEquals([1], records[3].g);
+assertEquals("u", records[4].g);
+// Once the fields are general enough, records share their map again.
+assertTrue(%HaveSameMap(records[3], records[4]));
+
+// Nested records, where the inner objects use the cache in between the keys
+// of the outer ones.
+var nested = [];
+for (var i = 0; i < 20; i++) {
+  nested.push('{"id":' + i + ',"child":{"id":' + (i * 2) +
+              ',"tags":["a","b"]},"last":' + (i % 2 == 0) + '}');
+}
+records = CheckSameMaps('[' + nested.join(',') + ']');
+for (var i = 1; i < records.length; i++) {
+  assertTrue(%HaveSameMap(records[0].child, records[i].child));
+}
+
+// Duplicate keys.
+assertEquals({x: 3, y: 4}, JSON.parse('{"x":1,"y":2,"x":3,"y":4}'));
+assertEquals([{x: 1, y: 2}, {x: 3, y: 4}, {x: 5}],
+             JSON.parse('[{"x":1,"y":2},{"x":3,"y":4},{"x":1,"x":5}]'));
+
+// Syntax errors in the middle of a cached shape.
+assertThrows(function() { JSON.parse('[{"a":1,"b":2},{"a":1,"b"}]'); },
+             SyntaxError);
+assertThrows(function() { JSON.parse('[{"a":1,"b":2},{"a":1,"b":}]'); },
+             SyntaxError);
+assertThrows(function() { JSON.parse('[{"a":1,"b":2},{"a":1,"b":2'); },
+             SyntaxError);
@@ -0,0 +1,68 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.parse and JSON.stringify skip over runs of characters that need no
+// escaping in bulk. Put every kind of special character at every offset of
+// strings long enough to use those paths, in one-byte and two-byte strings.
+
+var specials = ['"', '\\', '\n', '\x00', '\x1f', '\t', ' '];
+var fillers = ['a', '\xe9', 'α', '\x7f', ' ', '#'];
+
+function Repeat(c, n) {
+  return new Array(n + 1).join(c);
+}
+
+function Escape(c) {
+  switch (c) {
+    case '"': return '\\"';
+    case '\\': return '\\\\';
+    case '\n': return '\\n';
+    case '\t': return '\\t';
+    case '\x00': return '\\u0000';
+    case '\x1f': return '\\u001f';
+    default: return c;
+  }
+}
+
+for (var f = 0; f < fillers.length; f++) {
+  var filler = fillers[f];
+  for (var length = 0; length < 72; length += 7) {
+    var plain = Repeat(filler, length);
+    assertEquals('"' + plain + '"', JSON.stringify(plain));
+    assertEquals(plain, JSON.parse('"' + plain + '"'));
+    assertEquals(1, JSON.parse('{"' + plain + '": 1}')[plain]);
+    for (var s = 0; s < specials.length; s++) {
+      var special = specials[s];
+      for (var i = 0; i <= length; i++) {
+        var string = plain.substring(0, i) + special + plain.substring(i);
+        var json = '"' + plain.substring(0, i) + Escape(special) +
+                   plain.substring(i) + '"';
+        assertEquals(json, JSON.stringify(string));
+        assertEquals(string, JSON.parse(json));
+        var key = JSON.parse('{' + json + ': 1}');
+        assertEquals(1, key[string]);
+      }
+    }
+  }
+}
+
+// Unescaped control characters and unterminated strings are errors at any
+// position.
+for (var length = 0; length < 40; length++) {
+  var prefix = Repeat('x', length);
+  assertThrows(function() { JSON.parse('"' + prefix + '\n"'); }, SyntaxError);
+  assertThrows(function() { JSON.parse('"' + prefix); }, SyntaxError);
+  assertThrows(function() { JSON.parse('{"' + prefix + '\x01": 1}'); },
+               SyntaxError);
+  assertThrows(function() { JSON.parse('{"' + prefix); }, SyntaxError);
+}
+
+// Strings longer than a part of the string builder.
+var long_string = Repeat('abcdefghij', 5000) + '"' + Repeat('\xe9', 20000) +
+                  '\n' + Repeat('α', 20000);
+var long_json = JSON.stringify(long_string);
+assertEquals(long_string.length + 4, long_json.length);
+assertEquals(long_string, JSON.parse(long_json));
+assertEquals([long_string, long_string],
+             JSON.parse(JSON.stringify([long_string, long_string])));
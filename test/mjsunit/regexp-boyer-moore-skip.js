@@ -0,0 +1,53 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The Boyer-Moore lookahead in front of unanchored regexps skips ahead to
+// candidate characters. Candidates are looked up modulo 128, so fill the
+// subject with characters that alias the pattern (e.g. \u00ee for 'n') and
+// place the real match at positions around the 256 character blocks that
+// some ports scan at a time.
+
+var aliased = "\u00ee\u00e5\u00e5\u00e4\u00ec\u00e5";  // "needle" + 0x80.
+
+function filler(length, chars) {
+  var s = "";
+  while (s.length < length) s += chars;
+  return s.substring(0, length);
+}
+
+function firstVowelRun(s) {
+  for (var i = 0; i + 4 <= s.length; i++) {
+    if (/^[aeiou]{4}$/.test(s.substring(i, i + 4))) return i;
+  }
+  return -1;
+}
+
+function test(chars) {
+  var lengths = [0, 1, 5, 255, 256, 257, 300, 511, 512, 513, 1000];
+  for (var i = 0; i < lengths.length; i++) {
+    var length = lengths[i];
+    var base = filler(length, chars);
+    assertEquals(-1, base.search(/needle/), chars + " " + length);
+    assertEquals(-1, base.search(/q/), chars + " " + length);
+    var positions = [0, length >> 1, length];
+    for (var j = 0; j < positions.length; j++) {
+      var p = positions[j];
+      var s = base.substring(0, p) + "needle" + base.substring(p);
+      assertEquals(p, s.search(/needle/), "needle @ " + p);
+      assertEquals(s.indexOf("needle"), s.search(/ne+dle/));
+      s = base.substring(0, p) + "q" + base.substring(p);
+      assertEquals(p, s.search(/q/), "q @ " + p);
+      assertEquals(p, s.search(/q|qq/), "q|qq @ " + p);
+      s = base.substring(0, p) + "ouia" + base.substring(p);
+      assertEquals(firstVowelRun(s), s.search(/[aeiou]{4}/), "vowels @ " + p);
+      var m = /(\d+)-(\d+)/.exec(base.substring(0, p) + "12-345" +
+                                 base.substring(p));
+      assertEquals(["12-345", "12", "345"], m);
+    }
+  }
+}
+
+test(aliased);
+test("abcdfghijklmnoprstvwxyz");
+test(aliased + "\u0165");  // Two-byte subject, with 'e' + 0x100.
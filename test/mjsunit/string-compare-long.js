@@ -0,0 +1,36 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compare and copy flat strings whose lengths straddle the 256 character
+// blocks that some ports use for their block compare and move instructions.
+
+function makeString(length, last) {
+  var s = "";
+  for (var i = 0; i < length - 1; i++) {
+    s += String.fromCharCode(32 + i % 60);
+  }
+  // Flatten.
+  return (s + last).substring(0);
+}
+
+var lengths = [2, 255, 256, 257, 511, 512, 513, 1000];
+for (var i = 0; i < lengths.length; i++) {
+  var length = lengths[i];
+  var a = makeString(length, "a");
+  var b = makeString(length, "b");
+  var a2 = makeString(length, "a");
+  var e = makeString(length, "\u00e9");
+  assertTrue(a < b, "a < b @ " + length);
+  assertFalse(b < a, "b < a @ " + length);
+  assertTrue(a == a2, "a == a2 @ " + length);
+  assertTrue(b < e, "b < e @ " + length);
+  assertTrue(a < a + "a", "prefix @ " + length);
+  assertFalse(a + "a" < a, "prefix reversed @ " + length);
+
+  var sub = a.substring(1, length);
+  assertEquals(length - 1, sub.length);
+  assertEquals("a", sub.charAt(sub.length - 1));
+  assertEquals(a.slice(1), sub);
+  assertEquals(length - 1, a.indexOf("a"));
+}
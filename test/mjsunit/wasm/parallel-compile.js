@@ -0,0 +1,70 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --wasm-num-compilation-tasks=4
+
+load("test/mjsunit/wasm/wasm-constants.js");
+
+// Function #i calls function #i+1 and adds one to the result, the last
+// function divides its argument by itself. The functions are spread over
+// several compilation batches, so most calls go through placeholders.
+var kNumFunctions = 200;
+
+function emitU32V(data, value) {
+  while (value >= 0x80) {
+    data.push((value & 0x7f) | 0x80);
+    value = value >>> 7;
+  }
+  data.push(value);
+}
+
+function makeModule() {
+  var data = [
+    // -- signatures
+    kDeclSignatures, 1,
+    1, kAstI32, kAstI32,        // int -> int
+    // -- functions
+    kDeclFunctions
+  ];
+  emitU32V(data, kNumFunctions);
+  var name_offset_position;
+  for (var i = 0; i < kNumFunctions; i++) {
+    var body = [];
+    if (i < kNumFunctions - 1) {
+      body.push(kExprI32Add, kExprCallFunction);
+      emitU32V(body, i + 1);
+      body.push(kExprGetLocal, 0, kExprI8Const, 1);
+    } else {
+      body.push(kExprI32DivS, kExprGetLocal, 0, kExprGetLocal, 0);
+    }
+    if (i == 0) {
+      data.push(kDeclFunctionName | kDeclFunctionExport, 0, 0);
+      name_offset_position = data.length;
+      data.push(0, 0, 0, 0);    // name offset
+    } else {
+      data.push(0, 0, 0);
+    }
+    data.push(body.length, 0);
+    data = data.concat(body);
+  }
+  data.push(kDeclEnd);
+  data[name_offset_position] = data.length & 0xff;
+  data[name_offset_position + 1] = data.length >> 8;
+  data.push('m', 'a', 'i', 'n', 0);
+  return _WASMEXP_.instantiateModule(bytes.apply(null, data));
+}
+
+var module = makeModule();
+assertEquals("function", typeof module.main);
+assertEquals(kNumFunctions, module.main(5));
+assertEquals(kNumFunctions, module.main(-7));
+
+// Traps still report their message.
+var message;
+try {
+  module.main(0);
+} catch (e) {
+  message = e;
+}
+assertEquals("divide by zero", message);
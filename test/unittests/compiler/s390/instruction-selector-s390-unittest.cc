@@ -9,6 +9,254 @@
 
 namespace v8 {
 namespace internal {
-namespace compiler {}  // namespace compiler
+namespace compiler {
+
+namespace {
+
+template <typename T>
+struct MachInst {
+  T constructor;
+  const char* constructor_name;
+  ArchOpcode arch_opcode;
+  MachineType machine_type;
+};
+
+typedef MachInst<Node* (RawMachineAssembler::*)(Node*, Node*)> MachInst2;
+
+
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const MachInst<T>& mi) {
+  return os << mi.constructor_name;
+}
+
+
+const MachInst2 kWord32BinopsWithMemoryForm[] = {
+    {&RawMachineAssembler::Int32Add, "Int32Add", kS390_Add32,
+     MachineType::Int32()},
+    {&RawMachineAssembler::Int32Sub, "Int32Sub", kS390_Sub32,
+     MachineType::Int32()},
+    {&RawMachineAssembler::Word32And, "Word32And", kS390_And32,
+     MachineType::Int32()},
+    {&RawMachineAssembler::Word32Or, "Word32Or", kS390_Or32,
+     MachineType::Int32()},
+    {&RawMachineAssembler::Word32Xor, "Word32Xor", kS390_Xor32,
+     MachineType::Int32()}};
+
+}  // namespace
+
+
+// -----------------------------------------------------------------------------
+// Loads folded into arithmetic, logical and compare instructions.
+
+
+typedef InstructionSelectorTestWithParam<MachInst2>
+    InstructionSelectorMemoryOperandTest;
+
+
+TEST_P(InstructionSelectorMemoryOperandTest, WithLoadOnRight) {
+  const MachInst2 binop = GetParam();
+  StreamBuilder m(this, binop.machine_type, binop.machine_type,
+                  MachineType::Pointer());
+  Node* const load =
+      m.Load(binop.machine_type, m.Parameter(1), m.IntPtrConstant(16));
+  m.Return((m.*binop.constructor)(m.Parameter(0), load));
+  Stream s = m.Build();
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(binop.arch_opcode, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRI, s[0]->addressing_mode());
+  ASSERT_EQ(3U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(m.Parameter(0)), s.ToVreg(s[0]->InputAt(0)));
+  EXPECT_EQ(s.ToVreg(m.Parameter(1)), s.ToVreg(s[0]->InputAt(1)));
+  EXPECT_EQ(16, s.ToInt32(s[0]->InputAt(2)));
+  ASSERT_EQ(1U, s[0]->OutputCount());
+  EXPECT_TRUE(s.IsSameAsFirst(s[0]->Output()));
+}
+
+
+TEST_P(InstructionSelectorMemoryOperandTest, WithLoadOnLeft) {
+  const MachInst2 binop = GetParam();
+  StreamBuilder m(this, binop.machine_type, binop.machine_type,
+                  MachineType::Pointer());
+  Node* const load =
+      m.Load(binop.machine_type, m.Parameter(1), m.IntPtrConstant(16));
+  m.Return((m.*binop.constructor)(load, m.Parameter(0)));
+  Stream s = m.Build();
+  if (binop.arch_opcode == kS390_Sub32) {
+    // Only commutative operations take the load from the left.
+    ASSERT_EQ(2U, s.size());
+    EXPECT_EQ(kS390_LoadWordS32, s[0]->arch_opcode());
+    EXPECT_EQ(binop.arch_opcode, s[1]->arch_opcode());
+    EXPECT_EQ(kMode_None, s[1]->addressing_mode());
+    return;
+  }
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(binop.arch_opcode, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRI, s[0]->addressing_mode());
+  ASSERT_EQ(3U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(m.Parameter(0)), s.ToVreg(s[0]->InputAt(0)));
+  EXPECT_EQ(s.ToVreg(m.Parameter(1)), s.ToVreg(s[0]->InputAt(1)));
+}
+
+
+TEST_P(InstructionSelectorMemoryOperandTest, WithIndexRegister) {
+  const MachInst2 binop = GetParam();
+  StreamBuilder m(this, binop.machine_type, binop.machine_type,
+                  MachineType::Pointer(), MachineType::Pointer());
+  Node* const load =
+      m.Load(binop.machine_type, m.Parameter(1), m.Parameter(2));
+  m.Return((m.*binop.constructor)(m.Parameter(0), load));
+  Stream s = m.Build();
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(binop.arch_opcode, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRR, s[0]->addressing_mode());
+  ASSERT_EQ(3U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(m.Parameter(1)), s.ToVreg(s[0]->InputAt(1)));
+  EXPECT_EQ(s.ToVreg(m.Parameter(2)), s.ToVreg(s[0]->InputAt(2)));
+}
+
+
+TEST_P(InstructionSelectorMemoryOperandTest, NotWithSharedLoad) {
+  const MachInst2 binop = GetParam();
+  StreamBuilder m(this, binop.machine_type, binop.machine_type,
+                  MachineType::Pointer());
+  Node* const load =
+      m.Load(binop.machine_type, m.Parameter(1), m.IntPtrConstant(16));
+  m.Return(m.Int32Mul((m.*binop.constructor)(m.Parameter(0), load), load));
+  Stream s = m.Build();
+  ASSERT_EQ(3U, s.size());
+  EXPECT_EQ(kS390_LoadWordS32, s[0]->arch_opcode());
+  EXPECT_EQ(binop.arch_opcode, s[1]->arch_opcode());
+  EXPECT_EQ(kMode_None, s[1]->addressing_mode());
+}
+
+
+INSTANTIATE_TEST_CASE_P(InstructionSelectorTest,
+                        InstructionSelectorMemoryOperandTest,
+                        ::testing::ValuesIn(kWord32BinopsWithMemoryForm));
+
+
+#if V8_TARGET_ARCH_S390X
+TEST_F(InstructionSelectorTest, Int64AddWithLoadAndDisplacement) {
+  StreamBuilder m(this, MachineType::Int64(), MachineType::Int64(),
+                  MachineType::Pointer(), MachineType::Int64());
+  Node* const index = m.Int64Add(m.Parameter(2), m.Int64Constant(24));
+  Node* const load = m.Load(MachineType::Int64(), m.Parameter(1), index);
+  m.Return(m.Int64Add(m.Parameter(0), load));
+  Stream s = m.Build();
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(kS390_Add, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRRI, s[0]->addressing_mode());
+  ASSERT_EQ(4U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(m.Parameter(1)), s.ToVreg(s[0]->InputAt(1)));
+  EXPECT_EQ(s.ToVreg(m.Parameter(2)), s.ToVreg(s[0]->InputAt(2)));
+  EXPECT_EQ(24, s.ToInt32(s[0]->InputAt(3)));
+}
+#endif
+
+
+TEST_F(InstructionSelectorTest, Word32EqualWithLoad) {
+  StreamBuilder m(this, MachineType::Int32(), MachineType::Int32(),
+                  MachineType::Pointer());
+  Node* const load =
+      m.Load(MachineType::Int32(), m.Parameter(1), m.IntPtrConstant(4));
+  m.Return(m.Word32Equal(m.Parameter(0), load));
+  Stream s = m.Build();
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(kS390_Cmp32, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRI, s[0]->addressing_mode());
+  ASSERT_EQ(3U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(m.Parameter(0)), s.ToVreg(s[0]->InputAt(0)));
+  EXPECT_EQ(4, s.ToInt32(s[0]->InputAt(2)));
+  EXPECT_EQ(kFlags_set, s[0]->flags_mode());
+  EXPECT_EQ(kEqual, s[0]->flags_condition());
+}
+
+
+TEST_F(InstructionSelectorTest, Int32LessThanWithLoadOnLeft) {
+  StreamBuilder m(this, MachineType::Int32(), MachineType::Int32(),
+                  MachineType::Pointer());
+  Node* const load =
+      m.Load(MachineType::Int32(), m.Parameter(1), m.IntPtrConstant(4));
+  m.Return(m.Int32LessThan(load, m.Parameter(0)));
+  Stream s = m.Build();
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(kS390_Cmp32, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRI, s[0]->addressing_mode());
+  EXPECT_EQ(s.ToVreg(m.Parameter(0)), s.ToVreg(s[0]->InputAt(0)));
+  EXPECT_EQ(kFlags_set, s[0]->flags_mode());
+  EXPECT_EQ(kSignedGreaterThan, s[0]->flags_condition());
+}
+
+
+TEST_F(InstructionSelectorTest, Float64AddWithLoad) {
+  StreamBuilder m(this, MachineType::Float64(), MachineType::Float64(),
+                  MachineType::Pointer());
+  Node* const load =
+      m.Load(MachineType::Float64(), m.Parameter(1), m.IntPtrConstant(8));
+  m.Return(m.Float64Add(m.Parameter(0), load));
+  Stream s = m.Build();
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(kS390_AddDouble, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRI, s[0]->addressing_mode());
+  ASSERT_EQ(3U, s[0]->InputCount());
+  EXPECT_EQ(8, s.ToInt32(s[0]->InputAt(2)));
+  EXPECT_TRUE(s.IsSameAsFirst(s[0]->Output()));
+}
+
+
+TEST_F(InstructionSelectorTest, Float64AddWithLoadAndLargeDisplacement) {
+  // The RXE forms only have an unsigned 12-bit displacement.
+  StreamBuilder m(this, MachineType::Float64(), MachineType::Float64(),
+                  MachineType::Pointer());
+  Node* const load =
+      m.Load(MachineType::Float64(), m.Parameter(1), m.IntPtrConstant(8192));
+  m.Return(m.Float64Add(m.Parameter(0), load));
+  Stream s = m.Build();
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(kS390_AddDouble, s[0]->arch_opcode());
+  EXPECT_EQ(kMode_MRR, s[0]->addressing_mode());
+  ASSERT_EQ(3U, s[0]->InputCount());
+  EXPECT_TRUE(s[0]->InputAt(2)->IsUnallocated());
+}
+
+
+TEST_F(InstructionSelectorTest, Float64Max) {
+  StreamBuilder m(this, MachineType::Float64(), MachineType::Float64(),
+                  MachineType::Float64());
+  Node* const p0 = m.Parameter(0);
+  Node* const p1 = m.Parameter(1);
+  Node* const n = m.Float64Max(p0, p1);
+  m.Return(n);
+  Stream s = m.Build();
+  // Float64Max is `(b < a) ? a : b`.
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(kS390_MaxDouble, s[0]->arch_opcode());
+  ASSERT_EQ(2U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(p0), s.ToVreg(s[0]->InputAt(0)));
+  EXPECT_EQ(s.ToVreg(p1), s.ToVreg(s[0]->InputAt(1)));
+  ASSERT_EQ(1U, s[0]->OutputCount());
+  EXPECT_EQ(s.ToVreg(n), s.ToVreg(s[0]->Output()));
+}
+
+
+TEST_F(InstructionSelectorTest, Float64Min) {
+  StreamBuilder m(this, MachineType::Float64(), MachineType::Float64(),
+                  MachineType::Float64());
+  Node* const p0 = m.Parameter(0);
+  Node* const p1 = m.Parameter(1);
+  Node* const n = m.Float64Min(p0, p1);
+  m.Return(n);
+  Stream s = m.Build();
+  // Float64Min is `(a < b) ? a : b`.
+  ASSERT_EQ(1U, s.size());
+  EXPECT_EQ(kS390_MinDouble, s[0]->arch_opcode());
+  ASSERT_EQ(2U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(p0), s.ToVreg(s[0]->InputAt(0)));
+  EXPECT_EQ(s.ToVreg(p1), s.ToVreg(s[0]->InputAt(1)));
+  ASSERT_EQ(1U, s[0]->OutputCount());
+  EXPECT_EQ(s.ToVreg(n), s.ToVreg(s[0]->Output()));
+}
+
+}  // namespace compiler
 }  // namespace internal
 }  // namespace v8
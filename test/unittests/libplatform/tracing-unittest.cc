@@ -0,0 +1,167 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <sstream>
+
+#include "base/trace_event/common/trace_event_common.h"
+#include "include/libplatform/v8-tracing.h"
+#include "src/libplatform/tracing/trace-buffer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+namespace tracing {
+
+namespace {
+
+class RecordingTraceWriter : public TraceWriter {
+ public:
+  void AppendTraceEvent(TraceObject* trace_event) override {
+    names_.push_back(trace_event->name());
+  }
+  void Flush() override {}
+
+  const std::vector<std::string>& names() const { return names_; }
+
+ private:
+  std::vector<std::string> names_;
+};
+
+
+void AddEvent(ThreadTraceBuffer* buffer, bool overwrite, const char* name,
+              uint64_t* handle) {
+  static const uint8_t kCategoryEnabled = 1;
+  TraceObject* trace_object = buffer->AddTraceEvent(overwrite, handle);
+  ASSERT_NE(nullptr, trace_object);
+  trace_object->Initialize(TRACE_EVENT_PHASE_COMPLETE, &kCategoryEnabled,
+                           name, 0, 0, 0, NULL, NULL, NULL,
+                           TRACE_EVENT_FLAG_NONE);
+}
+
+}  // namespace
+
+
+TEST(TracingTest, TraceConfigDefault) {
+  TraceConfig* trace_config = TraceConfig::CreateDefaultTraceConfig();
+  EXPECT_TRUE(trace_config->IsCategoryGroupEnabled("v8"));
+  EXPECT_TRUE(trace_config->IsCategoryGroupEnabled("cc,v8"));
+  EXPECT_FALSE(trace_config->IsCategoryGroupEnabled("cc"));
+  EXPECT_FALSE(trace_config->IsCategoryGroupEnabled("v8.gc"));
+  EXPECT_FALSE(trace_config->IsCategoryGroupEnabled("disabled-by-default-v8"));
+  EXPECT_EQ(RECORD_UNTIL_FULL, trace_config->GetTraceRecordMode());
+  delete trace_config;
+}
+
+
+TEST(TracingTest, TraceConfigPatterns) {
+  TraceConfig trace_config;
+  trace_config.AddIncludedCategory("v8*");
+  trace_config.AddIncludedCategory("disabled-by-default-v8.gc");
+  trace_config.AddExcludedCategory("v8.runtime");
+  EXPECT_TRUE(trace_config.IsCategoryGroupEnabled("v8"));
+  EXPECT_TRUE(trace_config.IsCategoryGroupEnabled("v8.gc"));
+  EXPECT_FALSE(trace_config.IsCategoryGroupEnabled("v8.runtime"));
+  EXPECT_TRUE(trace_config.IsCategoryGroupEnabled("v8.runtime,v8.gc"));
+  EXPECT_TRUE(trace_config.IsCategoryGroupEnabled("disabled-by-default-v8.gc"));
+  EXPECT_FALSE(
+      trace_config.IsCategoryGroupEnabled("disabled-by-default-v8.compile"));
+}
+
+
+TEST(TracingTest, ThreadTraceBufferRecordUntilFull) {
+  ThreadTraceBuffer buffer(0, 2);
+  uint64_t handle1, handle2, handle3 = 0;
+  AddEvent(&buffer, false, "a", &handle1);
+  AddEvent(&buffer, false, "b", &handle2);
+  EXPECT_EQ(nullptr, buffer.AddTraceEvent(false, &handle3));
+  EXPECT_NE(0u, handle1);
+  EXPECT_NE(handle1, handle2);
+  EXPECT_STREQ("a", buffer.GetEventByHandle(handle1)->name());
+  EXPECT_STREQ("b", buffer.GetEventByHandle(handle2)->name());
+
+  RecordingTraceWriter writer;
+  buffer.Flush(&writer);
+  ASSERT_EQ(2u, writer.names().size());
+  EXPECT_EQ("a", writer.names()[0]);
+  EXPECT_EQ("b", writer.names()[1]);
+  // Flushed events can no longer be found.
+  EXPECT_EQ(nullptr, buffer.GetEventByHandle(handle1));
+  EXPECT_EQ(nullptr, buffer.GetEventByHandle(handle2));
+}
+
+
+TEST(TracingTest, ThreadTraceBufferRecordContinuously) {
+  ThreadTraceBuffer buffer(3, 2);
+  uint64_t handle1, handle2, handle3;
+  AddEvent(&buffer, true, "a", &handle1);
+  AddEvent(&buffer, true, "b", &handle2);
+  AddEvent(&buffer, true, "c", &handle3);
+  EXPECT_EQ(3u, ThreadTraceBuffer::BufferIdOf(handle3));
+  EXPECT_EQ(nullptr, buffer.GetEventByHandle(handle1));
+  EXPECT_STREQ("b", buffer.GetEventByHandle(handle2)->name());
+  EXPECT_STREQ("c", buffer.GetEventByHandle(handle3)->name());
+
+  RecordingTraceWriter writer;
+  buffer.Flush(&writer);
+  ASSERT_EQ(2u, writer.names().size());
+  EXPECT_EQ("b", writer.names()[0]);
+  EXPECT_EQ("c", writer.names()[1]);
+}
+
+
+TEST(TracingTest, TracingControllerJSONOutput) {
+  std::ostringstream stream;
+  {
+    TracingController tracing_controller;
+    tracing_controller.Initialize(TraceWriter::CreateJSONTraceWriter(stream));
+    TraceConfig* trace_config = new TraceConfig();
+    trace_config->AddIncludedCategory("tracing-unittest");
+    tracing_controller.StartTracing(trace_config);
+
+    const uint8_t* enabled =
+        tracing_controller.GetCategoryGroupEnabled("tracing-unittest");
+    const uint8_t* disabled =
+        tracing_controller.GetCategoryGroupEnabled("tracing-unittest-off");
+    EXPECT_NE(0, *enabled);
+    EXPECT_EQ(0, *disabled);
+    EXPECT_STREQ("tracing-unittest",
+                 TracingController::GetCategoryGroupName(enabled));
+
+    const char* arg_names[] = {"str", "num"};
+    const uint8_t arg_types[] = {TRACE_VALUE_TYPE_COPY_STRING,
+                                 TRACE_VALUE_TYPE_INT};
+    std::string str("say \"hi\"");
+    uint64_t arg_values[] = {
+        reinterpret_cast<uint64_t>(reinterpret_cast<uintptr_t>(str.c_str())),
+        static_cast<uint64_t>(-5)};
+    uint64_t handle = tracing_controller.AddTraceEvent(
+        TRACE_EVENT_PHASE_COMPLETE, enabled, "event", 0, 0, 2, arg_names,
+        arg_types, arg_values, TRACE_EVENT_FLAG_NONE);
+    EXPECT_NE(0u, handle);
+    // The string argument was copied.
+    str.assign("changed");
+    tracing_controller.UpdateTraceEventDuration(enabled, "event", handle);
+    tracing_controller.StopTracing();
+    // The trace is complete as soon as tracing stopped.
+    EXPECT_EQ(stream.str().size() - 2, stream.str().rfind("]}"));
+
+    // Nothing is recorded once tracing stopped.
+    EXPECT_EQ(0, *enabled);
+    EXPECT_EQ(0u, tracing_controller.AddTraceEvent(
+                      TRACE_EVENT_PHASE_INSTANT, enabled, "late", 0, 0, 0,
+                      NULL, NULL, NULL, TRACE_EVENT_FLAG_NONE));
+  }
+  std::string json = stream.str();
+  EXPECT_EQ(0u, json.find("{\"traceEvents\":[{\"pid\":"));
+  EXPECT_NE(std::string::npos,
+            json.find("\"ph\":\"X\",\"cat\":\"tracing-unittest\","
+                      "\"name\":\"event\",\"dur\":"));
+  EXPECT_NE(std::string::npos,
+            json.find("\"args\":{\"str\":\"say \\\"hi\\\"\",\"num\":-5}}]}"));
+  EXPECT_EQ(std::string::npos, json.find("late"));
+}
+
+}  // namespace tracing
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,172 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/atomicops.h"
+#include "src/base/platform/platform.h"
+#include "src/libplatform/work-stealing-task-queue.h"
+#include "src/libplatform/worker-thread.h"
+#include "testing/gmock/include/gmock/gmock.h"
+
+using testing::InSequence;
+using testing::IsNull;
+using testing::StrictMock;
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+struct MockTask : public Task {
+  MOCK_METHOD0(Run, void());
+};
+
+
+struct DyingMockTask : public Task {
+  virtual ~DyingMockTask() { Die(); }
+  MOCK_METHOD0(Run, void());
+  MOCK_METHOD0(Die, void());
+};
+
+
+class WorkStealingTaskQueueThread final : public base::Thread {
+ public:
+  WorkStealingTaskQueueThread(WorkStealingTaskQueue* queue, int index)
+      : Thread(Options("libplatform WorkStealingTaskQueueThread")),
+        queue_(queue),
+        index_(index) {}
+
+  void Run() override {
+    queue_->BindWorkerThread(index_);
+    EXPECT_THAT(queue_->GetNext(index_), IsNull());
+  }
+
+ private:
+  WorkStealingTaskQueue* queue_;
+  int index_;
+};
+
+
+// Burns a fixed amount of CPU and counts its completion.
+class SpinTask : public Task {
+ public:
+  explicit SpinTask(base::Atomic32* counter) : counter_(counter) {}
+
+  void Run() override {
+    volatile int sink = 0;
+    for (int i = 0; i < kIterations; ++i) sink += i;
+    base::Barrier_AtomicIncrement(counter_, 1);
+  }
+
+ private:
+  static const int kIterations = 20000;
+  base::Atomic32* counter_;
+};
+
+}  // namespace
+
+
+TEST(WorkStealingTaskQueueTest, Basic) {
+  WorkStealingTaskQueue queue(1);
+  MockTask task;
+  queue.Append(&task, Platform::kShortRunningTask);
+  EXPECT_EQ(&task, queue.GetNext(0));
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+
+TEST(WorkStealingTaskQueueTest, PrefersShortRunningTasks) {
+  WorkStealingTaskQueue queue(1);
+  MockTask long_task;
+  MockTask short_task;
+  queue.Append(&long_task, Platform::kLongRunningTask);
+  queue.Append(&short_task, Platform::kShortRunningTask);
+  EXPECT_EQ(&short_task, queue.GetNext(0));
+  EXPECT_EQ(&long_task, queue.GetNext(0));
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+
+TEST(WorkStealingTaskQueueTest, StealsFromOtherWorkers) {
+  static const int kNumWorkers = 4;
+  static const int kNumTasks = 2 * kNumWorkers;
+
+  WorkStealingTaskQueue queue(kNumWorkers);
+  MockTask tasks[kNumTasks];
+  for (int i = 0; i < kNumTasks; ++i) {
+    queue.Append(&tasks[i], i % 2 == 0 ? Platform::kShortRunningTask
+                                       : Platform::kLongRunningTask);
+  }
+  // Tasks have been spread over all workers, but a single worker drains
+  // them all.
+  for (int i = 0; i < kNumTasks; ++i) {
+    EXPECT_THAT(queue.GetNext(0), testing::NotNull());
+  }
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+
+TEST(WorkStealingTaskQueueTest, TerminateMultipleReaders) {
+  WorkStealingTaskQueue queue(2);
+  WorkStealingTaskQueueThread thread1(&queue, 0);
+  WorkStealingTaskQueueThread thread2(&queue, 1);
+  thread1.Start();
+  thread2.Start();
+  queue.Terminate();
+  thread1.Join();
+  thread2.Join();
+}
+
+
+TEST(WorkStealingTaskQueueTest, WorkerThreads) {
+  static const size_t kNumTasks = 10;
+
+  WorkStealingTaskQueue queue(2);
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    InSequence s;
+    StrictMock<DyingMockTask>* task = new StrictMock<DyingMockTask>;
+    EXPECT_CALL(*task, Run());
+    EXPECT_CALL(*task, Die());
+    queue.Append(task, i % 2 == 0 ? Platform::kShortRunningTask
+                                  : Platform::kLongRunningTask);
+  }
+
+  WorkerThread thread1(&queue, 0);
+  WorkerThread thread2(&queue, 1);
+
+  // The queue DCHECKs that it's empty in its destructor.
+  queue.Terminate();
+}
+
+
+// All tasks run however many workers share the queue.
+TEST(WorkStealingTaskQueueTest, ManyWorkers) {
+  static const int kNumTasks = 20000;
+  static const int kMaxWorkers = 16;
+
+  for (int workers = 1; workers <= kMaxWorkers; workers *= 2) {
+    base::Atomic32 completed = 0;
+    WorkStealingTaskQueue queue(workers);
+    {
+      std::vector<WorkerThread*> threads;
+      for (int i = 0; i < workers; ++i) {
+        threads.push_back(new WorkerThread(&queue, i));
+      }
+      for (int i = 0; i < kNumTasks; ++i) {
+        queue.Append(new SpinTask(&completed), Platform::kShortRunningTask);
+      }
+      queue.Terminate();
+      for (size_t i = 0; i < threads.size(); ++i) delete threads[i];
+    }
+    EXPECT_EQ(kNumTasks, base::Acquire_Load(&completed));
+  }
+}
+
+}  // namespace platform
+}  // namespace v8
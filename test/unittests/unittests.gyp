@@ -103,6 +103,8 @@
         'interpreter/register-translator-unittest.cc',
         'libplatform/default-platform-unittest.cc',
         'libplatform/task-queue-unittest.cc',
+        'libplatform/tracing-unittest.cc',
+        'libplatform/work-stealing-task-queue-unittest.cc',
         'libplatform/worker-thread-unittest.cc',
         'heap/bitmap-unittest.cc',
         'heap/gc-idle-time-handler-unittest.cc',
@@ -120,6 +122,7 @@
         'wasm/loop-assignment-analysis-unittest.cc',
         'wasm/module-decoder-unittest.cc',
         'wasm/wasm-macro-gen-unittest.cc',
+        'zone-segment-pool-unittest.cc',
       ],
       'conditions': [
         ['v8_target_arch=="arm"', {
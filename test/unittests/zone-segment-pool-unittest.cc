@@ -0,0 +1,66 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/flags.h"
+#include "src/zone.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(ZoneSegmentPool, SizeFor) {
+  EXPECT_EQ(ZoneSegmentPool::kMinimumSize, ZoneSegmentPool::SizeFor(1));
+  EXPECT_EQ(ZoneSegmentPool::kMinimumSize,
+            ZoneSegmentPool::SizeFor(ZoneSegmentPool::kMinimumSize));
+  EXPECT_EQ(32u * KB, ZoneSegmentPool::SizeFor(16 * KB + 1));
+  EXPECT_EQ(ZoneSegmentPool::kMaximumSize,
+            ZoneSegmentPool::SizeFor(ZoneSegmentPool::kMaximumSize));
+  // Segments larger than the largest size class are not rounded.
+  EXPECT_EQ(ZoneSegmentPool::kMaximumSize + 1,
+            ZoneSegmentPool::SizeFor(ZoneSegmentPool::kMaximumSize + 1));
+}
+
+
+TEST(ZoneSegmentPool, ReusesFreedSegments) {
+  ZoneSegmentPool::Trim();
+  size_t pooled_allocations = ZoneSegmentPool::pooled_allocations();
+  void* segment = ZoneSegmentPool::Allocate(20 * KB);
+  ZoneSegmentPool::Free(segment, ZoneSegmentPool::SizeFor(20 * KB));
+  EXPECT_EQ(32u * KB, ZoneSegmentPool::pooled_bytes());
+  // Any request in the same size class gets the pooled segment back.
+  void* reused = ZoneSegmentPool::Allocate(17 * KB);
+  EXPECT_EQ(segment, reused);
+  EXPECT_EQ(pooled_allocations + 1, ZoneSegmentPool::pooled_allocations());
+  EXPECT_EQ(0u, ZoneSegmentPool::pooled_bytes());
+  ZoneSegmentPool::Free(reused, 32 * KB);
+  ZoneSegmentPool::Trim();
+  EXPECT_EQ(0u, ZoneSegmentPool::pooled_bytes());
+}
+
+
+TEST(ZoneSegmentPool, RespectsLimit) {
+  ZoneSegmentPool::Trim();
+  int old_limit = FLAG_zone_segment_pool_size;
+  FLAG_zone_segment_pool_size = 0;
+  size_t fresh_allocations = ZoneSegmentPool::fresh_allocations();
+  void* segment = ZoneSegmentPool::Allocate(ZoneSegmentPool::kMinimumSize);
+  EXPECT_EQ(fresh_allocations + 1, ZoneSegmentPool::fresh_allocations());
+  ZoneSegmentPool::Free(segment, ZoneSegmentPool::kMinimumSize);
+  EXPECT_EQ(0u, ZoneSegmentPool::pooled_bytes());
+  FLAG_zone_segment_pool_size = old_limit;
+}
+
+
+TEST(ZoneSegmentPool, ZoneReturnsSegments) {
+  ZoneSegmentPool::Trim();
+  {
+    Zone zone;
+    for (int i = 0; i < 100; i++) zone.New(KB);
+  }
+  EXPECT_LT(0u, ZoneSegmentPool::pooled_bytes());
+  ZoneSegmentPool::Trim();
+}
+
+}  // namespace internal
+}  // namespace v8
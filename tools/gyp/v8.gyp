@@ -867,6 +867,8 @@
         '../../src/heap-symbols.h',
         '../../src/heap/array-buffer-tracker.cc',
         '../../src/heap/array-buffer-tracker.h',
+        '../../src/heap/concurrent-marking.cc',
+        '../../src/heap/concurrent-marking.h',
         '../../src/heap/memory-reducer.cc',
         '../../src/heap/memory-reducer.h',
         '../../src/heap/gc-idle-time-handler.cc',
@@ -889,6 +891,8 @@
         '../../src/heap/objects-visiting-inl.h',
         '../../src/heap/objects-visiting.cc',
         '../../src/heap/objects-visiting.h',
+        '../../src/heap/parallel-marking.cc',
+        '../../src/heap/parallel-marking.h',
         '../../src/heap/remembered-set.cc',
         '../../src/heap/remembered-set.h',
         '../../src/heap/scavenge-job.h',
@@ -954,8 +958,12 @@
         '../../src/isolate-inl.h',
         '../../src/isolate.cc',
         '../../src/isolate.h',
+        '../../src/json-chars.h',
+        '../../src/json-parser.cc',
         '../../src/json-parser.h',
         '../../src/json-stringifier.h',
+        '../../src/json-tape.cc',
+        '../../src/json-tape.h',
         '../../src/key-accumulator.h',
         '../../src/key-accumulator.cc',
         '../../src/layout-descriptor-inl.h',
@@ -1920,10 +1928,20 @@
       ],
       'sources': [
         '../../include/libplatform/libplatform.h',
+        '../../include/libplatform/v8-tracing.h',
         '../../src/libplatform/default-platform.cc',
         '../../src/libplatform/default-platform.h',
         '../../src/libplatform/task-queue.cc',
         '../../src/libplatform/task-queue.h',
+        '../../src/libplatform/tracing/trace-buffer.cc',
+        '../../src/libplatform/tracing/trace-buffer.h',
+        '../../src/libplatform/tracing/trace-config.cc',
+        '../../src/libplatform/tracing/trace-object.cc',
+        '../../src/libplatform/tracing/trace-writer.cc',
+        '../../src/libplatform/tracing/trace-writer.h',
+        '../../src/libplatform/tracing/tracing-controller.cc',
+        '../../src/libplatform/work-stealing-task-queue.cc',
+        '../../src/libplatform/work-stealing-task-queue.h',
         '../../src/libplatform/worker-thread.cc',
         '../../src/libplatform/worker-thread.h',
       ],
@@ -0,0 +1,117 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the task throughput of the platform's worker threads for 1 to 16
+// workers, with the single mutex TaskQueue and with the WorkStealingTaskQueue.
+//
+// Usage: task-queue-benchmark [tasks [iterations]]
+//
+// Every task spins for |iterations| loop iterations; small values measure the
+// overhead of the queues themselves.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/atomicops.h"
+#include "src/base/logging.h"
+#include "src/base/platform/elapsed-timer.h"
+#include "src/libplatform/task-queue.h"
+#include "src/libplatform/work-stealing-task-queue.h"
+#include "src/libplatform/worker-thread.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+const int kMaxWorkers = 16;
+
+class SpinTask : public Task {
+ public:
+  SpinTask(base::Atomic32* counter, int iterations)
+      : counter_(counter), iterations_(iterations) {}
+
+  void Run() override {
+    volatile int sink = 0;
+    for (int i = 0; i < iterations_; ++i) sink += i;
+    base::NoBarrier_AtomicIncrement(counter_, 1);
+  }
+
+ private:
+  base::Atomic32* counter_;
+  int iterations_;
+};
+
+
+// Returns the tasks per second of |workers| threads draining a TaskQueue.
+// Both queues hand out the tasks left when they are terminated.
+double RunTaskQueue(int workers, int tasks, int iterations) {
+  base::Atomic32 completed = 0;
+  TaskQueue queue;
+  base::ElapsedTimer timer;
+  timer.Start();
+  {
+    std::vector<WorkerThread*> threads;
+    for (int i = 0; i < workers; ++i) {
+      threads.push_back(new WorkerThread(&queue));
+    }
+    for (int i = 0; i < tasks; ++i) {
+      queue.Append(new SpinTask(&completed, iterations));
+    }
+    queue.Terminate();
+    for (size_t i = 0; i < threads.size(); ++i) delete threads[i];
+  }
+  CHECK_EQ(tasks, base::Acquire_Load(&completed));
+  return tasks / timer.Elapsed().InSecondsF();
+}
+
+
+// Same for a WorkStealingTaskQueue.
+double RunWorkStealingTaskQueue(int workers, int tasks, int iterations) {
+  base::Atomic32 completed = 0;
+  WorkStealingTaskQueue queue(workers);
+  base::ElapsedTimer timer;
+  timer.Start();
+  {
+    std::vector<WorkerThread*> threads;
+    for (int i = 0; i < workers; ++i) {
+      threads.push_back(new WorkerThread(&queue, i));
+    }
+    for (int i = 0; i < tasks; ++i) {
+      queue.Append(new SpinTask(&completed, iterations),
+                   Platform::kShortRunningTask);
+    }
+    queue.Terminate();
+    for (size_t i = 0; i < threads.size(); ++i) delete threads[i];
+  }
+  CHECK_EQ(tasks, base::Acquire_Load(&completed));
+  return tasks / timer.Elapsed().InSecondsF();
+}
+
+}  // namespace
+
+}  // namespace platform
+}  // namespace v8
+
+
+int main(int argc, char* argv[]) {
+  int tasks = argc > 1 ? atoi(argv[1]) : 200000;
+  int iterations = argc > 2 ? atoi(argv[2]) : 1000;
+  if (tasks <= 0 || iterations < 0) {
+    fprintf(stderr, "Usage: %s [tasks [iterations]]\n", argv[0]);
+    return 1;
+  }
+  printf("%d tasks of %d iterations\n", tasks, iterations);
+  printf("%7s %18s %18s\n", "workers", "TaskQueue/s", "WorkStealing/s");
+  for (int workers = 1; workers <= v8::platform::kMaxWorkers; workers *= 2) {
+    double single = v8::platform::RunTaskQueue(workers, tasks, iterations);
+    double stealing =
+        v8::platform::RunWorkStealingTaskQueue(workers, tasks, iterations);
+    printf("%7d %18.0f %18.0f\n", workers, single, stealing);
+  }
+  return 0;
+}
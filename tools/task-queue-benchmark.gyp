@@ -0,0 +1,25 @@
+# Copyright 2016 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+{
+  'variables': {
+    'v8_code': 1,
+  },
+  'includes': ['../build/toolchain.gypi', '../build/features.gypi'],
+  'targets': [
+    {
+      'target_name': 'task-queue-benchmark',
+      'type': 'executable',
+      'dependencies': [
+        '../tools/gyp/v8.gyp:v8_libplatform',
+      ],
+      'include_dirs+': [
+        '..',
+      ],
+      'sources': [
+        'task-queue-benchmark.cc',
+      ],
+    },
+  ],
+}